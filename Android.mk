@@ -145,6 +145,7 @@ LOCAL_SRC_FILES += \
     src/dbus/common/dbus_message_helper_openthread.cpp \
     src/dbus/common/error.cpp \
     src/dbus/server/dbus_agent.cpp \
+    src/dbus/server/dbus_agent_base.cpp \
     src/dbus/server/dbus_object.cpp \
     src/dbus/server/dbus_thread_object.cpp \
     src/dbus/server/error_helper.cpp \
@@ -31,6 +31,8 @@
  *   The file implements the Thread border agent.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_AGENT
+
 #include "agent/border_agent.hpp"
 
 #include <arpa/inet.h>
@@ -26,6 +26,8 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_AGENT
+
 #include <openthread-br/config.h>
 
 #include <mutex>
@@ -64,12 +66,20 @@ static std::mutex sThreadMutex;
 
 static const char kSyslogIdent[]          = "otbr-agent";
 static const char kDefaultInterfaceName[] = "wpan0";
+static const int  kLogBufferSize          = 256; ///< Logs buffered for the log writer thread.
+static const int  kLogLevelsMaxSize       = 512; ///< Max size of the log levels file.
+
+static int                   sLogLevel = OTBR_LOG_INFO;
+static const char *          sLogLevelsFile;
+static volatile sig_atomic_t sLogLevelsReloadRequested;
 
 // Default poll timeout.
 static const struct timeval kPollTimeout = {10, 0};
 static const struct option  kOptions[]   = {{"debug-level", required_argument, NULL, 'd'},
+                                         {"dump-limits", required_argument, NULL, 'D'},
                                          {"help", no_argument, NULL, 'h'},
                                          {"thread-ifname", required_argument, NULL, 'I'},
+                                         {"log-levels", required_argument, NULL, 'L'},
                                          {"verbose", no_argument, NULL, 'v'},
                                          {"version", no_argument, NULL, 'V'},
                                          {0, 0, 0, 0}};
@@ -79,6 +89,67 @@ static void HandleSignal(int aSignal)
     signal(aSignal, SIG_DFL);
 }
 
+static void HandleReloadSignal(int aSignal)
+{
+    (void)aSignal;
+    sLogLevelsReloadRequested = true;
+}
+
+/**
+ * This function resets the log levels of all the modules to the debug level, and applies the log levels file.
+ *
+ */
+static void LoadLogLevels(void)
+{
+    char   levels[kLogLevelsMaxSize];
+    int    length = snprintf(levels, sizeof(levels), "all=%d ", sLogLevel);
+    FILE * fp     = NULL;
+    size_t size;
+
+    if (sLogLevelsFile != NULL)
+    {
+        fp = fopen(sLogLevelsFile, "r");
+        VerifyOrExit(fp != NULL, otbrLog(OTBR_LOG_WARNING, "Cannot open %s: %s", sLogLevelsFile, strerror(errno)));
+
+        size = fread(&levels[length], 1, sizeof(levels) - length - 1, fp);
+        VerifyOrExit(feof(fp), otbrLog(OTBR_LOG_WARNING, "Log levels file %s is too large", sLogLevelsFile));
+        levels[length + size] = '\0';
+    }
+
+    VerifyOrExit(otbrLogSetModuleLevels(levels) == OTBR_ERROR_NONE,
+                 otbrLog(OTBR_LOG_WARNING, "Invalid log levels: %s", levels));
+    otbrLog(OTBR_LOG_INFO, "Log levels: %s", levels);
+
+exit:
+    if (fp != NULL)
+    {
+        fclose(fp);
+    }
+}
+
+/**
+ * This function parses and applies the limits of hex dumps, given as "RATE,BURST,SAMPLE_RATE,MAX_SIZE".
+ *
+ */
+static bool SetDumpLimits(const char *aLimits)
+{
+    unsigned int rate;
+    unsigned int burst;
+    unsigned int sampleRate;
+    unsigned int maxSize;
+    char         end;
+    bool         valid = false;
+
+    VerifyOrExit(sscanf(aLimits, "%u,%u,%u,%u%c", &rate, &burst, &sampleRate, &maxSize, &end) == 4);
+    VerifyOrExit(burst >= 1 && sampleRate >= 1);
+
+    otbrDumpSetLimits(rate, burst, sampleRate, maxSize);
+    valid = true;
+
+exit:
+    return valid;
+}
+
 static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
 {
     int error = EXIT_FAILURE;
@@ -94,6 +165,8 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
 
     // allow quitting elegantly
     signal(SIGTERM, HandleSignal);
+    // reload the log levels
+    signal(SIGHUP, HandleReloadSignal);
 
     while (true)
     {
@@ -122,6 +195,12 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
         rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                       &mainloop.mTimeout);
 
+        if (sLogLevelsReloadRequested)
+        {
+            sLogLevelsReloadRequested = false;
+            LoadLogLevels();
+        }
+
 #if OTBR_ENABLE_NCP_OPENTHREAD && OTBR_ENABLE_DBUS_SERVER
         if (ncpOpenThread->IsResetRequested())
         {
@@ -140,6 +219,12 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
 
 #if OTBR_ENABLE_NCP_OPENTHREAD && OTBR_ENABLE_DBUS_SERVER
             dbusAgent->Process(mainloop.mReadFdSet, mainloop.mWriteFdSet, mainloop.mErrorFdSet);
+#endif
+        }
+        else if (errno == EINTR)
+        {
+#if OTBR_ENABLE_OPENWRT
+            sThreadMutex.lock();
 #endif
         }
         else
@@ -159,10 +244,17 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
 static void PrintHelp(const char *aProgramName)
 {
 #if OTBR_ENABLE_NCP_WPANTUND
-    fprintf(stderr, "Usage: %s [-I interfaceName] [-d DEBUG_LEVEL] [-v]\n", aProgramName);
+    fprintf(stderr, "Usage: %s [-I interfaceName] [-d DEBUG_LEVEL] [-L LOG_LEVELS_FILE] [-D DUMP_LIMITS] [-v]\n",
+            aProgramName);
 #else
-    fprintf(stderr, "Usage: %s [-I interfaceName] [-d DEBUG_LEVEL] [-v] [RADIO_DEVICE] [RADIO_CONFIG]\n", aProgramName);
+    fprintf(stderr,
+            "Usage: %s [-I interfaceName] [-d DEBUG_LEVEL] [-L LOG_LEVELS_FILE] [-D DUMP_LIMITS] [-v] [RADIO_DEVICE] "
+            "[RADIO_CONFIG]\n",
+            aProgramName);
 #endif
+    fprintf(stderr, "LOG_LEVELS_FILE lists levels of modules like \"dtls=7 coap=6\", it is reloaded on SIGHUP.\n");
+    fprintf(stderr, "DUMP_LIMITS is RATE,BURST,SAMPLE_RATE,MAX_SIZE of hex dumps like \"20,20,1,256\".\n");
+    fprintf(stderr, "Hex dumps are not limited by default, and 0 disables the rate or the size limit.\n");
 }
 
 static void PrintVersion(void)
@@ -178,7 +270,6 @@ static void OnAllocateFailed(void)
 
 int main(int argc, char *argv[])
 {
-    int                    logLevel = OTBR_LOG_INFO;
     int                    opt;
     int                    ret           = EXIT_SUCCESS;
     const char *           interfaceName = kDefaultInterfaceName;
@@ -187,12 +278,20 @@ int main(int argc, char *argv[])
 
     std::set_new_handler(OnAllocateFailed);
 
-    while ((opt = getopt_long(argc, argv, "d:hI:Vv", kOptions, NULL)) != -1)
+    while ((opt = getopt_long(argc, argv, "d:D:hI:L:Vv", kOptions, NULL)) != -1)
     {
         switch (opt)
         {
         case 'd':
-            logLevel = atoi(optarg);
+            sLogLevel = atoi(optarg);
+            break;
+
+        case 'D':
+            VerifyOrExit(SetDumpLimits(optarg), PrintHelp(argv[0]), ret = EXIT_FAILURE);
+            break;
+
+        case 'L':
+            sLogLevelsFile = optarg;
             break;
 
         case 'I':
@@ -227,7 +326,12 @@ int main(int argc, char *argv[])
 #endif
     VerifyOrExit(ncp != NULL, ret = EXIT_FAILURE);
 
-    otbrLogInit(kSyslogIdent, logLevel, verbose);
+    otbrLogInit(kSyslogIdent, sLogLevel, verbose);
+    otbrLogEnableAsync(kLogBufferSize, OTBR_LOG_OVERFLOW_DROP);
+    if (sLogLevelsFile != NULL)
+    {
+        LoadLogLevels();
+    }
 
     otbrLog(OTBR_LOG_INFO, "Thread interface %s", interfaceName);
 
@@ -31,6 +31,8 @@
  *   This file implements MDNS service based on avahi.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_MDNS
+
 #include "agent/mdns_mdnssd.hpp"
 
 #include <arpa/inet.h>
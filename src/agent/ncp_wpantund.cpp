@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_NCP
+
 #include "ncp_wpantund.hpp"
 
 #include <vector>
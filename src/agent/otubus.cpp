@@ -30,6 +30,8 @@
 #define BYTE_ORDER_BIG_ENDIAN 1
 #endif
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_UBUS
+
 #include "agent/otubus.hpp"
 
 #include <mutex>
@@ -41,6 +43,7 @@
 #include <openthread/thread_ftd.h>
 
 #include "ncp_openthread.hpp"
+#include "common/format.hpp"
 #include "common/logging.hpp"
 
 namespace otbr {
@@ -247,12 +250,7 @@ void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aCont
 
 void UbusServer::OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput)
 {
-    char byte2char[5] = "";
-    for (int i = 0; i < aLength; i++)
-    {
-        sprintf(byte2char, "%02x", aBytes[i]);
-        strcat(aOutput, byte2char);
-    }
+    Format::EncodeHex(aBytes, aLength, aOutput + strlen(aOutput));
 }
 
 void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, struct ubus_request_data *aRequest)
@@ -284,7 +282,7 @@ void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
     OutputBytes(aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
     blobmsg_add_string(&mBuf, "ExtendedPanId", xpanidstring);
 
-    sprintf(panidstring, "0x%04x", aResult->mPanId);
+    Format::StringBuilder(panidstring, sizeof(panidstring)).Append("0x").AppendHex(aResult->mPanId, 4);
     blobmsg_add_string(&mBuf, "PanId", panidstring);
 
     blobmsg_add_u32(&mBuf, "Channel", aResult->mChannel);
@@ -762,10 +760,10 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context *     aContext,
     jsonList  = blobmsg_open_table(&mBuf, "parent");
     blobmsg_add_string(&mBuf, "Role", "R");
 
-    sprintf(transfer, "0x%04x", parentInfo.mRloc16);
+    Format::StringBuilder(transfer, sizeof(transfer)).Append("0x").AppendHex(parentInfo.mRloc16, 4);
     blobmsg_add_string(&mBuf, "Rloc16", transfer);
 
-    sprintf(transfer, "%3d", parentInfo.mAge);
+    Format::StringBuilder(transfer, sizeof(transfer)).AppendUnsigned(parentInfo.mAge, 3);
     blobmsg_add_string(&mBuf, "Age", transfer);
 
     OutputBytes(parentInfo.mExtAddress.m8, sizeof(parentInfo.mExtAddress.m8), extAddress);
@@ -811,36 +809,40 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context *     aContext,
 
         blobmsg_add_string(&mBuf, "Role", neighborInfo.mIsChild ? "C" : "R");
 
-        sprintf(transfer, "0x%04x", neighborInfo.mRloc16);
+        Format::StringBuilder(transfer, sizeof(transfer)).Append("0x").AppendHex(neighborInfo.mRloc16, 4);
         blobmsg_add_string(&mBuf, "Rloc16", transfer);
 
-        sprintf(transfer, "%3d", neighborInfo.mAge);
+        Format::StringBuilder(transfer, sizeof(transfer)).AppendUnsigned(neighborInfo.mAge, 3);
         blobmsg_add_string(&mBuf, "Age", transfer);
 
-        sprintf(transfer, "%8d", neighborInfo.mAverageRssi);
+        Format::StringBuilder(transfer, sizeof(transfer)).AppendSigned(neighborInfo.mAverageRssi, 8);
         blobmsg_add_string(&mBuf, "AvgRssi", transfer);
 
-        sprintf(transfer, "%9d", neighborInfo.mLastRssi);
+        Format::StringBuilder(transfer, sizeof(transfer)).AppendSigned(neighborInfo.mLastRssi, 9);
         blobmsg_add_string(&mBuf, "LastRssi", transfer);
 
-        if (neighborInfo.mRxOnWhenIdle)
         {
-            strcat(mode, "r");
-        }
+            Format::StringBuilder modeBuilder(mode, sizeof(mode));
 
-        if (neighborInfo.mSecureDataRequest)
-        {
-            strcat(mode, "s");
-        }
+            if (neighborInfo.mRxOnWhenIdle)
+            {
+                modeBuilder.AppendChar('r');
+            }
 
-        if (neighborInfo.mFullThreadDevice)
-        {
-            strcat(mode, "d");
-        }
+            if (neighborInfo.mSecureDataRequest)
+            {
+                modeBuilder.AppendChar('s');
+            }
 
-        if (neighborInfo.mFullNetworkData)
-        {
-            strcat(mode, "n");
+            if (neighborInfo.mFullThreadDevice)
+            {
+                modeBuilder.AppendChar('d');
+            }
+
+            if (neighborInfo.mFullNetworkData)
+            {
+                modeBuilder.AppendChar('n');
+            }
         }
         blobmsg_add_string(&mBuf, "Mode", mode);
 
@@ -851,8 +853,7 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context *     aContext,
 
         blobmsg_close_table(&mBuf, jsonList);
 
-        memset(mode, 0, sizeof(mode));
-        memset(extAddress, 0, sizeof(extAddress));
+        extAddress[0] = '\0';
     }
 
     blobmsg_close_array(&mBuf, sJsonUri);
@@ -1104,13 +1105,17 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
     else if (!strcmp(aAction, "panid"))
     {
         char panIdString[PANID_LENGTH];
-        sprintf(panIdString, "0x%04x", otLinkGetPanId(mController->GetInstance()));
+        Format::StringBuilder(panIdString, sizeof(panIdString))
+            .Append("0x")
+            .AppendHex(otLinkGetPanId(mController->GetInstance()), 4);
         blobmsg_add_string(&mBuf, "PanId", panIdString);
     }
     else if (!strcmp(aAction, "rloc16"))
     {
         char rloc[PANID_LENGTH];
-        sprintf(rloc, "0x%04x", otThreadGetRloc16(mController->GetInstance()));
+        Format::StringBuilder(rloc, sizeof(rloc))
+            .Append("0x")
+            .AppendHex(otThreadGetRloc16(mController->GetInstance()), 4);
         blobmsg_add_string(&mBuf, "rloc16", rloc);
     }
     else if (!strcmp(aAction, "masterkey"))
@@ -1137,8 +1142,9 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
     }
     else if (!strcmp(aAction, "mode"))
     {
-        otLinkModeConfig linkMode;
-        char             mode[5] = "";
+        otLinkModeConfig      linkMode;
+        char                  mode[5];
+        Format::StringBuilder modeBuilder(mode, sizeof(mode));
 
         memset(&linkMode, 0, sizeof(otLinkModeConfig));
 
@@ -1146,22 +1152,22 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
 
         if (linkMode.mRxOnWhenIdle)
         {
-            strcat(mode, "r");
+            modeBuilder.AppendChar('r');
         }
 
         if (linkMode.mSecureDataRequests)
         {
-            strcat(mode, "s");
+            modeBuilder.AppendChar('s');
         }
 
         if (linkMode.mDeviceType)
         {
-            strcat(mode, "d");
+            modeBuilder.AppendChar('d');
         }
 
         if (linkMode.mNetworkData)
         {
-            strcat(mode, "n");
+            modeBuilder.AppendChar('n');
         }
         blobmsg_add_string(&mBuf, "Mode", mode);
     }
@@ -1326,14 +1332,14 @@ void UbusServer::HandleDiagnosticGetResponse(otMessage *aMessage, const otMessag
     otNetworkDiagIterator iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
 
     char networkdata[20];
-    sprintf(networkdata, "networkdata%d", sBufNum);
+    Format::StringBuilder(networkdata, sizeof(networkdata)).Append("networkdata").AppendSigned(sBufNum);
     sJsonUri = blobmsg_open_table(&mNetworkdataBuf, networkdata);
     sBufNum++;
 
     if (IsRoutingLocator(&aMessageInfo.mSockAddr))
     {
         sockRloc16 = aMessageInfo.mPeerAddr.mFields.m16[7];
-        sprintf(xrloc, "0x%04x", sockRloc16);
+        Format::StringBuilder(xrloc, sizeof(xrloc)).Append("0x").AppendHex(sockRloc16, 4);
         blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
     }
 
@@ -1357,7 +1363,7 @@ void UbusServer::HandleDiagnosticGetResponse(otMessage *aMessage, const otMessag
                     jsonItem = blobmsg_open_table(&mNetworkdataBuf, "router");
                     rloc16   = route.mRouteData[i].mRouterId << 10;
                     blobmsg_add_u32(&mNetworkdataBuf, "routerid", route.mRouteData[i].mRouterId);
-                    sprintf(xrloc, "0x%04x", rloc16);
+                    Format::StringBuilder(xrloc, sizeof(xrloc)).Append("0x").AppendHex(rloc16, 4);
                     blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
                     blobmsg_close_table(&mNetworkdataBuf, jsonItem);
                 }
@@ -1383,7 +1389,7 @@ void UbusServer::HandleDiagnosticGetResponse(otMessage *aMessage, const otMessag
                 uint8_t mode = 0;
 
                 jsonItem = blobmsg_open_table(&mNetworkdataBuf, "child");
-                sprintf(xrloc, "0x%04x", (sockRloc16 | entry.mChildId));
+                Format::StringBuilder(xrloc, sizeof(xrloc)).Append("0x").AppendHex(sockRloc16 | entry.mChildId, 4);
                 blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
 
                 mode = (entry.mMode.mRxOnWhenIdle ? kModeRxOnWhenIdle : 0) |
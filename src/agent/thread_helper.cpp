@@ -26,6 +26,8 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_AGENT
+
 #include "agent/thread_helper.hpp"
 
 #include <assert.h>
@@ -37,6 +39,7 @@
 
 #include <openthread/border_router.h>
 #include <openthread/channel_manager.h>
+#include <openthread/dataset.h>
 #include <openthread/jam_detection.h>
 #include <openthread/joiner.h>
 #include <openthread/thread_ftd.h>
@@ -69,6 +72,11 @@ void ThreadHelper::sStateChangedCallback(otChangedFlags aFlags, void *aThreadHel
 
 void ThreadHelper::StateChangedCallback(otChangedFlags aFlags)
 {
+    for (const auto &handler : mStateChangedHandlers)
+    {
+        handler(aFlags);
+    }
+
     if (aFlags & OT_CHANGED_THREAD_ROLE)
     {
         otDeviceRole role = otThreadGetDeviceRole(mInstance);
@@ -99,6 +107,11 @@ void ThreadHelper::AddDeviceRoleHandler(DeviceRoleHandler aHandler)
     mDeviceRoleHandlers.emplace_back(aHandler);
 }
 
+void ThreadHelper::AddStateChangedHandler(StateChangedHandler aHandler)
+{
+    mStateChangedHandlers.emplace_back(aHandler);
+}
+
 void ThreadHelper::Scan(ScanHandler aHandler)
 {
     otError error = OT_ERROR_NONE;
@@ -200,6 +213,7 @@ void ThreadHelper::Attach(const std::string &         aNetworkName,
     otPskc          pskc;
     uint32_t        channelMask;
     uint8_t         channel;
+    MeshcopDataset  dataset;
 
     VerifyOrExit(aHandler != nullptr, error = OT_ERROR_INVALID_ARGS);
     VerifyOrExit(mAttachHandler == nullptr && mJoinerHandler == nullptr, error = OT_ERROR_INVALID_STATE);
@@ -248,11 +262,6 @@ void ThreadHelper::Attach(const std::string &         aNetworkName,
         SuccessOrExit(error = otIp6SetEnabled(mInstance, true));
     }
 
-    SuccessOrExit(error = otThreadSetNetworkName(mInstance, aNetworkName.c_str()));
-    SuccessOrExit(error = otLinkSetPanId(mInstance, aPanId));
-    SuccessOrExit(error = otThreadSetExtendedPanId(mInstance, &extPanId));
-    SuccessOrExit(error = otThreadSetMasterKey(mInstance, &masterKey));
-
     channelMask = otPlatRadioGetPreferredChannelMask(mInstance) & aChannelMask;
 
     if (channelMask == 0)
@@ -262,9 +271,16 @@ void ThreadHelper::Attach(const std::string &         aNetworkName,
     VerifyOrExit(channelMask != 0, otbrLog(OTBR_LOG_WARNING, "Invalid channel mask"), error = OT_ERROR_INVALID_ARGS);
 
     channel = RandomChannelFromChannelMask(channelMask);
-    SuccessOrExit(otLinkSetChannel(mInstance, channel));
 
-    SuccessOrExit(error = otThreadSetPskc(mInstance, &pskc));
+    VerifyOrExit(dataset.SetNetworkName(aNetworkName.c_str()) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    dataset.SetActiveTimestamp(1);
+    dataset.SetPanId(aPanId);
+    dataset.SetExtPanId(extPanId.m8);
+    dataset.SetMasterKey(masterKey.m8);
+    dataset.SetChannel(channel);
+    dataset.SetPskc(pskc.m8);
+
+    SuccessOrExit(error = ApplyActiveDataset(dataset));
 
     SuccessOrExit(error = otThreadSetEnabled(mInstance, true));
 exit:
@@ -278,6 +294,89 @@ exit:
     }
 }
 
+otError ThreadHelper::ApplyActiveDataset(const MeshcopDataset &aDataset)
+{
+    otOperationalDataset            dataset;
+    otOperationalDatasetComponents &components = dataset.mComponents;
+
+    memset(&dataset, 0, sizeof(dataset));
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentActiveTimestamp))
+    {
+        dataset.mActiveTimestamp             = aDataset.GetActiveTimestamp();
+        components.mIsActiveTimestampPresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentPendingTimestamp))
+    {
+        dataset.mPendingTimestamp             = aDataset.GetPendingTimestamp();
+        components.mIsPendingTimestampPresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentMasterKey))
+    {
+        memcpy(dataset.mMasterKey.m8, aDataset.GetMasterKey(), sizeof(dataset.mMasterKey.m8));
+        components.mIsMasterKeyPresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentNetworkName))
+    {
+        strncpy(dataset.mNetworkName.m8, aDataset.GetNetworkName(), sizeof(dataset.mNetworkName.m8) - 1);
+        components.mIsNetworkNamePresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentExtPanId))
+    {
+        memcpy(dataset.mExtendedPanId.m8, aDataset.GetExtPanId(), sizeof(dataset.mExtendedPanId.m8));
+        components.mIsExtendedPanIdPresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentMeshLocalPrefix))
+    {
+        memcpy(dataset.mMeshLocalPrefix.m8, aDataset.GetMeshLocalPrefix(), sizeof(dataset.mMeshLocalPrefix.m8));
+        components.mIsMeshLocalPrefixPresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentDelayTimer))
+    {
+        dataset.mDelay             = aDataset.GetDelayTimer();
+        components.mIsDelayPresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentPanId))
+    {
+        dataset.mPanId             = aDataset.GetPanId();
+        components.mIsPanIdPresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentChannel))
+    {
+        dataset.mChannel             = aDataset.GetChannel();
+        components.mIsChannelPresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentPskc))
+    {
+        memcpy(dataset.mPskc.m8, aDataset.GetPskc(), sizeof(dataset.mPskc.m8));
+        components.mIsPskcPresent = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentSecurityPolicy))
+    {
+        dataset.mSecurityPolicy.mRotationTime = aDataset.GetRotationTime();
+        dataset.mSecurityPolicy.mFlags        = aDataset.GetSecurityPolicyFlags();
+        components.mIsSecurityPolicyPresent   = true;
+    }
+
+    if (aDataset.IsPresent(MeshcopDataset::kComponentChannelMask))
+    {
+        dataset.mChannelMask             = aDataset.GetChannelMask();
+        components.mIsChannelMaskPresent = true;
+    }
+
+    return otDatasetSetActive(mInstance, &dataset);
+}
+
 otError ThreadHelper::Reset(void)
 {
     mDeviceRoleHandlers.clear();
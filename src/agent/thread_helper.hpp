@@ -43,6 +43,8 @@
 #include <openthread/netdata.h>
 #include <openthread/thread.h>
 
+#include "utils/meshcop_dataset.hpp"
+
 namespace otbr {
 namespace Ncp {
 class ControllerOpenThread;
@@ -55,9 +57,10 @@ namespace agent {
 class ThreadHelper
 {
 public:
-    using DeviceRoleHandler = std::function<void(otDeviceRole)>;
-    using ScanHandler       = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
-    using ResultHandler     = std::function<void(otError)>;
+    using DeviceRoleHandler   = std::function<void(otDeviceRole)>;
+    using StateChangedHandler = std::function<void(otChangedFlags)>;
+    using ScanHandler         = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
+    using ResultHandler       = std::function<void(otError)>;
 
     /**
      * The constructor of a Thread helper.
@@ -84,6 +87,14 @@ public:
      */
     void AddDeviceRoleHandler(DeviceRoleHandler aHandler);
 
+    /**
+     * This method adds a callback for any state change.
+     *
+     * @param[in]   aHandler  The state changed handler, called with the changed flags.
+     *
+     */
+    void AddStateChangedHandler(StateChangedHandler aHandler);
+
     /**
      * This method permits unsecure join on port.
      *
@@ -125,6 +136,16 @@ public:
                 uint32_t                    aChannelMask,
                 ResultHandler               aHandler);
 
+    /**
+     * This method applies an operational dataset as the active dataset in one call.
+     *
+     * @param[in]   aDataset        The operational dataset.
+     *
+     * @returns The error value of underlying OpenThread api calls.
+     *
+     */
+    otError ApplyActiveDataset(const MeshcopDataset &aDataset);
+
     /**
      * This method resets the OpenThread stack.
      *
@@ -191,7 +212,8 @@ private:
     ScanHandler                     mScanHandler;
     std::vector<otActiveScanResult> mScanResults;
 
-    std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+    std::vector<DeviceRoleHandler>   mDeviceRoleHandlers;
+    std::vector<StateChangedHandler> mStateChangedHandlers;
 
     std::map<uint16_t, std::chrono::steady_clock::time_point> mUnsecurePortCloseTime;
 
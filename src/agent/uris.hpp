@@ -210,6 +210,22 @@ namespace otbr {
  */
 #define OT_URI_PATH_PANID_QUERY "c/pq"
 
+/**
+ * @def OT_URI_PATH_PROXY_RX
+ *
+ * The URI Path for UDP Proxy Receive
+ *
+ */
+#define OT_URI_PATH_PROXY_RX "c/ur"
+
+/**
+ * @def OT_URI_PATH_PROXY_TX
+ *
+ * The URI Path for UDP Proxy Transmit
+ *
+ */
+#define OT_URI_PATH_PROXY_TX "c/ut"
+
 /**
  * @def OT_URI_PATH_COMMISSIONER_GET
  *
@@ -38,16 +38,22 @@
 #include <getopt.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include <arpa/inet.h>
+
+#include "commissioner/channel_survey.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
+#include "utils/pskc_cache.hpp"
+#include "utils/strcpy_utils.hpp"
 
 namespace otbr {
 
 /** Handle the preshared joining credential for the joining device on the command line */
-static bool CheckPSKd(const char *aPSKd)
+bool CheckPSKd(const char *aPSKd)
 {
     const char *whybad = NULL;
     size_t      len    = strlen(aPSKd);
@@ -72,7 +78,7 @@ static bool CheckPSKd(const char *aPSKd)
      * Thus 10 digits + 22 letters = 32 symbols.
      * Thus, "base32" encoding using the above.
      */
-    VerifyOrExit((len >= 6) || (len <= 32), whybad = "Invalid PSKd length (range: 6..32)");
+    VerifyOrExit((len >= 6) && (len <= 32), whybad = "Invalid PSKd length (range: 6..32)");
 
     for (size_t i = 0; i < len; ++i)
     {
@@ -112,12 +118,22 @@ static void PrintUsage(const char *aProgram, FILE *aStream, int aExitCode)
             "    -N, --network-name         STRING      UTF-8 encoded network name\n"
             "    -C, --network-password     STRING      Thread network password\n"
             "    -X, --xpanid               HEX         Extended PAN ID in hex\n"
+            "    -K, --pskc-cache           PATH        Keep computed PSKcs in this file to skip their derivation\n"
             "    -A, --allow-all                        Allow all joiners\n"
             "    -E, --joiner-eui64         HEX         Joiner EUI64 value\n"
             "    -D, --joiner-pskd          STRING      Joiner's base32-thread encoded PSK\n"
+            "    -F, --joiner-csv           PATH        CSV file of joiners, one EUI64,PSKd per line\n"
+            "    -b, --daemon                           Keep running and accept joiners over D-Bus\n"
             "    -L, --steering-data-length NUMBER      Steering data length(1~16)\n"
-            "    -l, --log-file             PATH        Log to file\n"
+            "    -l, --log-file             PATH        Log to file, up to the debug level\n"
+            "    -B, --binary-log-file      PATH        Log to a binary file instead, decoded by log-decode\n"
+            "    -J, --metrics-json         PATH        Write joiner latency metrics as JSON on exit\n"
             "    -i, --keep-alive-interval  NUMBER      COMM_KA requests interval\n"
+            "    -M, --max-joiners          NUMBER      Max joiners commissioned at the same time\n"
+            "    -T, --joiner-timeout       NUMBER      Seconds before dropping a joiner in progress\n"
+            "    -S, --energy-scan          HEX         Energy scan the channels of this mask, bit N for channel N\n"
+            "    -Q, --panid-query          HEX         Query conflicts with this PAN ID on the scanned channels\n"
+            "    -R, --scan-target          ADDR        Router to scan, repeatable, defaults to all routers\n"
             "    -d, --debug-level          NUMBER      Debug level(0~7)\n"
             "    -q, --disable-syslog                   Disable log via syslog\n"
             "    -h, --help                             Print this help\n",
@@ -130,17 +146,27 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
 {
     static struct option options[] = {{"joiner-eui64", required_argument, NULL, 'E'},
                                       {"joiner-pskd", required_argument, NULL, 'D'},
+                                      {"joiner-csv", required_argument, NULL, 'F'},
+                                      {"daemon", no_argument, NULL, 'b'},
                                       {"allow-all", no_argument, NULL, 'A'},
                                       {"network-password", required_argument, NULL, 'C'},
                                       {"network-name", required_argument, NULL, 'N'},
                                       {"xpanid", required_argument, NULL, 'X'},
+                                      {"pskc-cache", required_argument, NULL, 'K'},
                                       {"agent-host", required_argument, NULL, 'H'},
                                       {"agent-port", required_argument, NULL, 'P'},
                                       {"steering-data-length", required_argument, NULL, 'L'},
                                       {"log-file", required_argument, NULL, 'l'},
+                                      {"binary-log-file", required_argument, NULL, 'B'},
+                                      {"metrics-json", required_argument, NULL, 'J'},
                                       {"disable-syslog", no_argument, NULL, 'q'},
                                       {"debug-level", required_argument, NULL, 'd'},
                                       {"keep-alive-interval", required_argument, NULL, 'i'},
+                                      {"max-joiners", required_argument, NULL, 'M'},
+                                      {"joiner-timeout", required_argument, NULL, 'T'},
+                                      {"energy-scan", required_argument, NULL, 'S'},
+                                      {"panid-query", required_argument, NULL, 'Q'},
+                                      {"scan-target", required_argument, NULL, 'R'},
                                       {"help", no_argument, NULL, 'h'},
                                       {0, 0, 0, 0}};
 
@@ -149,6 +175,7 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
     otbrError   error           = OTBR_ERROR_ERRNO;
     const char *networkName     = NULL;
     const char *networkPassword = NULL;
+    const char *pskcCachePath   = NULL;
     int         steeringLength  = 0;
     bool        isXPanIdSet     = false;
     bool        isEui64Set      = false;
@@ -156,8 +183,11 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
 
     memset(&aArgs, 0, sizeof(aArgs));
 
-    aArgs.mKeepAliveInterval = 15;
-    aArgs.mDebugLevel        = OTBR_LOG_ERR;
+    aArgs.mKeepAliveInterval    = 15;
+    aArgs.mDebugLevel           = OTBR_LOG_ERR;
+    aArgs.mMaxJoinerSessions    = kJoinerSessionMaxDefault;
+    aArgs.mJoinerSessionTimeout = kJoinerSessionTimeoutDefault;
+    aArgs.mScanChannelMask      = ChannelSurvey::kDefaultChannels;
 
     if (aArgc == 1)
     {
@@ -166,7 +196,7 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
 
     while (true)
     {
-        int option = getopt_long(aArgc, aArgv, "E:D:AC:N:X:H:P:L:l:qd:i:h", options, NULL);
+        int option = getopt_long(aArgc, aArgv, "E:D:F:bAC:N:X:K:H:P:L:l:B:J:qd:i:M:T:S:Q:R:h", options, NULL);
 
         if (option == -1)
         {
@@ -184,6 +214,16 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
             aArgs.mPSKd = optarg;
             VerifyOrExit(CheckPSKd(aArgs.mPSKd));
             break;
+        case 'F':
+            aArgs.mJoinerCsv = optarg;
+            break;
+        case 'b':
+#if OTBR_ENABLE_DBUS_SERVER
+            aArgs.mDaemon = true;
+#else
+            ExitNow(fprintf(stderr, "Daemon mode requires the D-Bus server!"));
+#endif
+            break;
         case 'A':
             allowAllJoiners = true;
             break;
@@ -208,6 +248,9 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
             VerifyOrExit(sizeof(xPanId) == Utils::Hex2Bytes(optarg, xPanId, sizeof(xPanId)),
                          fprintf(stderr, "Invalid xpanid!"));
             break;
+        case 'K':
+            pskcCachePath = optarg;
+            break;
         case 'H':
             aArgs.mAgentHost = optarg;
             break;
@@ -225,6 +268,12 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
         case 'l':
             otbrLogSetFilename(optarg);
             break;
+        case 'B':
+            otbrLogSetBinaryFilename(optarg);
+            break;
+        case 'J':
+            aArgs.mMetricsJson = optarg;
+            break;
         case 'd':
             aArgs.mDebugLevel = atoi(optarg);
             VerifyOrExit(aArgs.mDebugLevel >= 1 and aArgs.mDebugLevel <= 7,
@@ -234,6 +283,41 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
             aArgs.mKeepAliveInterval = atoi(optarg);
             VerifyOrExit(aArgs.mKeepAliveInterval >= 0, fprintf(stderr, "Invalid value for keep alive interval!"));
             break;
+        case 'M':
+            aArgs.mMaxJoinerSessions = atoi(optarg);
+            VerifyOrExit(aArgs.mMaxJoinerSessions >= 1 && aArgs.mMaxJoinerSessions <= 64,
+                         fprintf(stderr, "Max joiners must be between 1 and 64!"));
+            break;
+        case 'T':
+            aArgs.mJoinerSessionTimeout = atoi(optarg);
+            VerifyOrExit(aArgs.mJoinerSessionTimeout > 0, fprintf(stderr, "Invalid value for joiner timeout!"));
+            break;
+        case 'S':
+        {
+            char *end;
+
+            aArgs.mEnergyScan      = true;
+            aArgs.mScanChannelMask = static_cast<uint32_t>(strtoul(optarg, &end, 16));
+            VerifyOrExit(*end == '\0' && aArgs.mScanChannelMask != 0, fprintf(stderr, "Invalid channel mask!"));
+            break;
+        }
+        case 'Q':
+        {
+            char *        end;
+            unsigned long panId = strtoul(optarg, &end, 16);
+
+            VerifyOrExit(*end == '\0' && panId < 0xffff, fprintf(stderr, "Invalid PAN ID!"));
+            aArgs.mPanIdQuery = true;
+            aArgs.mPanId      = static_cast<uint16_t>(panId);
+            break;
+        }
+        case 'R':
+            VerifyOrExit(aArgs.mNumScanTargets < kMaxScanTargets,
+                         fprintf(stderr, "At most %d scan targets are allowed!", kMaxScanTargets));
+            VerifyOrExit(inet_pton(AF_INET6, optarg, aArgs.mScanTargets[aArgs.mNumScanTargets]) == 1,
+                         fprintf(stderr, "Invalid scan target address!"));
+            aArgs.mNumScanTargets++;
+            break;
         case 'h':
             PrintUsage(aArgv[0], stdout, EXIT_SUCCESS);
             break;
@@ -246,7 +330,9 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
         }
     }
 
-    VerifyOrExit(aArgs.mPSKd != NULL, fprintf(stderr, "Missing joiner PSKd!"));
+    VerifyOrExit(aArgs.mPSKd != NULL || aArgs.mJoinerCsv != NULL || aArgs.mDaemon || aArgs.mEnergyScan ||
+                     aArgs.mPanIdQuery,
+                 fprintf(stderr, "Missing joiner PSKd!"));
     VerifyOrExit(networkName != NULL, fprintf(stderr, "Missing network name!"));
     VerifyOrExit(networkPassword != NULL, fprintf(stderr, "Missing network password!"));
     VerifyOrExit(isXPanIdSet, fprintf(stderr, "Missing extended PAN ID!"));
@@ -258,7 +344,18 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
 
     aArgs.mSteeringData.Init(static_cast<uint8_t>(steeringLength));
 
-    if (!allowAllJoiners)
+    if (aArgs.mJoinerCsv != NULL || aArgs.mDaemon)
+    {
+        // Steering data is built by the commissioner as joiners are added.
+        VerifyOrExit(!allowAllJoiners && !isEui64Set && aArgs.mPSKd == NULL,
+                     fprintf(stderr, "Joiner CSV and daemon mode cannot be used with -A, -E or -D!"));
+    }
+    else if (aArgs.mPSKd == NULL)
+    {
+        // Only surveying channels, no joiner is allowed.
+        VerifyOrExit(!allowAllJoiners && !isEui64Set, fprintf(stderr, "Missing PSKd!"));
+    }
+    else if (!allowAllJoiners)
     {
         VerifyOrExit(aArgs.mPSKd != NULL, fprintf(stderr, "Missing PSKd!"));
         VerifyOrExit(isEui64Set, fprintf(stderr, "Missing EUI64!"));
@@ -271,6 +368,16 @@ otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs)
         aArgs.mSteeringData.Set();
     }
 
+    if (pskcCachePath != NULL)
+    {
+        otbr::Psk::PskcCache pskcCache;
+
+        // A cache that cannot be loaded is only a slower start.
+        pskcCache.Load(pskcCachePath);
+        pskcCache.ComputePskc(xPanId, networkName, networkPassword, aArgs.mPSKc);
+        otbrLog(OTBR_LOG_INFO, "PSKc cache hits %lu misses %lu", pskcCache.GetHitCount(), pskcCache.GetMissCount());
+    }
+    else
     {
         otbr::Psk::Pskc pskc;
 
@@ -288,4 +395,59 @@ exit:
     return error;
 }
 
+otbrError LoadJoinerCsv(const char *aPath, std::vector<JoinerCredential> &aJoiners)
+{
+    otbrError error      = OTBR_ERROR_ERRNO;
+    FILE *    file       = fopen(aPath, "r");
+    int       lineNumber = 0;
+    char      line[128];
+
+    VerifyOrExit(file != NULL, fprintf(stderr, "Failed to open %s: %s\n", aPath, strerror(errno)));
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        JoinerCredential joiner;
+        char *           pskd;
+        char *           end;
+
+        lineNumber++;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (line[0] == '\0' || line[0] == '#')
+        {
+            continue;
+        }
+
+        pskd = strchr(line, ',');
+        VerifyOrExit(pskd != NULL, fprintf(stderr, "%s:%d: missing PSKd\n", aPath, lineNumber), errno = EINVAL);
+        *pskd++ = '\0';
+
+        // Tolerate spaces around fields.
+        pskd += strspn(pskd, " \t");
+        for (end = pskd + strlen(pskd); end > pskd && (end[-1] == ' ' || end[-1] == '\t'); end--)
+        {
+            end[-1] = '\0';
+        }
+
+        VerifyOrExit(sizeof(joiner.mEui64) ==
+                         Utils::Hex2Bytes(line + strspn(line, " \t"), joiner.mEui64, sizeof(joiner.mEui64)),
+                     fprintf(stderr, "%s:%d: invalid EUI64\n", aPath, lineNumber), errno = EINVAL);
+        VerifyOrExit(CheckPSKd(pskd), errno = EINVAL);
+        strcpy_safe(joiner.mPSKd, sizeof(joiner.mPSKd), pskd);
+
+        aJoiners.push_back(joiner);
+    }
+
+    VerifyOrExit(!ferror(file), fprintf(stderr, "Failed to read %s\n", aPath));
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+
+    return error;
+}
+
 } // namespace otbr
@@ -36,6 +36,8 @@
 
 #include "openthread-br/config.h"
 
+#include <vector>
+
 #include <stdint.h>
 
 #include "commissioner/constants.hpp"
@@ -51,15 +53,63 @@ struct CommissionerArgs
 
     const char *mPSKd;
     uint8_t     mPSKc[kPSKcLength];
+    const char *mJoinerCsv;
+    bool        mDaemon;
+    const char *mMetricsJson;
 
     SteeringData mSteeringData;
     int          mKeepAliveInterval;
 
+    int mMaxJoinerSessions;
+    int mJoinerSessionTimeout;
+
+    bool     mEnergyScan;
+    bool     mPanIdQuery;
+    uint32_t mScanChannelMask;
+    uint16_t mPanId;
+    uint8_t  mScanTargets[kMaxScanTargets][OTBR_IP6_ADDRESS_SIZE];
+    int      mNumScanTargets;
+
     int mDebugLevel;
 };
 
+/**
+ * This structure represents the credential of a joiner to provision.
+ *
+ */
+struct JoinerCredential
+{
+    uint8_t mEui64[kEui64Len];
+    char    mPSKd[kPSKdLength + 1];
+};
+
 otbrError ParseArgs(int aArgc, char *aArgv[], CommissionerArgs &aArgs);
 
+/**
+ * This function checks whether a PSKd is a valid joining device credential.
+ *
+ * @param[in]   aPSKd       The PSKd in ASCII.
+ *
+ * @returns Whether @p aPSKd is valid, the reason is printed to stderr if not.
+ *
+ */
+bool CheckPSKd(const char *aPSKd);
+
+/**
+ * This function loads joiner credentials from a CSV file.
+ *
+ * Each line holds the EUI64 in hex and the PSKd of a joiner separated by a comma.
+ * Empty lines and lines starting with '#' are ignored.
+ *
+ * @param[in]   aPath       Path of the CSV file.
+ * @param[out]  aJoiners    A reference to receive the joiner credentials.
+ *
+ * @retval OTBR_ERROR_NONE      Successfully loaded the joiners.
+ * @retval OTBR_ERROR_ERRNO     Failed to read the file, or the file contains an invalid line.
+ *
+ */
+otbrError LoadJoinerCsv(const char *aPath, std::vector<JoinerCredential> &aJoiners);
+
 } // namespace otbr
 
 #endif // OTBR_COMMISSIONER_ARGUMENTS_HPP_
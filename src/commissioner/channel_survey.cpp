@@ -0,0 +1,425 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements aggregating energy scan and PAN ID conflict reports.
+ */
+
+#include "commissioner/channel_survey.hpp"
+
+#include <errno.h>
+#include <string.h>
+
+#include <arpa/inet.h>
+
+#include "common/code_utils.hpp"
+#include "common/tlv.hpp"
+#include "utils/meshcop_dataset.hpp"
+
+namespace otbr {
+
+static int CountChannels(uint32_t aChannelMask)
+{
+    int count = 0;
+
+    for (; aChannelMask != 0; aChannelMask &= aChannelMask - 1)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * This function extracts the Channel Mask, Energy List and PAN ID TLVs of a report.
+ *
+ */
+static otbrError ParseReport(const uint8_t * aTlvs,
+                             uint16_t        aLength,
+                             uint32_t &      aChannelMask,
+                             const uint8_t *&aEnergyList,
+                             uint16_t &      aEnergyListLength,
+                             uint16_t &      aPanId)
+{
+    otbrError      error = OTBR_ERROR_ERRNO;
+    const uint8_t *end   = aTlvs + aLength;
+    const Tlv *    tlv   = reinterpret_cast<const Tlv *>(aTlvs);
+
+    aChannelMask      = 0;
+    aEnergyList       = NULL;
+    aEnergyListLength = 0;
+    aPanId            = 0;
+
+    while (reinterpret_cast<const uint8_t *>(tlv) < end)
+    {
+        const uint8_t *value;
+        uint16_t       length;
+
+        VerifyOrExit(reinterpret_cast<const uint8_t *>(tlv) + 2 <= end, errno = EINVAL);
+        value = static_cast<const uint8_t *>(tlv->GetValue());
+        VerifyOrExit(value <= end, errno = EINVAL);
+        length = tlv->GetLength();
+        VerifyOrExit(length <= end - value, errno = EINVAL);
+
+        switch (tlv->GetType())
+        {
+        case Meshcop::kChannelMask:
+            for (const uint8_t *entry = value; entry + 2 <= value + length; entry += 2 + entry[1])
+            {
+                uint32_t channelMask;
+
+                VerifyOrExit(entry + 2 + entry[1] <= value + length, errno = EINVAL);
+
+                if (MeshcopDataset::ReadChannelMask(entry, channelMask))
+                {
+                    aChannelMask |= channelMask;
+                }
+            }
+            break;
+
+        case Meshcop::kEnergyList:
+            aEnergyList       = value;
+            aEnergyListLength = length;
+            break;
+
+        case Meshcop::kPanId:
+            VerifyOrExit(length >= sizeof(uint16_t), errno = EINVAL);
+            aPanId = tlv->GetValueUInt16();
+            break;
+
+        default:
+            break;
+        }
+
+        tlv = tlv->GetNext();
+    }
+
+    VerifyOrExit(aChannelMask != 0, errno = EINVAL);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+uint16_t ChannelSurvey::EncodeEnergyScanQuery(uint8_t *aBuffer,
+                                              uint16_t aSessionId,
+                                              uint32_t aChannelMask,
+                                              uint8_t  aCount,
+                                              uint16_t aPeriod,
+                                              uint16_t aScanDuration)
+{
+    Tlv *   tlv = reinterpret_cast<Tlv *>(aBuffer);
+    uint8_t channelMask[MeshcopDataset::kSizeChannelMask];
+
+    tlv->SetType(Meshcop::kCommissionerSessionId);
+    tlv->SetValue(aSessionId);
+    tlv = tlv->GetNext();
+
+    MeshcopDataset::WriteChannelMask(aChannelMask, channelMask);
+    tlv->SetType(Meshcop::kChannelMask);
+    tlv->SetValue(channelMask, sizeof(channelMask));
+    tlv = tlv->GetNext();
+
+    tlv->SetType(Meshcop::kCount);
+    tlv->SetValue(aCount);
+    tlv = tlv->GetNext();
+
+    tlv->SetType(Meshcop::kPeriod);
+    tlv->SetValue(aPeriod);
+    tlv = tlv->GetNext();
+
+    tlv->SetType(Meshcop::kScanDuration);
+    tlv->SetValue(aScanDuration);
+    tlv = tlv->GetNext();
+
+    return static_cast<uint16_t>(reinterpret_cast<uint8_t *>(tlv) - aBuffer);
+}
+
+uint16_t ChannelSurvey::EncodePanIdQuery(uint8_t *aBuffer, uint16_t aSessionId, uint32_t aChannelMask, uint16_t aPanId)
+{
+    Tlv *   tlv = reinterpret_cast<Tlv *>(aBuffer);
+    uint8_t channelMask[MeshcopDataset::kSizeChannelMask];
+
+    tlv->SetType(Meshcop::kCommissionerSessionId);
+    tlv->SetValue(aSessionId);
+    tlv = tlv->GetNext();
+
+    MeshcopDataset::WriteChannelMask(aChannelMask, channelMask);
+    tlv->SetType(Meshcop::kChannelMask);
+    tlv->SetValue(channelMask, sizeof(channelMask));
+    tlv = tlv->GetNext();
+
+    tlv->SetType(Meshcop::kPanId);
+    tlv->SetValue(aPanId);
+    tlv = tlv->GetNext();
+
+    return static_cast<uint16_t>(reinterpret_cast<uint8_t *>(tlv) - aBuffer);
+}
+
+ChannelSurvey::Reporter *ChannelSurvey::FindOrAddReporter(const uint8_t *aSource)
+{
+    Reporter *reporter = NULL;
+
+    for (std::vector<Reporter>::iterator it = mReporters.begin(); it != mReporters.end(); ++it)
+    {
+        if (!memcmp(it->mAddress, aSource, sizeof(it->mAddress)))
+        {
+            ExitNow(reporter = &*it);
+        }
+    }
+
+    VerifyOrExit(mReporters.size() < kMaxReporters, errno = ENOSPC);
+
+    mReporters.resize(mReporters.size() + 1);
+    reporter = &mReporters.back();
+    memcpy(reporter->mAddress, aSource, sizeof(reporter->mAddress));
+    reporter->mScannedMask  = 0;
+    reporter->mConflictMask = 0;
+    memset(reporter->mMaxRssi, kRssiInvalid, sizeof(reporter->mMaxRssi));
+
+exit:
+    return reporter;
+}
+
+otbrError ChannelSurvey::HandleEnergyReport(const uint8_t *aSource, const uint8_t *aTlvs, uint16_t aLength)
+{
+    otbrError      error;
+    uint32_t       channelMask;
+    const uint8_t *energyList;
+    uint16_t       energyListLength;
+    uint16_t       panId;
+    int            numChannels;
+    int            count;
+    Reporter *     reporter;
+
+    SuccessOrExit(error = ParseReport(aTlvs, aLength, channelMask, energyList, energyListLength, panId));
+
+    // The energy list holds the measurements of each channel in turn, in ascending order of channels.
+    error       = OTBR_ERROR_ERRNO;
+    numChannels = CountChannels(channelMask);
+    VerifyOrExit(energyList != NULL && energyListLength > 0 && energyListLength % numChannels == 0, errno = EINVAL);
+    count = energyListLength / numChannels;
+
+    VerifyOrExit((reporter = FindOrAddReporter(aSource)) != NULL);
+
+    for (int channel = 0; channel < kNumChannels; channel++)
+    {
+        if (!(channelMask & (1U << channel)))
+        {
+            continue;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            int8_t rssi = static_cast<int8_t>(*energyList++);
+
+            if (reporter->mMaxRssi[channel] == kRssiInvalid || rssi > reporter->mMaxRssi[channel])
+            {
+                reporter->mMaxRssi[channel] = rssi;
+            }
+        }
+    }
+
+    reporter->mScannedMask |= channelMask;
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError ChannelSurvey::HandlePanIdConflict(const uint8_t *aSource, const uint8_t *aTlvs, uint16_t aLength)
+{
+    otbrError      error;
+    uint32_t       channelMask;
+    const uint8_t *energyList;
+    uint16_t       energyListLength;
+    uint16_t       panId;
+    Reporter *     reporter;
+
+    SuccessOrExit(error = ParseReport(aTlvs, aLength, channelMask, energyList, energyListLength, panId));
+
+    error = OTBR_ERROR_ERRNO;
+    VerifyOrExit((reporter = FindOrAddReporter(aSource)) != NULL);
+
+    reporter->mConflictMask |= channelMask;
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+ChannelSurvey::ChannelSummary ChannelSurvey::GetChannelSummary(uint8_t aChannel) const
+{
+    ChannelSummary summary;
+    int            sum = 0;
+
+    summary.mNumReporters = 0;
+    summary.mNumConflicts = 0;
+    summary.mMaxRssi      = kRssiInvalid;
+    summary.mMeanRssi     = kRssiInvalid;
+
+    VerifyOrExit(aChannel < kNumChannels);
+
+    for (std::vector<Reporter>::const_iterator it = mReporters.begin(); it != mReporters.end(); ++it)
+    {
+        if (it->mConflictMask & (1U << aChannel))
+        {
+            summary.mNumConflicts++;
+        }
+
+        if (it->mScannedMask & (1U << aChannel))
+        {
+            int8_t rssi = it->mMaxRssi[aChannel];
+
+            if (summary.mMaxRssi == kRssiInvalid || rssi > summary.mMaxRssi)
+            {
+                summary.mMaxRssi = rssi;
+            }
+
+            sum += rssi;
+            summary.mNumReporters++;
+        }
+    }
+
+    if (summary.mNumReporters > 0)
+    {
+        summary.mMeanRssi = static_cast<int8_t>(sum / static_cast<int>(summary.mNumReporters));
+    }
+
+exit:
+    return summary;
+}
+
+int ChannelSurvey::GetQuietestChannel(uint32_t aCandidates) const
+{
+    int    quietest = -1;
+    int8_t lowest   = kRssiInvalid;
+
+    for (uint8_t channel = 0; channel < kNumChannels; channel++)
+    {
+        ChannelSummary summary;
+
+        if (!(aCandidates & (1U << channel)))
+        {
+            continue;
+        }
+
+        summary = GetChannelSummary(channel);
+
+        if (summary.mNumReporters > 0 && summary.mNumConflicts == 0 &&
+            (quietest == -1 || summary.mMaxRssi < lowest))
+        {
+            quietest = channel;
+            lowest   = summary.mMaxRssi;
+        }
+    }
+
+    return quietest;
+}
+
+void ChannelSurvey::WriteReport(FILE *aStream) const
+{
+    uint32_t channelMask = 0;
+    int      quietest;
+
+    for (std::vector<Reporter>::const_iterator it = mReporters.begin(); it != mReporters.end(); ++it)
+    {
+        channelMask |= it->mScannedMask | it->mConflictMask;
+    }
+
+    fprintf(aStream, "channel survey: %zu routers\n", mReporters.size());
+    VerifyOrExit(channelMask != 0);
+
+    // Cells are the max energy in dBm, '*' marks a PAN ID conflict and '-' a channel not measured.
+    fprintf(aStream, "%-39s", "router");
+    for (int channel = 0; channel < kNumChannels; channel++)
+    {
+        if (channelMask & (1U << channel))
+        {
+            fprintf(aStream, " %5d", channel);
+        }
+    }
+    fprintf(aStream, "\n");
+
+    for (std::vector<Reporter>::const_iterator it = mReporters.begin(); it != mReporters.end(); ++it)
+    {
+        char address[INET6_ADDRSTRLEN];
+
+        inet_ntop(AF_INET6, it->mAddress, address, sizeof(address));
+        fprintf(aStream, "%-39s", address);
+
+        for (int channel = 0; channel < kNumChannels; channel++)
+        {
+            if (!(channelMask & (1U << channel)))
+            {
+                continue;
+            }
+
+            if (it->mScannedMask & (1U << channel))
+            {
+                fprintf(aStream, " %4d%c", it->mMaxRssi[channel], (it->mConflictMask & (1U << channel)) ? '*' : ' ');
+            }
+            else
+            {
+                fprintf(aStream, " %4s%c", "-", (it->mConflictMask & (1U << channel)) ? '*' : ' ');
+            }
+        }
+        fprintf(aStream, "\n");
+    }
+
+    fprintf(aStream, "%-39s", "max");
+    for (uint8_t channel = 0; channel < kNumChannels; channel++)
+    {
+        if (channelMask & (1U << channel))
+        {
+            ChannelSummary summary = GetChannelSummary(channel);
+
+            if (summary.mNumReporters > 0)
+            {
+                fprintf(aStream, " %4d%c", summary.mMaxRssi, summary.mNumConflicts > 0 ? '*' : ' ');
+            }
+            else
+            {
+                fprintf(aStream, " %4s%c", "-", summary.mNumConflicts > 0 ? '*' : ' ');
+            }
+        }
+    }
+    fprintf(aStream, "\n");
+
+    quietest = GetQuietestChannel(channelMask);
+    if (quietest >= 0)
+    {
+        fprintf(aStream, "quietest channel: %d\n", quietest);
+    }
+
+exit:
+    return;
+}
+
+} // namespace otbr
@@ -0,0 +1,202 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file is the header for aggregating energy scan and PAN ID conflict reports.
+ */
+
+#ifndef OTBR_COMMISSIONER_CHANNEL_SURVEY_HPP_
+#define OTBR_COMMISSIONER_CHANNEL_SURVEY_HPP_
+
+#include "openthread-br/config.h"
+
+#include <vector>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class aggregates MGMT_ED_REPORT and MGMT_PANID_CONFLICT answers of many routers into a per-channel energy
+ * matrix.
+ *
+ */
+class ChannelSurvey
+{
+public:
+    enum
+    {
+        kNumChannels     = 32,         ///< Number of channels of page 0 in a channel mask.
+        kMaxReporters    = 64,         ///< Max number of routers recorded.
+        kRssiInvalid     = 127,        ///< RSSI of a channel without measurement.
+        kMaxQuerySize    = 32,         ///< Max size of the TLVs of a query.
+        kDefaultChannels = 0x07fff800, ///< Channel 11 to 26.
+    };
+
+    /**
+     * This structure represents the reports of one router.
+     *
+     */
+    struct Reporter
+    {
+        uint8_t  mAddress[OTBR_IP6_ADDRESS_SIZE]; ///< Address of the router.
+        uint32_t mScannedMask;                   ///< Channels with energy measurements.
+        uint32_t mConflictMask;                  ///< Channels on which a PAN ID conflict was reported.
+        int8_t   mMaxRssi[kNumChannels];         ///< Max measured energy of each channel in dBm.
+    };
+
+    /**
+     * This structure represents the energy of one channel over all routers.
+     *
+     */
+    struct ChannelSummary
+    {
+        uint16_t mNumReporters; ///< Number of routers that measured this channel.
+        uint16_t mNumConflicts; ///< Number of routers that reported a PAN ID conflict on this channel.
+        int8_t   mMaxRssi;      ///< Max energy in dBm, kRssiInvalid if not measured.
+        int8_t   mMeanRssi;     ///< Mean of the max energy of each router in dBm, kRssiInvalid if not measured.
+    };
+
+    /**
+     * This method encodes the TLVs of a MGMT_ED_SCAN.qry.
+     *
+     * @param[out]  aBuffer         A pointer to a buffer of at least kMaxQuerySize bytes.
+     * @param[in]   aSessionId      The commissioner session id.
+     * @param[in]   aChannelMask    The channels to scan, bit N stands for channel N.
+     * @param[in]   aCount          Number of measurements per channel.
+     * @param[in]   aPeriod         Milliseconds between measurements.
+     * @param[in]   aScanDuration   Milliseconds of each measurement.
+     *
+     * @returns Length of the TLVs in bytes.
+     *
+     */
+    static uint16_t EncodeEnergyScanQuery(uint8_t *aBuffer,
+                                          uint16_t aSessionId,
+                                          uint32_t aChannelMask,
+                                          uint8_t  aCount,
+                                          uint16_t aPeriod,
+                                          uint16_t aScanDuration);
+
+    /**
+     * This method encodes the TLVs of a MGMT_PANID_QUERY.qry.
+     *
+     * @param[out]  aBuffer         A pointer to a buffer of at least kMaxQuerySize bytes.
+     * @param[in]   aSessionId      The commissioner session id.
+     * @param[in]   aChannelMask    The channels to query, bit N stands for channel N.
+     * @param[in]   aPanId          The PAN ID to look for.
+     *
+     * @returns Length of the TLVs in bytes.
+     *
+     */
+    static uint16_t EncodePanIdQuery(uint8_t *aBuffer, uint16_t aSessionId, uint32_t aChannelMask, uint16_t aPanId);
+
+    /**
+     * This method records the TLVs of a MGMT_ED_REPORT.ans.
+     *
+     * @param[in]   aSource     A pointer to the address of the reporting router.
+     * @param[in]   aTlvs       A pointer to the TLVs.
+     * @param[in]   aLength     Length of the TLVs in bytes.
+     *
+     * @retval OTBR_ERROR_NONE      Successfully recorded the report.
+     * @retval OTBR_ERROR_ERRNO     The report is malformed or there are too many routers.
+     *
+     */
+    otbrError HandleEnergyReport(const uint8_t *aSource, const uint8_t *aTlvs, uint16_t aLength);
+
+    /**
+     * This method records the TLVs of a MGMT_PANID_CONFLICT.ans.
+     *
+     * @param[in]   aSource     A pointer to the address of the reporting router.
+     * @param[in]   aTlvs       A pointer to the TLVs.
+     * @param[in]   aLength     Length of the TLVs in bytes.
+     *
+     * @retval OTBR_ERROR_NONE      Successfully recorded the report.
+     * @retval OTBR_ERROR_ERRNO     The report is malformed or there are too many routers.
+     *
+     */
+    otbrError HandlePanIdConflict(const uint8_t *aSource, const uint8_t *aTlvs, uint16_t aLength);
+
+    /**
+     * This method removes all reports.
+     *
+     */
+    void Clear(void) { mReporters.clear(); }
+
+    /**
+     * This method returns the number of routers that reported.
+     *
+     */
+    size_t GetNumReporters(void) const { return mReporters.size(); }
+
+    /**
+     * This method returns the reports of a router.
+     *
+     * @param[in]   aIndex      The index of the router, less than GetNumReporters().
+     *
+     */
+    const Reporter &GetReporter(size_t aIndex) const { return mReporters[aIndex]; }
+
+    /**
+     * This method returns the energy of a channel over all routers.
+     *
+     * @param[in]   aChannel    The channel.
+     *
+     */
+    ChannelSummary GetChannelSummary(uint8_t aChannel) const;
+
+    /**
+     * This method returns the channel with the lowest max energy and no PAN ID conflict.
+     *
+     * @param[in]   aCandidates     The channels to choose from, bit N stands for channel N.
+     *
+     * @returns The quietest channel, or -1 if none of @p aCandidates was measured.
+     *
+     */
+    int GetQuietestChannel(uint32_t aCandidates = kDefaultChannels) const;
+
+    /**
+     * This method writes the energy matrix, one router per row and one channel per column.
+     *
+     * @param[in]   aStream     The stream to write to.
+     *
+     */
+    void WriteReport(FILE *aStream) const;
+
+private:
+    Reporter *FindOrAddReporter(const uint8_t *aSource);
+
+    std::vector<Reporter> mReporters;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMISSIONER_CHANNEL_SURVEY_HPP_
@@ -35,15 +35,14 @@
 
 #include <vector>
 
-#include <assert.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "agent/uris.hpp"
-#include "commissioner/addr_utils.hpp"
 #include "commissioner/utils.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "common/tlv.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
@@ -51,7 +50,6 @@
 
 namespace otbr {
 
-const uint16_t Commissioner::kPortJoinerSession      = 49192;
 const uint8_t  Commissioner::kSeed[]                 = "Commissioner";
 const int      Commissioner::kCipherSuites[]         = {MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8, 0};
 const char     Commissioner::kCommissionerId[]       = "OpenThread";
@@ -100,38 +98,214 @@ static int DummyKeyExport(void *               aContext,
     return 0;
 }
 
-Commissioner::Commissioner(const uint8_t *aPskcBin, int aKeepAliveRate)
+Commissioner::Commissioner(const uint8_t *aPskcBin,
+                           int            aKeepAliveRate,
+                           int            aMaxJoinerSessions,
+                           int            aJoinerSessionTimeout)
     : mDtlsInitDone(false)
+    , mIsTimerSet(false)
+    , mCoapAgent(Coap::Agent::Create(SendCoap, this))
+    , mManagementClient(*mCoapAgent, ManagementClient::kDefaultMaxInFlight, kCoapResponseWaitSecond * 1000UL)
     , mRelayReceiveHandler(OT_URI_PATH_RELAY_RX, Commissioner::HandleRelayReceive, this)
+    , mProxyReceiveHandler(OT_URI_PATH_PROXY_RX, Commissioner::HandleProxyReceive, this)
+    , mMeshAgent(Coap::Agent::Create(SendMeshCoap, this))
+    , mEnergyReportHandler(OT_URI_PATH_ENERGY_REPORT, Commissioner::HandleEnergyReport, this)
+    , mPanIdConflictHandler(OT_URI_PATH_PANID_CONFLICT, Commissioner::HandlePanIdConflict, this)
+    , mConnectRetryCount(0)
     , mPetitionRetryCount(0)
-    , mJoinerSession(NULL)
+    , mReconnectCount(0)
+    , mIsRetryPending(false)
+    , mRetryTime(0)
+    , mStartTime(0)
+    , mTimeToActive(0)
+    , mJoinerSessions(Commissioner::HandleRelayTransmit, this, aMaxJoinerSessions, aJoinerSessionTimeout)
+    , mJoinerStateHandler(NULL)
+    , mJoinerStateContext(NULL)
+    , mIsSteeringDataDirty(false)
     , mKeepAliveRate(aKeepAliveRate)
-    , mNumFinializeJoiners(0)
 {
-    sockaddr_in addr;
-
     memcpy(mPskcBin, aPskcBin, sizeof(mPskcBin));
-    addr.sin_family      = AF_INET;
-    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
-    addr.sin_port        = htons(kPortJoinerSession);
-    mCoapAgent           = Coap::Agent::Create(SendCoap, this);
-    mCoapToken           = static_cast<uint16_t>(rand());
+    mCoapToken = static_cast<uint16_t>(rand());
     mCoapAgent->AddResource(mRelayReceiveHandler);
+    mCoapAgent->AddResource(mProxyReceiveHandler);
+    mMeshAgent->AddResource(mEnergyReportHandler);
+    mMeshAgent->AddResource(mPanIdConflictHandler);
     mCommissionerState = CommissionerState::kStateInvalid;
-    VerifyOrExit((mJoinerSessionClientFd = socket(AF_INET, SOCK_DGRAM, 0)) > 0);
-    SuccessOrExit(connect(mJoinerSessionClientFd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)));
+    mSteeringData.Init(SteeringData::kMaxSizeOfBloomFilter);
+    mJoinerSessions.SetJoinerStateHandler(Commissioner::HandleJoinerState, this);
+}
+
+void Commissioner::SetJoiner(const char *aPskdAscii, const SteeringData &aSteeringData)
+{
+    mJoinerSessions.SetPskd(aPskdAscii);
+    CommissionerSet(aSteeringData);
+}
+
+otbrError Commissioner::AddJoiner(const uint8_t *aEui64, const char *aPskdAscii)
+{
+    otbrError    error = OTBR_ERROR_ERRNO;
+    JoinerRecord record;
+    uint64_t     key;
+
+    memcpy(record.mEui64, aEui64, sizeof(record.mEui64));
+    SteeringData::ComputeJoinerId(aEui64, record.mJoinerId);
+    record.mState      = kJoinerStatePending;
+    record.mStartTime  = 0;
+    record.mFinishTime = 0;
+
+    key = JoinerSessionManager::GetJoinerKey(record.mJoinerId);
+    VerifyOrExit(mJoinerRecords.find(key) == mJoinerRecords.end(), errno = EEXIST);
+
+    mJoinerRecords[key] = record;
+    mJoinerSessions.AddJoiner(record.mJoinerId, aPskdAscii);
+    mSteeringData.AddJoiner(record.mJoinerId);
+    mIsSteeringDataDirty = true;
+    error                = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError Commissioner::RemoveJoiner(const uint8_t *aEui64)
+{
+    otbrError                 error = OTBR_ERROR_ERRNO;
+    uint8_t                   joinerId[SteeringData::kSizeJoinerId];
+    JoinerRecordMap::iterator it;
+
+    SteeringData::ComputeJoinerId(aEui64, joinerId);
+    it = mJoinerRecords.find(JoinerSessionManager::GetJoinerKey(joinerId));
+    VerifyOrExit(it != mJoinerRecords.end(), errno = ENOENT);
+
+    // Finalized joiners have already been removed from the steering data.
+    if (it->second.mState != kJoinerStateFinalized)
+    {
+        mJoinerSessions.RemoveJoiner(joinerId);
+        mSteeringData.RemoveJoiner(joinerId);
+        mIsSteeringDataDirty = true;
+    }
+
+    mJoinerRecords.erase(it);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+void Commissioner::HandleJoinerState(const uint8_t *aJoinerId, JoinerState aState, void *aContext)
+{
+    static_cast<Commissioner *>(aContext)->HandleJoinerState(aJoinerId, aState);
+}
+
+void Commissioner::HandleJoinerState(const uint8_t *aJoinerId, JoinerState aState)
+{
+    JoinerRecordMap::iterator it = mJoinerRecords.find(JoinerSessionManager::GetJoinerKey(aJoinerId));
+
+    // Joiners accepted with the shared pskd are not tracked.
+    VerifyOrExit(it != mJoinerRecords.end());
+    VerifyOrExit(it->second.mState != kJoinerStateFinalized);
+
+    switch (aState)
+    {
+    case kJoinerStateJoining:
+        it->second.mStartTime = GetNow();
+        break;
+
+    case kJoinerStateFinalized:
+        it->second.mFinishTime = GetNow();
+        mJoinerSessions.RemoveJoiner(aJoinerId);
+        mSteeringData.RemoveJoiner(aJoinerId);
+        mIsSteeringDataDirty = true;
+        break;
+
+    default:
+        break;
+    }
+
+    it->second.mState = aState;
+
+    if (mJoinerStateHandler != NULL)
+    {
+        mJoinerStateHandler(it->second.mEui64, aState, mJoinerStateContext);
+    }
+
 exit:
     return;
 }
 
-void Commissioner::SetJoiner(const char *aPskdAscii, const SteeringData &aSteeringData)
+void Commissioner::SetJoinerStateHandler(JoinerStateHandler aHandler, void *aContext)
+{
+    mJoinerStateHandler = aHandler;
+    mJoinerStateContext = aContext;
+}
+
+const char *Commissioner::GetStateName(void) const
 {
-    if (mJoinerSession)
+    const char *name = "invalid";
+
+    switch (mCommissionerState)
     {
-        delete mJoinerSession;
+    case CommissionerState::kStateInvalid:
+        break;
+    case CommissionerState::kStateConnecting:
+        name = "connecting";
+        break;
+    case CommissionerState::kStateConnected:
+        name = "connected";
+        break;
+    case CommissionerState::kStateAccepted:
+        name = "accepted";
+        break;
+    case CommissionerState::kStateRejected:
+        name = "rejected";
+        break;
+    }
+
+    return name;
+}
+
+int Commissioner::GetNumJoiners(JoinerState aState) const
+{
+    int count = 0;
+
+    for (JoinerRecordMap::const_iterator it = mJoinerRecords.begin(); it != mJoinerRecords.end(); ++it)
+    {
+        if (it->second.mState == aState)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void Commissioner::WriteJoinerSummary(FILE *aStream) const
+{
+    unsigned long totalTime    = 0;
+    int           numFinalized = GetNumJoiners(kJoinerStateFinalized);
+
+    fprintf(aStream, "joiners: %zu total, %d finalized, %d failed, %d joining, %d pending\n", mJoinerRecords.size(),
+            numFinalized, GetNumJoiners(kJoinerStateFailed), GetNumJoiners(kJoinerStateJoining),
+            GetNumJoiners(kJoinerStatePending));
+
+    for (JoinerRecordMap::const_iterator it = mJoinerRecords.begin(); it != mJoinerRecords.end(); ++it)
+    {
+        const JoinerRecord &record = it->second;
+        char                eui64[kEui64Len * 2 + 1];
+
+        if (record.mState == kJoinerStateFinalized)
+        {
+            totalTime += record.mFinishTime - record.mStartTime;
+            continue;
+        }
+
+        Utils::Bytes2Hex(record.mEui64, sizeof(record.mEui64), eui64);
+        fprintf(aStream, "    %s %s\n", eui64, JoinerStateToString(record.mState));
+    }
+
+    if (numFinalized > 0)
+    {
+        fprintf(aStream, "average time to finalize: %lu ms\n", totalTime / static_cast<unsigned long>(numFinalized));
     }
-    mJoinerSession = new JoinerSession(kPortJoinerSession, aPskdAscii);
-    CommissionerSet(aSteeringData);
 }
 
 ssize_t Commissioner::SendCoap(const uint8_t *aBuffer,
@@ -150,22 +324,36 @@ ssize_t Commissioner::SendCoap(const uint8_t *aBuffer,
 
 int Commissioner::InitDtls(const char *aHost, const char *aPort)
 {
-    int  ret;
-    char addressAscii[kIPAddrNameBufSize];
-    char portAscii[kPortNameBufSize];
+    int ret = 0;
 
     mbedtls_debug_set_threshold(kMBedDebugDefaultThreshold);
 
-    strcpy(addressAscii, aHost);
-    strcpy(portAscii, aPort);
+    // The host and port are kept for reconnecting.
+    VerifyOrExit(strcpy_safe(mAgentHost, sizeof(mAgentHost), aHost) == 0, ret = MBEDTLS_ERR_SSL_BAD_INPUT_DATA,
+                 otbrLog(OTBR_LOG_ERR, "agent host too long: %s", aHost));
+    VerifyOrExit(strcpy_safe(mAgentPort, sizeof(mAgentPort), aPort) == 0, ret = MBEDTLS_ERR_SSL_BAD_INPUT_DATA,
+                 otbrLog(OTBR_LOG_ERR, "agent port too long: %s", aPort));
+
+    ret = SetupDtls();
+
+exit:
+    return ret;
+}
+
+int Commissioner::SetupDtls(void)
+{
+    int ret;
+
     mbedtls_net_init(&mSslClientFd);
     mbedtls_ssl_init(&mSsl);
     mbedtls_ssl_config_init(&mSslConf);
     mbedtls_ctr_drbg_init(&mDrbg);
     mbedtls_entropy_init(&mEntropy);
     mDtlsInitDone = true;
+    mStartTime    = GetNow();
     SuccessOrExit(ret = mbedtls_ctr_drbg_seed(&mDrbg, mbedtls_entropy_func, &mEntropy, kSeed, sizeof(kSeed)));
-    SuccessOrExit(ret = mbedtls_net_connect(&mSslClientFd, addressAscii, portAscii, MBEDTLS_NET_PROTO_UDP));
+    SuccessOrExit(ret = mbedtls_net_connect(&mSslClientFd, mAgentHost, mAgentPort, MBEDTLS_NET_PROTO_UDP));
+    SuccessOrExit(ret = mbedtls_net_set_nonblock(&mSslClientFd));
     SuccessOrExit(ret = mbedtls_ssl_config_defaults(&mSslConf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_DATAGRAM,
                                                     MBEDTLS_SSL_PRESET_DEFAULT));
     mbedtls_ssl_conf_rng(&mSslConf, mbedtls_ctr_drbg_random, &mDrbg);
@@ -179,56 +367,200 @@ int Commissioner::InitDtls(const char *aHost, const char *aPort)
 
     otbrLog(OTBR_LOG_INFO, "connecting: ssl-setup");
     SuccessOrExit(ret = mbedtls_ssl_setup(&mSsl, &mSslConf));
-    mbedtls_ssl_set_bio(&mSsl, &mSslClientFd, mbedtls_net_send, mbedtls_net_recv, mbedtls_net_recv_timeout);
-    mbedtls_ssl_set_timer_cb(&mSsl, &mTimer, mbedtls_timing_set_delay, mbedtls_timing_get_delay);
+    mbedtls_ssl_set_bio(&mSsl, &mSslClientFd, mbedtls_net_send, mbedtls_net_recv, NULL);
+    mbedtls_ssl_set_timer_cb(&mSsl, this, SetDelay, GetDelay);
+
+    SuccessOrExit(ret = mbedtls_ssl_set_hs_ecjpake_password(&mSsl, mPskcBin, OT_PSKC_LENGTH));
 
-    mbedtls_ssl_set_hs_ecjpake_password(&mSsl, mPskcBin, OT_PSKC_LENGTH);
+    mCommissionerState = CommissionerState::kStateConnecting;
+    DtlsHandshake();
 
 exit:
     return ret;
 }
 
-int Commissioner::TryDtlsHandshake(void)
+void Commissioner::SetDelay(void *aContext, uint32_t aIntermediate, uint32_t aFinal)
+{
+    static_cast<Commissioner *>(aContext)->SetDelay(aIntermediate, aFinal);
+}
+
+void Commissioner::SetDelay(uint32_t aIntermediate, uint32_t aFinal)
+{
+    unsigned long now = GetNow();
+
+    if (aFinal != 0)
+    {
+        mTimerIntermediate = now + aIntermediate;
+        mTimerFinal        = now + aFinal;
+        mIsTimerSet        = true;
+    }
+    else
+    {
+        mIsTimerSet = false;
+    }
+}
+
+int Commissioner::GetDelay(void *aContext)
+{
+    return static_cast<Commissioner *>(aContext)->GetDelay();
+}
+
+int Commissioner::GetDelay(void) const
+{
+    int           ret = 0;
+    unsigned long now = GetNow();
+
+    if (mIsTimerSet)
+    {
+        if (static_cast<long>(mTimerIntermediate - now) <= 0)
+        {
+            ret = 1;
+        }
+
+        if (static_cast<long>(mTimerFinal - now) <= 0)
+        {
+            ret = 2;
+        }
+    }
+    else
+    {
+        ret = -1;
+    }
+
+    return ret;
+}
+
+void Commissioner::DtlsHandshake(void)
 {
     int ret = mbedtls_ssl_handshake(&mSsl);
+
     if (ret == 0)
     {
+        otbrLog(OTBR_LOG_INFO, "DTLS handshake done in %lu ms", GetNow() - mStartTime);
         mCommissionerState = CommissionerState::kStateConnected;
+        mConnectRetryCount = 0;
+        CommissionerPetition();
     }
     else if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE)
     {
+        otbrLog(OTBR_LOG_WARNING, "DTLS handshake failed: -0x%04x", -ret);
+        mbedtls_ssl_session_reset(&mSsl);
+        ScheduleRetry(mConnectRetryCount, kConnectMaxRetry);
+    }
+}
+
+unsigned long Commissioner::GetRetryDelay(int aRetryCount)
+{
+    unsigned long delay = kPetitionAttemptDelay * 1000UL;
+
+    for (int i = 0; i < aRetryCount && delay < kPetitionAttemptDelayMax * 1000UL; i++)
+    {
+        delay *= 2;
+    }
+
+    delay = Utils::Min(delay, kPetitionAttemptDelayMax * 1000UL);
+
+    // Half of the delay is randomized so that commissioners rejected together do not retry together.
+    return delay / 2 + static_cast<unsigned long>(rand()) % (delay / 2 + 1);
+}
+
+void Commissioner::ScheduleRetry(int &aRetryCount, int aMaxRetry)
+{
+    if (aRetryCount < aMaxRetry)
+    {
+        unsigned long delay = GetRetryDelay(aRetryCount);
+
+        aRetryCount++;
+        mIsRetryPending = true;
+        mRetryTime      = GetNow() + delay;
+        otbrLog(OTBR_LOG_INFO, "retry %d/%d in %lu ms", aRetryCount, aMaxRetry, delay);
+    }
+    else
+    {
+        otbrLog(OTBR_LOG_ERR, "giving up after %d retries", aMaxRetry);
         mCommissionerState = CommissionerState::kStateInvalid;
+        aRetryCount        = 0;
     }
-    return ret;
+}
+
+void Commissioner::Cancel(void)
+{
+    if (mIsRetryPending)
+    {
+        otbrLog(OTBR_LOG_INFO, "pending retry cancelled");
+        mIsRetryPending = false;
+    }
+
+    Resign();
+    mCommissionerState = CommissionerState::kStateInvalid;
+}
+
+void Commissioner::Reconnect(void)
+{
+    unsigned long delay;
+
+    VerifyOrExit(!mIsRetryPending);
+
+    Resign();
+    FreeDtls();
+
+    // Requests of the closed session are dropped, so that their timeouts do not disturb the next session.
+    mManagementClient.Clear();
+    mCommissionerState  = CommissionerState::kStateInvalid;
+    mConnectRetryCount  = 0;
+    mPetitionRetryCount = 0;
+
+    // The joiners are allowed again once the next petition is accepted.
+    mIsSteeringDataDirty = true;
+
+    delay = GetRetryDelay(mReconnectCount);
+    mReconnectCount++;
+    mIsRetryPending = true;
+    mRetryTime      = GetNow() + delay;
+    otbrLog(OTBR_LOG_INFO, "reconnect %d in %lu ms", mReconnectCount, delay);
+
+exit:
+    return;
+}
+
+void Commissioner::FreeDtls(void)
+{
+    int ret;
+
+    VerifyOrExit(mDtlsInitDone);
+
+    do
+    {
+        ret = mbedtls_ssl_close_notify(&mSsl);
+    } while (ret == MBEDTLS_ERR_SSL_WANT_WRITE);
+
+    mbedtls_net_free(&mSslClientFd);
+
+    mbedtls_ssl_free(&mSsl);
+    mbedtls_ssl_config_free(&mSslConf);
+    mbedtls_ctr_drbg_free(&mDrbg);
+    mbedtls_entropy_free(&mEntropy);
+
+    mDtlsInitDone = false;
+    mIsTimerSet   = false;
+
+exit:
+    return;
 }
 
 void Commissioner::CommissionerPetition(void)
 {
-    int     retryCount = 0;
     uint8_t buffer[kSizeMaxPacket];
     Tlv *   tlv = reinterpret_cast<Tlv *>(buffer);
 
-    Coap::Message *message;
-    uint16_t       token = ++mCoapToken;
-
     otbrLog(OTBR_LOG_INFO, "COMM_PET.req: start");
-    if (mCommissionerState == CommissionerState::kStateRejected)
-    {
-        sleep(kPetitionAttemptDelay);
-        retryCount++;
-    }
-    token   = htons(token);
-    message = mCoapAgent->NewMessage(Coap::kTypeConfirmable, Coap::kCodePost, reinterpret_cast<const uint8_t *>(&token),
-                                     sizeof(token));
     tlv->SetType(Meshcop::kCommissionerId);
     tlv->SetValue(kCommissionerId, sizeof(kCommissionerId));
     tlv = tlv->GetNext();
 
-    message->SetPath(OT_URI_PATH_COMMISSIONER_PETITION);
-    message->SetPayload(buffer, Utils::LengthOf(buffer, tlv));
     otbrLog(OTBR_LOG_INFO, "COMM_PET.req: send");
-    mCoapAgent->Send(*message, NULL, 0, HandleCommissionerPetition, this);
-    mCoapAgent->FreeMessage(message);
+    mManagementClient.SendRequest(OT_URI_PATH_COMMISSIONER_PETITION, buffer, Utils::LengthOf(buffer, tlv),
+                                  HandleCommissionerPetition, this);
 
     otbrLog(OTBR_LOG_INFO, "COMM_PET.req: complete");
 }
@@ -250,7 +582,7 @@ void Commissioner::LogMeshcopState(const char *aPrefix, int8_t aState)
 }
 
 /** handle c/cp response */
-void Commissioner::HandleCommissionerPetition(const Coap::Message &aMessage, void *aContext)
+void Commissioner::HandleCommissionerPetition(const Coap::Message *aMessage, void *aContext)
 {
     uint16_t       length;
     int            tlvType;
@@ -258,8 +590,10 @@ void Commissioner::HandleCommissionerPetition(const Coap::Message &aMessage, voi
     const uint8_t *payload;
     Commissioner * commissioner = static_cast<Commissioner *>(aContext);
 
+    VerifyOrExit(aMessage != NULL, otbrLog(OTBR_LOG_WARNING, "COMM_PET.rsp: timeout"));
+
     otbrLog(OTBR_LOG_INFO, "COMM_PET.rsp: start");
-    payload = aMessage.GetPayload(length);
+    payload = aMessage->GetPayload(length);
     tlv     = reinterpret_cast<const Tlv *>(payload);
 
     while (Utils::LengthOf(payload, tlv) < length)
@@ -274,7 +608,14 @@ void Commissioner::HandleCommissionerPetition(const Coap::Message &aMessage, voi
             switch (state)
             {
             case Meshcop::kStateAccepted:
-                commissioner->mCommissionerState = CommissionerState::kStateAccepted;
+                commissioner->mCommissionerState  = CommissionerState::kStateAccepted;
+                commissioner->mPetitionRetryCount = 0;
+                commissioner->mReconnectCount     = 0;
+                if (commissioner->mTimeToActive == 0)
+                {
+                    commissioner->mTimeToActive = GetNow() - commissioner->mStartTime;
+                    otbrLog(OTBR_LOG_INFO, "COMM_PET.rsp: active in %lu ms", commissioner->mTimeToActive);
+                }
                 break;
             case Meshcop::kStateRejected:
                 commissioner->mCommissionerState = CommissionerState::kStateRejected;
@@ -299,20 +640,16 @@ void Commissioner::HandleCommissionerPetition(const Coap::Message &aMessage, voi
     gettimeofday(&commissioner->mLastKeepAliveTime, NULL);
     otbrLog(OTBR_LOG_INFO, "COMM_PET.rsp: complete");
 
+exit:
     commissioner->CommissionerResponseNext();
 }
 
 void Commissioner::CommissionerSet(const SteeringData &aSteeringData)
 {
-    uint16_t       token = ++mCoapToken;
-    uint8_t        buffer[kSizeMaxPacket];
-    Tlv *          tlv = reinterpret_cast<Tlv *>(buffer);
-    Coap::Message *message;
+    uint8_t buffer[kSizeMaxPacket];
+    Tlv *   tlv = reinterpret_cast<Tlv *>(buffer);
 
     otbrLog(OTBR_LOG_INFO, "COMMISSIONER_SET.req: start");
-    token   = htons(token);
-    message = mCoapAgent->NewMessage(Coap::kTypeConfirmable, Coap::kCodePost, reinterpret_cast<const uint8_t *>(&token),
-                                     sizeof(token));
 
     tlv->SetType(Meshcop::kCommissionerSessionId);
     tlv->SetValue(mCommissionerSessionId);
@@ -323,15 +660,13 @@ void Commissioner::CommissionerSet(const SteeringData &aSteeringData)
     tlv->SetValue(aSteeringData.GetBloomFilter(), aSteeringData.GetLength());
     tlv = tlv->GetNext();
 
-    message->SetPath(OT_URI_PATH_COMMISSIONER_SET);
-    otbrLog(OTBR_LOG_INFO, "COMMISSIONER_SET.req: coap-uri: %s", "c/cs");
-    message->SetPayload(buffer, Utils::LengthOf(buffer, tlv));
+    otbrLog(OTBR_LOG_INFO, "COMMISSIONER_SET.req: coap-uri: %s", OT_URI_PATH_COMMISSIONER_SET);
+    mManagementClient.SendRequest(OT_URI_PATH_COMMISSIONER_SET, buffer, Utils::LengthOf(buffer, tlv),
+                                  HandleCommissionerSet, this);
     otbrLog(OTBR_LOG_INFO, "COMMISSIONER_SET.req: sent");
-    mCoapAgent->Send(*message, NULL, 0, HandleCommissionerSet, this);
-    mCoapAgent->FreeMessage(message);
 }
 
-void Commissioner::HandleCommissionerSet(const Coap::Message &aMessage, void *aContext)
+void Commissioner::HandleCommissionerSet(const Coap::Message *aMessage, void *aContext)
 {
     uint16_t       length;
     int            tlvType;
@@ -339,8 +674,16 @@ void Commissioner::HandleCommissionerSet(const Coap::Message &aMessage, void *aC
     const uint8_t *payload;
     Commissioner * commissioner = static_cast<Commissioner *>(aContext);
 
+    if (aMessage == NULL)
+    {
+        // The steering data may not have reached the leader, resend it from the next Process().
+        otbrLog(OTBR_LOG_WARNING, "COMMISSIONER_SET.rsp: timeout");
+        commissioner->mIsSteeringDataDirty = true;
+        ExitNow();
+    }
+
     otbrLog(OTBR_LOG_INFO, "COMMISSIONER_SET.rsp: start");
-    payload = (aMessage.GetPayload(length));
+    payload = (aMessage->GetPayload(length));
     tlv     = reinterpret_cast<const Tlv *>(payload);
 
     while (Utils::LengthOf(payload, tlv) < length)
@@ -365,24 +708,33 @@ void Commissioner::HandleCommissionerSet(const Coap::Message &aMessage, void *aC
     }
     otbrLog(OTBR_LOG_INFO, "COMMISSIONER_SET.rsp: complete");
 
+exit:
     commissioner->CommissionerResponseNext();
 }
 
 void Commissioner::CommissionerResponseNext(void)
 {
-    if (mCommissionerState == CommissionerState::kStateConnected ||
-        mCommissionerState == CommissionerState::kStateRejected)
+    if ((mCommissionerState == CommissionerState::kStateConnected ||
+         mCommissionerState == CommissionerState::kStateRejected) &&
+        !mIsRetryPending)
     {
-        if (mCommissionerState != CommissionerState::kStateInvalid && mPetitionRetryCount < kPetitionMaxRetry)
-        {
-            mPetitionRetryCount++;
-            CommissionerPetition();
-        }
-        else
-        {
-            mCommissionerState  = CommissionerState::kStateInvalid;
-            mPetitionRetryCount = 0;
-        }
+        ScheduleRetry(mPetitionRetryCount, kPetitionMaxRetry);
+    }
+}
+
+static void UpdateTimeout(timeval &aTimeout, unsigned long aNow, unsigned long aDeadline)
+{
+    long remaining = static_cast<long>(aDeadline - aNow);
+
+    if (remaining < 0)
+    {
+        remaining = 0;
+    }
+
+    if (static_cast<unsigned long>(remaining) < GetTimestamp(aTimeout))
+    {
+        aTimeout.tv_sec  = remaining / 1000;
+        aTimeout.tv_usec = (remaining % 1000) * 1000;
     }
 }
 
@@ -392,14 +744,31 @@ void Commissioner::UpdateFdSet(fd_set & aReadFdSet,
                                int &    aMaxFd,
                                timeval &aTimeout)
 {
-    FD_SET(mSslClientFd.fd, &aReadFdSet);
-    aMaxFd = Utils::Max(mSslClientFd.fd, aMaxFd);
-    FD_SET(mJoinerSessionClientFd, &aReadFdSet);
-    aMaxFd = Utils::Max(mJoinerSessionClientFd, aMaxFd);
-    if (mJoinerSession)
+    unsigned long now = GetNow();
+
+    // While waiting to retry the handshake, stale records are left in the socket until the next attempt.
+    if (mDtlsInitDone && !(mCommissionerState == CommissionerState::kStateConnecting && mIsRetryPending))
     {
-        mJoinerSession->UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
+        FD_SET(mSslClientFd.fd, &aReadFdSet);
+        aMaxFd = Utils::Max(mSslClientFd.fd, aMaxFd);
     }
+
+    if (mIsRetryPending)
+    {
+        UpdateTimeout(aTimeout, now, mRetryTime);
+    }
+    else if (mCommissionerState == CommissionerState::kStateConnecting && mIsTimerSet)
+    {
+        UpdateTimeout(aTimeout, now, mTimerIntermediate);
+    }
+
+    if (mCommissionerState == CommissionerState::kStateAccepted && mKeepAliveRate > 0)
+    {
+        UpdateTimeout(aTimeout, now, GetTimestamp(mLastKeepAliveTime) + (mKeepAliveRate + 1) * 1000UL);
+    }
+
+    mManagementClient.UpdateFdSet(aTimeout);
+    mJoinerSessions.UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
 }
 
 void Commissioner::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
@@ -407,11 +776,39 @@ void Commissioner::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet,
     uint8_t buffer[kSizeMaxPacket];
     timeval nowTime;
 
-    if (mJoinerSession)
+    mJoinerSessions.Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
+    mManagementClient.Process();
+
+    if (mIsRetryPending && static_cast<long>(mRetryTime - GetNow()) <= 0)
+    {
+        mIsRetryPending = false;
+
+        if (mCommissionerState == CommissionerState::kStateConnecting)
+        {
+            DtlsHandshake();
+        }
+        else if (mCommissionerState != CommissionerState::kStateInvalid)
+        {
+            CommissionerPetition();
+        }
+        else
+        {
+            int ret = SetupDtls();
+
+            if (ret != 0)
+            {
+                otbrLog(OTBR_LOG_ERR, "reconnect failed: -0x%04x", -ret);
+            }
+        }
+    }
+    else if (mCommissionerState == CommissionerState::kStateConnecting)
     {
-        mJoinerSession->Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
+        if (!mIsRetryPending && (FD_ISSET(mSslClientFd.fd, &aReadFdSet) || GetDelay() > 0))
+        {
+            DtlsHandshake();
+        }
     }
-    if (FD_ISSET(mSslClientFd.fd, &aReadFdSet))
+    else if (mDtlsInitDone && FD_ISSET(mSslClientFd.fd, &aReadFdSet))
     {
         int n = mbedtls_ssl_read(&mSsl, buffer, sizeof(buffer));
 
@@ -421,23 +818,13 @@ void Commissioner::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet,
         }
     }
 
-    if (FD_ISSET(mJoinerSessionClientFd, &aReadFdSet))
+    // Joiners added or removed since the last iteration share a single COMMISSIONER_SET.
+    if (mCommissionerState == CommissionerState::kStateAccepted && mIsSteeringDataDirty)
     {
-        struct sockaddr_in from_addr;
-        socklen_t          addrlen = sizeof(from_addr);
-
-        ssize_t n =
-            recvfrom(mJoinerSessionClientFd, buffer, sizeof(buffer), 0, (struct sockaddr *)(&from_addr), &addrlen);
-        if (n > 0)
-        {
-            {
-                char buf[kIPAddrNameBufSize];
-                GetIPString((struct sockaddr *)(&from_addr), buf, sizeof(buf));
-                otbrLog(OTBR_LOG_INFO, "relay from: %s\n", buf);
-            }
-            SendRelayTransmit(buffer, static_cast<uint16_t>(n));
-        }
+        mIsSteeringDataDirty = false;
+        CommissionerSet(mSteeringData);
     }
+
     gettimeofday(&nowTime, NULL);
     if (mCommissionerState == CommissionerState::kStateAccepted && mKeepAliveRate > 0 &&
         nowTime.tv_sec - mLastKeepAliveTime.tv_sec > mKeepAliveRate)
@@ -456,13 +843,8 @@ void Commissioner::Resign(void)
 
 void Commissioner::SendCommissionerKeepAlive(int8_t aState)
 {
-    uint8_t        buffer[kSizeMaxPacket];
-    Tlv *          tlv = reinterpret_cast<Tlv *>(buffer);
-    Coap::Message *message;
-
-    mCoapToken++;
-    message = mCoapAgent->NewMessage(Coap::kTypeConfirmable, Coap::kCodePost,
-                                     reinterpret_cast<const uint8_t *>(&mCoapToken), sizeof(mCoapToken));
+    uint8_t buffer[kSizeMaxPacket];
+    Tlv *   tlv = reinterpret_cast<Tlv *>(buffer);
 
     tlv->SetType(Meshcop::kState);
     tlv->SetValue(aState);
@@ -472,18 +854,15 @@ void Commissioner::SendCommissionerKeepAlive(int8_t aState)
     tlv->SetValue(mCommissionerSessionId);
     tlv = tlv->GetNext();
 
-    message->SetPath(OT_URI_PATH_COMMISSIONER_KEEP_ALIVE);
-    message->SetPayload(buffer, Utils::LengthOf(buffer, tlv));
-
     otbrLog(OTBR_LOG_INFO, "COMM_KA.req: send");
     gettimeofday(&mLastKeepAliveTime, NULL);
     mKeepAliveTxCount += 1;
-    mCoapAgent->Send(*message, NULL, 0, HandleCommissionerKeepAlive, this);
-    mCoapAgent->FreeMessage(message);
+    mManagementClient.SendRequest(OT_URI_PATH_COMMISSIONER_KEEP_ALIVE, buffer, Utils::LengthOf(buffer, tlv),
+                                  HandleCommissionerKeepAlive, this);
 }
 
 /** Handle a COMM_KA response */
-void Commissioner::HandleCommissionerKeepAlive(const Coap::Message &aMessage, void *aContext)
+void Commissioner::HandleCommissionerKeepAlive(const Coap::Message *aMessage, void *aContext)
 {
     uint16_t       length;
     int            tlvType;
@@ -491,13 +870,15 @@ void Commissioner::HandleCommissionerKeepAlive(const Coap::Message &aMessage, vo
     const uint8_t *payload;
     Commissioner * commissioner = static_cast<Commissioner *>(aContext);
 
+    VerifyOrExit(aMessage != NULL, otbrLog(OTBR_LOG_WARNING, "COMM_KA.rsp: timeout"));
+
     otbrLog(OTBR_LOG_INFO, "COMM_KA.rsp: start");
 
     /* record stats */
     gettimeofday(&commissioner->mLastKeepAliveTime, NULL);
     commissioner->mKeepAliveRxCount += 1;
 
-    payload = (aMessage.GetPayload(length));
+    payload = (aMessage->GetPayload(length));
     tlv     = reinterpret_cast<const Tlv *>(payload);
 
     while (Utils::LengthOf(payload, tlv) < length)
@@ -530,6 +911,7 @@ void Commissioner::HandleCommissionerKeepAlive(const Coap::Message &aMessage, vo
     }
     otbrLog(OTBR_LOG_INFO, "COMM_KA.rsp: complete");
 
+exit:
     commissioner->CommissionerResponseNext();
 }
 
@@ -540,11 +922,15 @@ void Commissioner::HandleRelayReceive(const Coap::Resource &aResource,
                                       uint16_t              aPort,
                                       void *                aContext)
 {
-    int            ret = 0;
-    int            tlvType;
-    uint16_t       length;
-    Commissioner * commissioner = static_cast<Commissioner *>(aContext);
-    const uint8_t *payload      = aMessage.GetPayload(length);
+    int             tlvType;
+    uint16_t        length;
+    Commissioner *  commissioner = static_cast<Commissioner *>(aContext);
+    const uint8_t * payload      = aMessage.GetPayload(length);
+    const Tlv *     dtlsTlv      = NULL;
+    bool            hasIid       = false;
+    JoinerRelayInfo joiner;
+
+    memset(&joiner, 0, sizeof(joiner));
 
     for (const Tlv *requestTlv = reinterpret_cast<const Tlv *>(payload); Utils::LengthOf(payload, requestTlv) < length;
          requestTlv            = requestTlv->GetNext())
@@ -553,27 +939,24 @@ void Commissioner::HandleRelayReceive(const Coap::Resource &aResource,
         switch (tlvType)
         {
         case Meshcop::kJoinerDtlsEncapsulation:
-            ret = static_cast<int>(
-                send(commissioner->mJoinerSessionClientFd, requestTlv->GetValue(), requestTlv->GetLength(), 0));
-            if (ret < 0)
-            {
-                otbrLog(OTBR_LOG_ERR, "relay receive, sendto() fails with %d", errno);
-            }
-            VerifyOrExit(ret != -1, ret = errno);
+            dtlsTlv = requestTlv;
             break;
 
         case Meshcop::kJoinerUdpPort:
-            commissioner->mJoinerUdpPort = requestTlv->GetValueUInt16();
-            otbrLog(OTBR_LOG_INFO, "JoinerPort: %d", commissioner->mJoinerUdpPort);
+            joiner.mUdpPort = requestTlv->GetValueUInt16();
+            otbrLog(OTBR_LOG_INFO, "JoinerPort: %d", joiner.mUdpPort);
             break;
 
         case Meshcop::kJoinerIid:
-            memcpy(commissioner->mJoinerIid, requestTlv->GetValue(), sizeof(commissioner->mJoinerIid));
+            VerifyOrExit(requestTlv->GetLength() == sizeof(joiner.mIid),
+                         otbrLog(OTBR_LOG_WARNING, "relay receive, invalid joiner IID"));
+            memcpy(joiner.mIid, requestTlv->GetValue(), sizeof(joiner.mIid));
+            hasIid = true;
             break;
 
         case Meshcop::kJoinerRouterLocator:
-            commissioner->mJoinerRouterLocator = requestTlv->GetValueUInt16();
-            otbrLog(OTBR_LOG_INFO, "Router locator: %d", commissioner->mJoinerRouterLocator);
+            joiner.mRouterLocator = requestTlv->GetValueUInt16();
+            otbrLog(OTBR_LOG_INFO, "Router locator: %d", joiner.mRouterLocator);
             break;
 
         default:
@@ -582,6 +965,11 @@ void Commissioner::HandleRelayReceive(const Coap::Resource &aResource,
         }
     }
 
+    // The joiner session can only be looked up once all TLVs are parsed.
+    VerifyOrExit(dtlsTlv != NULL && hasIid, otbrLog(OTBR_LOG_WARNING, "relay receive, missing joiner TLVs"));
+    commissioner->mJoinerSessions.HandleRelayReceive(joiner, static_cast<const uint8_t *>(dtlsTlv->GetValue()),
+                                                     dtlsTlv->GetLength());
+
 exit:
 
     (void)aResource;
@@ -592,40 +980,45 @@ exit:
     return;
 }
 
-ssize_t Commissioner::SendRelayTransmit(uint8_t *aBuf, size_t aLength)
+void Commissioner::HandleRelayTransmit(const JoinerRelayInfo &aJoiner,
+                                       const uint8_t *        aBuf,
+                                       uint16_t               aLength,
+                                       const uint8_t *        aKek,
+                                       void *                 aContext)
+{
+    static_cast<Commissioner *>(aContext)->SendRelayTransmit(aJoiner, aBuf, aLength, aKek);
+}
+
+void Commissioner::SendRelayTransmit(const JoinerRelayInfo &aJoiner,
+                                     const uint8_t *        aBuf,
+                                     uint16_t               aLength,
+                                     const uint8_t *        aKek)
 {
     uint8_t payload[kSizeMaxPacket];
     Tlv *   responseTlv = reinterpret_cast<Tlv *>(payload);
 
     responseTlv->SetType(Meshcop::kJoinerDtlsEncapsulation);
-    responseTlv->SetValue(aBuf, static_cast<uint16_t>(aLength));
+    responseTlv->SetValue(aBuf, aLength);
     responseTlv = responseTlv->GetNext();
 
     responseTlv->SetType(Meshcop::kJoinerUdpPort);
-    responseTlv->SetValue(mJoinerUdpPort);
+    responseTlv->SetValue(aJoiner.mUdpPort);
     responseTlv = responseTlv->GetNext();
 
     responseTlv->SetType(Meshcop::kJoinerIid);
-    responseTlv->SetValue(mJoinerIid, sizeof(mJoinerIid));
+    responseTlv->SetValue(aJoiner.mIid, sizeof(aJoiner.mIid));
     responseTlv = responseTlv->GetNext();
 
     responseTlv->SetType(Meshcop::kJoinerRouterLocator);
-    responseTlv->SetValue(mJoinerRouterLocator);
+    responseTlv->SetValue(aJoiner.mRouterLocator);
     responseTlv = responseTlv->GetNext();
 
-    assert(mJoinerSession != NULL);
-
-    if (mJoinerSession->NeedAppendKek())
+    if (aKek != NULL)
     {
-        uint8_t kek[kKEKSize];
-
-        mJoinerSession->GetKek(kek, sizeof(kek));
-        mJoinerSession->MarkKekSent();
         otbrLog(OTBR_LOG_INFO, "relay: KEK state");
         responseTlv->SetType(Meshcop::kJoinerRouterKek);
-        responseTlv->SetValue(kek, sizeof(kek));
+        responseTlv->SetValue(aKek, kKEKSize);
         responseTlv = responseTlv->GetNext();
-        mNumFinializeJoiners++;
     }
 
     {
@@ -640,41 +1033,220 @@ ssize_t Commissioner::SendRelayTransmit(uint8_t *aBuf, size_t aLength)
         mCoapAgent->Send(*message, NULL, 0, NULL, this);
         mCoapAgent->FreeMessage(message);
     }
+}
+
+otbrError Commissioner::EnergyScan(uint32_t       aChannelMask,
+                                   uint8_t        aCount,
+                                   uint16_t       aPeriod,
+                                   uint16_t       aScanDuration,
+                                   const uint8_t *aDestination)
+{
+    uint8_t  buffer[ChannelSurvey::kMaxQuerySize];
+    uint16_t length = ChannelSurvey::EncodeEnergyScanQuery(buffer, mCommissionerSessionId, aChannelMask, aCount,
+                                                           aPeriod, aScanDuration);
 
-    return static_cast<ssize_t>(aLength);
+    otbrLog(OTBR_LOG_INFO, "MGMT_ED_SCAN.qry: channel-mask=0x%08x count=%u", aChannelMask, aCount);
+    return SendMeshQuery(OT_URI_PATH_ENERGY_SCAN, buffer, length, aDestination);
 }
 
-int Commissioner::GetNumFinalizedJoiners(void) const
+otbrError Commissioner::PanIdQuery(uint32_t aChannelMask, uint16_t aPanId, const uint8_t *aDestination)
 {
-    return mNumFinializeJoiners;
+    uint8_t  buffer[ChannelSurvey::kMaxQuerySize];
+    uint16_t length = ChannelSurvey::EncodePanIdQuery(buffer, mCommissionerSessionId, aChannelMask, aPanId);
+
+    otbrLog(OTBR_LOG_INFO, "MGMT_PANID_QUERY.qry: channel-mask=0x%08x pan-id=0x%04x", aChannelMask, aPanId);
+    return SendMeshQuery(OT_URI_PATH_PANID_QUERY, buffer, length, aDestination);
 }
 
-Commissioner::~Commissioner(void)
+otbrError Commissioner::SendMeshQuery(const char *   aPath,
+                                      const uint8_t *aPayload,
+                                      uint16_t       aLength,
+                                      const uint8_t *aDestination)
 {
-    Resign();
-    if (mDtlsInitDone)
-    {
-        int ret;
+    otbrError      error = OTBR_ERROR_ERRNO;
+    uint16_t       token = ++mCoapToken;
+    Coap::Type     type;
+    Coap::Message *message;
+
+    VerifyOrExit(mCommissionerState == CommissionerState::kStateAccepted, errno = EAGAIN);
+
+    // Queries to a multicast group are not acknowledged.
+    type    = (aDestination[0] == 0xff ? Coap::kTypeNonConfirmable : Coap::kTypeConfirmable);
+    message = mMeshAgent->NewMessage(type, Coap::kCodePost, reinterpret_cast<const uint8_t *>(&token), sizeof(token));
+    message->SetPath(aPath);
+    message->SetPayload(aPayload, aLength);
+    error = mMeshAgent->Send(*message, aDestination, kPortTmf, NULL, this);
+    mMeshAgent->FreeMessage(message);
+
+exit:
+    return error;
+}
+
+ssize_t Commissioner::SendMeshCoap(const uint8_t *aBuffer,
+                                   uint16_t       aLength,
+                                   const uint8_t *aIp6,
+                                   uint16_t       aPort,
+                                   void *         aContext)
+{
+    return static_cast<Commissioner *>(aContext)->SendProxyTransmit(aBuffer, aLength, aIp6, aPort);
+}
+
+ssize_t Commissioner::SendProxyTransmit(const uint8_t *aBuffer, uint16_t aLength, const uint8_t *aIp6, uint16_t aPort)
+{
+    ssize_t        ret = -1;
+    uint8_t        payload[kSizeMaxPacket];
+    uint8_t        udp[kSizeMaxPacket];
+    Tlv *          tlv   = reinterpret_cast<Tlv *>(payload);
+    uint16_t       token = ++mCoapToken;
+    Coap::Message *message;
 
-        do
+    // The UDP Encapsulation TLV holds the source and destination ports followed by the UDP payload.
+    VerifyOrExit(aLength + 2 * sizeof(uint16_t) + 4 * sizeof(Tlv) + OTBR_IP6_ADDRESS_SIZE <= sizeof(payload),
+                 errno = EMSGSIZE);
+
+    udp[0] = static_cast<uint8_t>(kPortTmf >> 8);
+    udp[1] = static_cast<uint8_t>(kPortTmf & 0xff);
+    udp[2] = static_cast<uint8_t>(aPort >> 8);
+    udp[3] = static_cast<uint8_t>(aPort & 0xff);
+    memcpy(udp + 2 * sizeof(uint16_t), aBuffer, aLength);
+
+    tlv->SetType(Meshcop::kUdpEncapsulation);
+    tlv->SetValue(udp, static_cast<uint16_t>(aLength + 2 * sizeof(uint16_t)));
+    tlv = tlv->GetNext();
+
+    tlv->SetType(Meshcop::kIPv6Address);
+    tlv->SetValue(aIp6, OTBR_IP6_ADDRESS_SIZE);
+    tlv = tlv->GetNext();
+
+    message = mCoapAgent->NewMessage(Coap::kTypeNonConfirmable, Coap::kCodePost,
+                                     reinterpret_cast<const uint8_t *>(&token), sizeof(token));
+    message->SetPath(OT_URI_PATH_PROXY_TX);
+    message->SetPayload(payload, Utils::LengthOf(payload, tlv));
+    otbrLog(OTBR_LOG_INFO, "UDP_TX.ntf: send %u bytes to port %u", aLength, aPort);
+    mCoapAgent->Send(*message, NULL, 0, NULL, this);
+    mCoapAgent->FreeMessage(message);
+
+    ret = aLength;
+
+exit:
+    return ret;
+}
+
+void Commissioner::HandleProxyReceive(const Coap::Resource &aResource,
+                                      const Coap::Message & aMessage,
+                                      Coap::Message &       aResponse,
+                                      const uint8_t *       aIp6,
+                                      uint16_t              aPort,
+                                      void *                aContext)
+{
+    uint16_t       length;
+    Commissioner * commissioner = static_cast<Commissioner *>(aContext);
+    const uint8_t *payload      = aMessage.GetPayload(length);
+    const Tlv *    udpTlv       = NULL;
+    const uint8_t *source       = NULL;
+
+    for (const Tlv *tlv = reinterpret_cast<const Tlv *>(payload); Utils::LengthOf(payload, tlv) < length;
+         tlv            = tlv->GetNext())
+    {
+        switch (tlv->GetType())
         {
-            ret = mbedtls_ssl_close_notify(&mSsl);
-        } while (ret == MBEDTLS_ERR_SSL_WANT_WRITE);
+        case Meshcop::kUdpEncapsulation:
+            VerifyOrExit(tlv->GetLength() >= 2 * sizeof(uint16_t),
+                         otbrLog(OTBR_LOG_WARNING, "UDP_RX.ntf: invalid UDP encapsulation"));
+            udpTlv = tlv;
+            break;
+
+        case Meshcop::kIPv6Address:
+            VerifyOrExit(tlv->GetLength() == OTBR_IP6_ADDRESS_SIZE,
+                         otbrLog(OTBR_LOG_WARNING, "UDP_RX.ntf: invalid IPv6 address"));
+            source = static_cast<const uint8_t *>(tlv->GetValue());
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    VerifyOrExit(udpTlv != NULL && source != NULL, otbrLog(OTBR_LOG_WARNING, "UDP_RX.ntf: missing TLVs"));
+
+    {
+        const uint8_t *udp = static_cast<const uint8_t *>(udpTlv->GetValue());
+
+        commissioner->mMeshAgent->Input(udp + 2 * sizeof(uint16_t),
+                                        static_cast<uint16_t>(udpTlv->GetLength() - 2 * sizeof(uint16_t)), source,
+                                        static_cast<uint16_t>(udp[0] << 8 | udp[1]));
+    }
 
-        mbedtls_net_free(&mSslClientFd);
+exit:
+    (void)aResource;
+    (void)aResponse;
+    (void)aIp6;
+    (void)aPort;
+}
 
-        mbedtls_ssl_free(&mSsl);
-        mbedtls_ssl_config_free(&mSslConf);
-        mbedtls_ctr_drbg_free(&mDrbg);
-        mbedtls_entropy_free(&mEntropy);
+void Commissioner::HandleEnergyReport(const Coap::Resource &aResource,
+                                      const Coap::Message & aMessage,
+                                      Coap::Message &       aResponse,
+                                      const uint8_t *       aIp6,
+                                      uint16_t              aPort,
+                                      void *                aContext)
+{
+    uint16_t       length;
+    Commissioner * commissioner = static_cast<Commissioner *>(aContext);
+    const uint8_t *payload      = aMessage.GetPayload(length);
+
+    if (commissioner->mChannelSurvey.HandleEnergyReport(aIp6, payload, length) == OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_INFO, "MGMT_ED_REPORT.ans: recorded");
     }
+    else
+    {
+        otbrLog(OTBR_LOG_WARNING, "MGMT_ED_REPORT.ans: dropped: %s", strerror(errno));
+    }
+
+    aResponse.SetCode(Coap::kCodeChanged);
 
-    if (mJoinerSession)
+    (void)aResource;
+    (void)aPort;
+}
+
+void Commissioner::HandlePanIdConflict(const Coap::Resource &aResource,
+                                       const Coap::Message & aMessage,
+                                       Coap::Message &       aResponse,
+                                       const uint8_t *       aIp6,
+                                       uint16_t              aPort,
+                                       void *                aContext)
+{
+    uint16_t       length;
+    Commissioner * commissioner = static_cast<Commissioner *>(aContext);
+    const uint8_t *payload      = aMessage.GetPayload(length);
+
+    if (commissioner->mChannelSurvey.HandlePanIdConflict(aIp6, payload, length) == OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_INFO, "MGMT_PANID_CONFLICT.ans: recorded");
+    }
+    else
     {
-        delete mJoinerSession;
+        otbrLog(OTBR_LOG_WARNING, "MGMT_PANID_CONFLICT.ans: dropped: %s", strerror(errno));
     }
 
-    close(mJoinerSessionClientFd);
+    aResponse.SetCode(Coap::kCodeChanged);
+
+    (void)aResource;
+    (void)aPort;
+}
+
+int Commissioner::GetNumFinalizedJoiners(void) const
+{
+    return mJoinerSessions.GetNumFinalizedJoiners();
+}
+
+Commissioner::~Commissioner(void)
+{
+    Resign();
+    FreeDtls();
+
+    Coap::Agent::Destroy(mMeshAgent);
     Coap::Agent::Destroy(mCoapAgent);
 }
 
@@ -36,8 +36,11 @@
 
 #include "openthread-br/config.h"
 
+#include <map>
+
 #include <arpa/inet.h>
 #include <errno.h>
+#include <stdio.h>
 #include <sys/socket.h>
 
 #if !defined(MBEDTLS_CONFIG_FILE)
@@ -53,11 +56,12 @@
 #include <mbedtls/error.h>
 #include <mbedtls/net_sockets.h>
 #include <mbedtls/ssl.h>
-#include <mbedtls/timing.h>
 #include <sys/time.h>
 
+#include "commissioner/channel_survey.hpp"
 #include "commissioner/constants.hpp"
-#include "commissioner/joiner_session.hpp"
+#include "commissioner/joiner_session_manager.hpp"
+#include "commissioner/management_client.hpp"
 #include "common/coap.hpp"
 #include "utils/pskc.hpp"
 #include "utils/steering_data.hpp"
@@ -67,24 +71,89 @@ namespace otbr {
 class Commissioner
 {
 public:
+    /**
+     * This function pointer is called when the state of a joiner provisioned by AddJoiner() changes.
+     *
+     * @param[in]   aEui64      EUI64 of the joiner.
+     * @param[in]   aState      The new state of the joiner.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    typedef void (*JoinerStateHandler)(const uint8_t *aEui64, JoinerState aState, void *aContext);
+
     /**
      * The constructor to initialize Commissioner
      *
-     * @param[in]    aPskcBin           binary form of pskc
-     * @param[in]    aKeepAliveRate     send keep alive packet every aKeepAliveRate seconds
+     * @param[in]    aPskcBin               binary form of pskc
+     * @param[in]    aKeepAliveRate         send keep alive packet every aKeepAliveRate seconds
+     * @param[in]    aMaxJoinerSessions     max number of joiners commissioned at the same time
+     * @param[in]    aJoinerSessionTimeout  seconds a joiner is allowed to take before being dropped
      *
      */
-    Commissioner(const uint8_t *aPskcBin, int aKeepAliveRate);
+    Commissioner(const uint8_t *aPskcBin, int aKeepAliveRate, int aMaxJoinerSessions, int aJoinerSessionTimeout);
 
     /**
-     * This method sets the joiner to join the thread network
+     * This method sets the joiners to join the thread network
      *
-     * @param[in]    aPskdAscii         ascii form of pskd
-     * @param[in]    aSteeringData      steering data to filter joiner
+     * @param[in]    aPskdAscii         ascii form of pskd shared by the joiners
+     * @param[in]    aSteeringData      steering data to filter joiners
      *
      */
     void SetJoiner(const char *aPskdAscii, const SteeringData &aSteeringData);
 
+    /**
+     * This method provisions a joiner with its own pskd.
+     *
+     * The joiner is added to the steering data, which is sent in a single COMMISSIONER_SET for all joiners
+     * added or removed within the same mainloop iteration.
+     *
+     * @param[in]    aEui64             EUI64 of the joiner
+     * @param[in]    aPskdAscii         ascii form of pskd of the joiner
+     *
+     * @retval OTBR_ERROR_NONE      Successfully added the joiner.
+     * @retval OTBR_ERROR_ERRNO     The joiner was already added.
+     *
+     */
+    otbrError AddJoiner(const uint8_t *aEui64, const char *aPskdAscii);
+
+    /**
+     * This method removes a joiner provisioned by AddJoiner().
+     *
+     * @param[in]    aEui64             EUI64 of the joiner
+     *
+     * @retval OTBR_ERROR_NONE      Successfully removed the joiner.
+     * @retval OTBR_ERROR_ERRNO     The joiner was not added.
+     *
+     */
+    otbrError RemoveJoiner(const uint8_t *aEui64);
+
+    /**
+     * This method gets number of joiners provisioned by AddJoiner() in a given state
+     *
+     * @param[in]    aState             the joiner state
+     *
+     * @returns number of joiners in @p aState
+     *
+     */
+    int GetNumJoiners(JoinerState aState) const;
+
+    /**
+     * This method sets the handler notified of state changes of joiners provisioned by AddJoiner()
+     *
+     * @param[in]    aHandler           handler of joiner state changes, NULL to disable notification
+     * @param[in]    aContext           context of @p aHandler
+     *
+     */
+    void SetJoinerStateHandler(JoinerStateHandler aHandler, void *aContext);
+
+    /**
+     * This method writes the state of joiners provisioned by AddJoiner()
+     *
+     * @param[in]    aStream            the stream to write to
+     *
+     */
+    void WriteJoinerSummary(FILE *aStream) const;
+
     /**
      * This method updates the fd_set and timeout for mainloop.
      * @p aTimeout should only be updated if session has pending process in less than its current value.
@@ -125,31 +194,49 @@ public:
     bool IsCommissionerAccepted(void) const { return mCommissionerState == CommissionerState::kStateAccepted; }
 
     /**
-     * This method initialize the dtls session
+     * This method returns the name of the commissioner state
+     *
+     * @returns one of "invalid", "connecting", "connected", "accepted" or "rejected"
+     *
+     */
+    const char *GetStateName(void) const;
+
+    /**
+     * This method initializes the dtls session and starts connecting to the border agent.
+     *
+     * The handshake, the petition and their retries are driven by UpdateFdSet() and Process() afterwards.
      *
      * @param[in]   aHost      Address of border agent service
      * @param[in]   aPort      Port of border agent service
      *
-     * @returns 0 on success, MBEDTLS_ERR_XXX on failure
+     * @returns 0 on success, MBEDTLS_ERR_SSL_BAD_INPUT_DATA if @p aHost or @p aPort is too long, MBEDTLS_ERR_XXX on
+     *          other failures
      *
      */
     int InitDtls(const char *aHost, const char *aPort);
 
     /**
-     * This method initialize the dtls session
+     * This method cancels any pending connection or petition attempt, and resigns if already accepted.
      *
-     * @returns 0 on success,
-     *          MBEDTLS_ERR_SSL_WANT_READ or MBEDTLS_ERR_SSL_WANT_WRITE for pending, in which case
-     *          you need to call this method again,
-     *          or other SSL error code on failure
      */
-    int TryDtlsHandshake(void);
+    void Cancel(void);
 
     /**
-     * This method sends commissioner petition coap request
+     * This method tears down the dtls session, and connects to the border agent again after the retry delay.
+     *
+     * The delay doubles with each reconnection until a petition is accepted, as the delay of petition retries does.
+     * Nothing is done while a retry or a reconnection is pending.
      *
      */
-    void CommissionerPetition(void);
+    void Reconnect(void);
+
+    /**
+     * This method gets the time taken from InitDtls() to the petition being accepted
+     *
+     * @returns milliseconds to become active commissioner, 0 if not accepted yet
+     *
+     */
+    unsigned long GetTimeToActive(void) const { return mTimeToActive; }
 
     /**
      * This method gets number of nodes joined through commissioner
@@ -159,6 +246,74 @@ public:
      */
     int GetNumFinalizedJoiners(void) const;
 
+    /**
+     * This method gets the max number of joiners commissioned at the same time so far
+     *
+     * @returns peak number of concurrent joiner sessions
+     *
+     */
+    int GetPeakNumJoinerSessions(void) const { return mJoinerSessions.GetPeakNumSessions(); }
+
+    /**
+     * This method gets the per-phase latency metrics of joiners
+     *
+     * @returns the joiner metrics
+     *
+     */
+    const JoinerMetrics &GetJoinerMetrics(void) const { return mJoinerSessions.GetMetrics(); }
+
+    /**
+     * This method returns the client pipelining management requests over the commissioner session.
+     *
+     * Requests should only be sent once the petition is accepted.
+     *
+     * @returns A reference to the management client.
+     *
+     */
+    ManagementClient &GetManagementClient(void) { return mManagementClient; }
+
+    /**
+     * This method sends a MGMT_ED_SCAN.qry through the UDP proxy of the border agent.
+     *
+     * The MGMT_ED_REPORT answers are aggregated by GetChannelSurvey().
+     *
+     * @param[in]   aChannelMask    The channels to scan, bit N stands for channel N.
+     * @param[in]   aCount          Number of measurements per channel.
+     * @param[in]   aPeriod         Milliseconds between measurements.
+     * @param[in]   aScanDuration   Milliseconds of each measurement.
+     * @param[in]   aDestination    A pointer to the IPv6 address of a router, or of a multicast group.
+     *
+     * @retval OTBR_ERROR_NONE      Successfully sent the query.
+     * @retval OTBR_ERROR_ERRNO     Failed to send the query, EAGAIN if the petition is not accepted yet.
+     *
+     */
+    otbrError EnergyScan(uint32_t       aChannelMask,
+                         uint8_t        aCount,
+                         uint16_t       aPeriod,
+                         uint16_t       aScanDuration,
+                         const uint8_t *aDestination);
+
+    /**
+     * This method sends a MGMT_PANID_QUERY.qry through the UDP proxy of the border agent.
+     *
+     * The MGMT_PANID_CONFLICT answers are aggregated by GetChannelSurvey().
+     *
+     * @param[in]   aChannelMask    The channels to query, bit N stands for channel N.
+     * @param[in]   aPanId          The PAN ID to look for.
+     * @param[in]   aDestination    A pointer to the IPv6 address of a router, or of a multicast group.
+     *
+     * @retval OTBR_ERROR_NONE      Successfully sent the query.
+     * @retval OTBR_ERROR_ERRNO     Failed to send the query, EAGAIN if the petition is not accepted yet.
+     *
+     */
+    otbrError PanIdQuery(uint32_t aChannelMask, uint16_t aPanId, const uint8_t *aDestination);
+
+    /**
+     * This method returns the energy scan and PAN ID conflict reports received so far.
+     *
+     */
+    const ChannelSurvey &GetChannelSurvey(void) const { return mChannelSurvey; }
+
     ~Commissioner(void);
 
 private:
@@ -176,9 +331,16 @@ private:
      */
     void Resign(void);
 
+    /**
+     * This method sends commissioner petition coap request
+     *
+     */
+    void CommissionerPetition(void);
+
     enum class CommissionerState
     {
         kStateInvalid = 0, ///< uninitialized, encounter network error or petition exceeds max retry
+        kStateConnecting,  ///< dtls handshake in progress
         kStateConnected,   ///< dtls connection setup done
         kStateAccepted,    ///< commissioner petition succeeded
         kStateRejected,    ///< rejected by leader, still retrying petition
@@ -187,9 +349,19 @@ private:
     Commissioner(const Commissioner &);
     Commissioner &operator=(const Commissioner &);
 
-    int  DtlsHandShake(const sockaddr_in &aAgentAddr);
+    int  SetupDtls(void);
+    void FreeDtls(void);
+    void DtlsHandshake(void);
+    void ScheduleRetry(int &aRetryCount, int aMaxRetry);
     void SendCommissionerKeepAlive(int8_t aState);
 
+    static unsigned long GetRetryDelay(int aRetryCount);
+
+    static void SetDelay(void *aContext, uint32_t aIntermediate, uint32_t aFinal);
+    void        SetDelay(uint32_t aIntermediate, uint32_t aFinal);
+    static int  GetDelay(void *aContext);
+    int         GetDelay(void) const;
+
     static ssize_t SendCoap(const uint8_t *aBuffer,
                             uint16_t       aLength,
                             const uint8_t *aIp6,
@@ -198,9 +370,9 @@ private:
 
     static void LogMeshcopState(const char *aPrefix, int8_t aState);
 
-    static void HandleCommissionerPetition(const Coap::Message &aMessage, void *aContext);
-    static void HandleCommissionerSet(const Coap::Message &aMessage, void *aContext);
-    static void HandleCommissionerKeepAlive(const Coap::Message &aMessage, void *aContext);
+    static void HandleCommissionerPetition(const Coap::Message *aMessage, void *aContext);
+    static void HandleCommissionerSet(const Coap::Message *aMessage, void *aContext);
+    static void HandleCommissionerKeepAlive(const Coap::Message *aMessage, void *aContext);
     void        CommissionerResponseNext(void);
 
     static void HandleRelayReceive(const Coap::Resource &aResource,
@@ -209,43 +381,110 @@ private:
                                    const uint8_t *       aIp6,
                                    uint16_t              aPort,
                                    void *                aContext);
-    ssize_t     SendRelayTransmit(uint8_t *aBuf, size_t aLength);
-
-    mbedtls_net_context          mSslClientFd;
-    mbedtls_ssl_context          mSsl;
-    mbedtls_entropy_context      mEntropy;
-    mbedtls_ctr_drbg_context     mDrbg;
-    mbedtls_ssl_config           mSslConf;
-    mbedtls_timing_delay_context mTimer;
-    bool                         mDtlsInitDone;
-
-    Coap::Agent *  mCoapAgent;
-    uint16_t       mCoapToken;
-    Coap::Resource mRelayReceiveHandler;
+    static void HandleRelayTransmit(const JoinerRelayInfo &aJoiner,
+                                    const uint8_t *        aBuf,
+                                    uint16_t               aLength,
+                                    const uint8_t *        aKek,
+                                    void *                 aContext);
+    void        SendRelayTransmit(const JoinerRelayInfo &aJoiner,
+                                  const uint8_t *        aBuf,
+                                  uint16_t               aLength,
+                                  const uint8_t *        aKek);
+    static void HandleJoinerState(const uint8_t *aJoinerId, JoinerState aState, void *aContext);
+    void        HandleJoinerState(const uint8_t *aJoinerId, JoinerState aState);
+
+    otbrError      SendMeshQuery(const char *   aPath,
+                                 const uint8_t *aPayload,
+                                 uint16_t       aLength,
+                                 const uint8_t *aDestination);
+    static ssize_t SendMeshCoap(const uint8_t *aBuffer,
+                                uint16_t       aLength,
+                                const uint8_t *aIp6,
+                                uint16_t       aPort,
+                                void *         aContext);
+    ssize_t        SendProxyTransmit(const uint8_t *aBuffer, uint16_t aLength, const uint8_t *aIp6, uint16_t aPort);
+    static void    HandleProxyReceive(const Coap::Resource &aResource,
+                                      const Coap::Message & aMessage,
+                                      Coap::Message &       aResponse,
+                                      const uint8_t *       aIp6,
+                                      uint16_t              aPort,
+                                      void *                aContext);
+    static void    HandleEnergyReport(const Coap::Resource &aResource,
+                                      const Coap::Message & aMessage,
+                                      Coap::Message &       aResponse,
+                                      const uint8_t *       aIp6,
+                                      uint16_t              aPort,
+                                      void *                aContext);
+    static void    HandlePanIdConflict(const Coap::Resource &aResource,
+                                       const Coap::Message & aMessage,
+                                       Coap::Message &       aResponse,
+                                       const uint8_t *       aIp6,
+                                       uint16_t              aPort,
+                                       void *                aContext);
+
+    struct JoinerRecord
+    {
+        uint8_t       mEui64[kEui64Len];
+        uint8_t       mJoinerId[SteeringData::kSizeJoinerId];
+        JoinerState   mState;
+        unsigned long mStartTime;
+        unsigned long mFinishTime;
+    };
+
+    typedef std::map<uint64_t, JoinerRecord> JoinerRecordMap;
+
+    mbedtls_net_context      mSslClientFd;
+    mbedtls_ssl_context      mSsl;
+    mbedtls_entropy_context  mEntropy;
+    mbedtls_ctr_drbg_context mDrbg;
+    mbedtls_ssl_config       mSslConf;
+    bool                     mDtlsInitDone;
+    bool                     mIsTimerSet;
+    unsigned long            mTimerIntermediate;
+    unsigned long            mTimerFinal;
+
+    Coap::Agent *    mCoapAgent;
+    ManagementClient mManagementClient;
+    uint16_t         mCoapToken;
+    Coap::Resource   mRelayReceiveHandler;
+    Coap::Resource   mProxyReceiveHandler;
+
+    // The mesh agent exchanges TMF messages with the routers, tunneled through the UDP proxy of the border agent.
+    Coap::Agent *  mMeshAgent;
+    Coap::Resource mEnergyReportHandler;
+    Coap::Resource mPanIdConflictHandler;
+    ChannelSurvey  mChannelSurvey;
 
     uint8_t  mPskcBin[OT_PSKC_LENGTH];
+    char     mAgentHost[kIPAddrNameBufSize];
+    char     mAgentPort[kPortNameBufSize];
+    int      mConnectRetryCount;
     int      mPetitionRetryCount;
+    int      mReconnectCount;
     uint16_t mCommissionerSessionId;
 
-    JoinerSession *mJoinerSession;
-    int            mJoinerSessionClientFd;
-    uint16_t       mJoinerUdpPort;
-    uint8_t        mJoinerIid[8];
-    uint16_t       mJoinerRouterLocator;
+    bool          mIsRetryPending;
+    unsigned long mRetryTime;
+    unsigned long mStartTime;
+    unsigned long mTimeToActive;
+
+    JoinerSessionManager mJoinerSessions;
+    JoinerRecordMap      mJoinerRecords;
+    JoinerStateHandler   mJoinerStateHandler;
+    void *               mJoinerStateContext;
+    SteeringData         mSteeringData;
+    bool                 mIsSteeringDataDirty;
 
     int     mKeepAliveRate;
     timeval mLastKeepAliveTime;
     int     mKeepAliveTxCount;
     int     mKeepAliveRxCount;
 
-    int mNumFinializeJoiners;
-
-    static const uint16_t kPortJoinerSession;
-    static const uint8_t  kSeed[];
-    static const int      kCipherSuites[];
-    static const char     kCommissionerId[];
-    static const int      kCoapResponseWaitSecond;
-    static const int      kCoapResponseRetryTime;
+    static const uint8_t kSeed[];
+    static const int     kCipherSuites[];
+    static const char    kCommissionerId[];
+    static const int     kCoapResponseWaitSecond;
+    static const int     kCoapResponseRetryTime;
 };
 
 } // namespace otbr
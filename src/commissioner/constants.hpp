@@ -47,9 +47,13 @@ enum
 {
     kSizeMaxPacket = 1500, ///< max size of a network packet
 
-    kPetitionAttemptDelay = 5, ///< delay between failed attempts to petition
+    kPetitionAttemptDelay = 5, ///< seconds of delay before the first retry, doubled on each further retry
 
-    kPetitionMaxRetry = 2, ///< max retry for petition
+    kPetitionAttemptDelayMax = 60, ///< max seconds of delay between retries
+
+    kPetitionMaxRetry = 5, ///< max retry for petition
+
+    kConnectMaxRetry = 3, ///< max retry for dtls handshake with the border agent
 
     kSteeringDefaultLength = 15, ///< Default size of steering data
 
@@ -77,6 +81,23 @@ enum
     kMbedDtlsHandshakeMaxTimeout = 60000, ///< dtls handshake min timeout
 
     kKEKSize = 32, ///< key encrypted key(KEK) size
+
+    kJoinerIidLength = 8, ///< joiner IID length in bytes
+
+    kJoinerSessionMaxDefault = 8, ///< default max number of joiners commissioned at the same time
+
+    kJoinerSessionTimeoutDefault = 120, ///< default seconds a joiner is allowed to take before being dropped
+
+    kJoinerSessionLinger = 5, ///< seconds a finalized joiner session is kept for the joiner to close dtls
+
+    kPortTmf = 61631, ///< UDP port of the Thread Management Framework
+
+    kMaxScanTargets = 16, ///< max number of routers addressed by an energy scan or PAN ID query
+
+    kEnergyScanCount    = 2,  ///< energy measurements per channel
+    kEnergyScanPeriod   = 32, ///< milliseconds between energy measurements
+    kEnergyScanDuration = 32, ///< milliseconds of each energy measurement
+    kChannelSurveyWait  = 5,  ///< seconds to wait for reports after the routers finish scanning
 };
 
 } // namespace otbr
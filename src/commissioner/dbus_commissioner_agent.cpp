@@ -0,0 +1,62 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the d-bus agent of the commissioner daemon.
+ */
+
+#include "commissioner/dbus_commissioner_agent.hpp"
+
+#include "common/code_utils.hpp"
+#include "dbus/common/constants.hpp"
+
+namespace otbr {
+namespace DBus {
+
+DBusCommissionerAgent::DBusCommissionerAgent(Commissioner &aCommissioner)
+    : mCommissioner(aCommissioner)
+{
+}
+
+otbrError DBusCommissionerAgent::Init(void)
+{
+    otbrError error;
+
+    SuccessOrExit(error = Connect(OTBR_DBUS_SERVER_PREFIX OTBR_DBUS_COMMISSIONER_NAME));
+    mCommissionerObject =
+        std::unique_ptr<DBusCommissionerObject>(new DBusCommissionerObject(GetConnection(), mCommissioner));
+    SetObject(mCommissionerObject.get());
+    error = mCommissionerObject->Init();
+
+exit:
+    return error;
+}
+
+} // namespace DBus
+} // namespace otbr
@@ -0,0 +1,77 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the d-bus agent of the commissioner daemon.
+ */
+
+#ifndef OTBR_COMMISSIONER_DBUS_COMMISSIONER_AGENT_HPP_
+#define OTBR_COMMISSIONER_DBUS_COMMISSIONER_AGENT_HPP_
+
+#include <memory>
+
+#include "commissioner/commissioner.hpp"
+#include "commissioner/dbus_commissioner_object.hpp"
+#include "dbus/server/dbus_agent_base.hpp"
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class owns the system bus connection of the commissioner daemon.
+ *
+ */
+class DBusCommissionerAgent : public DBusAgentBase
+{
+public:
+    /**
+     * The constructor of the commissioner d-bus agent.
+     *
+     * @param[in]       aCommissioner   The commissioner.
+     *
+     */
+    explicit DBusCommissionerAgent(Commissioner &aCommissioner);
+
+    /**
+     * This method initializes the d-bus agent.
+     *
+     * @returns The intialization error.
+     *
+     */
+    otbrError Init(void);
+
+private:
+    Commissioner &                          mCommissioner;
+    std::unique_ptr<DBusCommissionerObject> mCommissionerObject;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_COMMISSIONER_DBUS_COMMISSIONER_AGENT_HPP_
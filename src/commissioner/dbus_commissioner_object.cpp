@@ -0,0 +1,182 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the d-bus object of the commissioner daemon.
+ */
+
+#include "commissioner/dbus_commissioner_object.hpp"
+
+#include <errno.h>
+#include <inttypes.h>
+
+#include "commissioner/arguments.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "dbus/common/constants.hpp"
+
+using std::placeholders::_1;
+
+static void Uint64ToEui64(uint64_t aValue, uint8_t *aEui64)
+{
+    for (int i = otbr::kEui64Len - 1; i >= 0; i--)
+    {
+        aEui64[i] = static_cast<uint8_t>(aValue & 0xff);
+        aValue >>= 8;
+    }
+}
+
+static uint64_t Eui64ToUint64(const uint8_t *aEui64)
+{
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < otbr::kEui64Len; i++)
+    {
+        value = (value << 8) | aEui64[i];
+    }
+
+    return value;
+}
+
+static otError ConvertErrno(int aErrno)
+{
+    otError error;
+
+    switch (aErrno)
+    {
+    case EEXIST:
+        error = OT_ERROR_ALREADY;
+        break;
+    case ENOENT:
+        error = OT_ERROR_NOT_FOUND;
+        break;
+    case EINVAL:
+        error = OT_ERROR_INVALID_ARGS;
+        break;
+    default:
+        error = OT_ERROR_FAILED;
+        break;
+    }
+
+    return error;
+}
+
+namespace otbr {
+namespace DBus {
+
+DBusCommissionerObject::DBusCommissionerObject(DBusConnection *aConnection, Commissioner &aCommissioner)
+    : DBusObject(aConnection, OTBR_DBUS_OBJECT_PREFIX OTBR_DBUS_COMMISSIONER_NAME)
+    , mCommissioner(aCommissioner)
+{
+}
+
+otbrError DBusCommissionerObject::Init(void)
+{
+    otbrError error;
+
+    SuccessOrExit(error = DBusObject::Init());
+
+    mCommissioner.SetJoinerStateHandler(&DBusCommissionerObject::HandleJoinerState, this);
+
+    RegisterMethod(OTBR_DBUS_COMMISSIONER_INTERFACE, OTBR_DBUS_ADD_JOINER_METHOD,
+                   std::bind(&DBusCommissionerObject::AddJoinerHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_COMMISSIONER_INTERFACE, OTBR_DBUS_REMOVE_JOINER_METHOD,
+                   std::bind(&DBusCommissionerObject::RemoveJoinerHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_COMMISSIONER_INTERFACE, OTBR_DBUS_COMMISSIONER_STATUS_METHOD,
+                   std::bind(&DBusCommissionerObject::StatusHandler, this, _1));
+
+exit:
+    return error;
+}
+
+void DBusCommissionerObject::AddJoinerHandler(DBusRequest &aRequest)
+{
+    uint64_t    eui64Value;
+    std::string pskd;
+    auto        args = std::tie(eui64Value, pskd);
+    uint8_t     eui64[kEui64Len];
+    otError     error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(CheckPSKd(pskd.c_str()), error = OT_ERROR_INVALID_ARGS);
+
+    Uint64ToEui64(eui64Value, eui64);
+    VerifyOrExit(mCommissioner.AddJoiner(eui64, pskd.c_str()) == OTBR_ERROR_NONE, error = ConvertErrno(errno));
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusCommissionerObject::RemoveJoinerHandler(DBusRequest &aRequest)
+{
+    uint64_t eui64Value;
+    auto     args = std::tie(eui64Value);
+    uint8_t  eui64[kEui64Len];
+    otError  error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    Uint64ToEui64(eui64Value, eui64);
+    VerifyOrExit(mCommissioner.RemoveJoiner(eui64) == OTBR_ERROR_NONE, error = ConvertErrno(errno));
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusCommissionerObject::StatusHandler(DBusRequest &aRequest)
+{
+    std::string state        = mCommissioner.GetStateName();
+    uint32_t    timeToActive = static_cast<uint32_t>(mCommissioner.GetTimeToActive());
+    uint32_t    pending      = static_cast<uint32_t>(mCommissioner.GetNumJoiners(kJoinerStatePending));
+    uint32_t    joining      = static_cast<uint32_t>(mCommissioner.GetNumJoiners(kJoinerStateJoining));
+    uint32_t    finalized    = static_cast<uint32_t>(mCommissioner.GetNumJoiners(kJoinerStateFinalized));
+    uint32_t    failed       = static_cast<uint32_t>(mCommissioner.GetNumJoiners(kJoinerStateFailed));
+
+    aRequest.Reply(std::tie(state, timeToActive, pending, joining, finalized, failed));
+}
+
+void DBusCommissionerObject::HandleJoinerState(const uint8_t *aEui64, JoinerState aState, void *aContext)
+{
+    static_cast<DBusCommissionerObject *>(aContext)->HandleJoinerState(aEui64, aState);
+}
+
+void DBusCommissionerObject::HandleJoinerState(const uint8_t *aEui64, JoinerState aState)
+{
+    uint64_t    eui64 = Eui64ToUint64(aEui64);
+    std::string state = JoinerStateToString(aState);
+
+    if (Signal(OTBR_DBUS_COMMISSIONER_INTERFACE, OTBR_DBUS_JOINER_STATE_CHANGED_SIGNAL, std::tie(eui64, state)) !=
+        OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to signal joiner %016" PRIx64 " %s", eui64, state.c_str());
+    }
+}
+
+} // namespace DBus
+} // namespace otbr
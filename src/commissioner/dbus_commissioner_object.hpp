@@ -0,0 +1,90 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the d-bus object of the commissioner daemon.
+ */
+
+#ifndef OTBR_COMMISSIONER_DBUS_COMMISSIONER_OBJECT_HPP_
+#define OTBR_COMMISSIONER_DBUS_COMMISSIONER_OBJECT_HPP_
+
+#include <string>
+
+#include "commissioner/commissioner.hpp"
+#include "dbus/server/dbus_object.hpp"
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class exposes the joiners of a long-running commissioner session on d-bus.
+ *
+ * Methods of interface OTBR_DBUS_COMMISSIONER_INTERFACE:
+ *   - AddJoiner(t eui64, s pskd)
+ *   - RemoveJoiner(t eui64)
+ *   - Status() -> (s state, u timeToActive, u pending, u joining, u finalized, u failed)
+ *
+ * Signal JoinerStateChanged(t eui64, s state) is emitted when a joiner makes progress.
+ *
+ */
+class DBusCommissionerObject : public DBusObject
+{
+public:
+    /**
+     * The constructor of the d-bus commissioner object.
+     *
+     * @param[in]   aConnection     The dbus connection.
+     * @param[in]   aCommissioner   The commissioner.
+     *
+     */
+    DBusCommissionerObject(DBusConnection *aConnection, Commissioner &aCommissioner);
+
+    /**
+     * This method initializes the d-bus commissioner object.
+     *
+     * @returns The initialization error.
+     *
+     */
+    otbrError Init(void) override;
+
+private:
+    void AddJoinerHandler(DBusRequest &aRequest);
+    void RemoveJoinerHandler(DBusRequest &aRequest);
+    void StatusHandler(DBusRequest &aRequest);
+
+    static void HandleJoinerState(const uint8_t *aEui64, JoinerState aState, void *aContext);
+    void        HandleJoinerState(const uint8_t *aEui64, JoinerState aState);
+
+    Commissioner &mCommissioner;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_COMMISSIONER_DBUS_COMMISSIONER_OBJECT_HPP_
@@ -0,0 +1,193 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the commissioning latency metrics of joiners
+ */
+
+#include "commissioner/joiner_metrics.hpp"
+
+#include <string.h>
+
+#include "commissioner/utils.hpp"
+
+namespace otbr {
+
+LatencyHistogram::LatencyHistogram(void)
+    : mCount(0)
+    , mMin(0)
+    , mMax(0)
+    , mSum(0)
+{
+    memset(mBuckets, 0, sizeof(mBuckets));
+}
+
+void LatencyHistogram::Add(unsigned long aValue)
+{
+    unsigned int bucket = 0;
+
+    while (bucket < kNumBuckets - 1 && aValue >= GetBucketBound(bucket))
+    {
+        bucket++;
+    }
+
+    mBuckets[bucket]++;
+    mMin = (mCount == 0 ? aValue : Utils::Min(mMin, aValue));
+    mMax = Utils::Max(mMax, aValue);
+    mSum += aValue;
+    mCount++;
+}
+
+unsigned long LatencyHistogram::GetBucketBound(unsigned int aBucket)
+{
+    return aBucket < kNumBuckets - 1 ? (1UL << aBucket) : 0;
+}
+
+unsigned long LatencyHistogram::GetPercentile(unsigned int aPercent) const
+{
+    unsigned long target = (mCount * aPercent + 99) / 100;
+    unsigned long seen   = 0;
+    unsigned long value  = mMax;
+
+    for (unsigned int i = 0; i < kNumBuckets - 1; i++)
+    {
+        seen += mBuckets[i];
+
+        if (seen >= target && seen > 0)
+        {
+            value = Utils::Min(GetBucketBound(i), mMax);
+            break;
+        }
+    }
+
+    return value;
+}
+
+JoinerMetrics::JoinerMetrics(void)
+{
+    memset(mNumFailed, 0, sizeof(mNumFailed));
+}
+
+const char *JoinerMetrics::GetPhaseName(Phase aPhase)
+{
+    static const char *const kPhaseNames[] = {"relay", "handshake", "join-finalize", "entrust", "total"};
+
+    return aPhase < kNumPhases ? kPhaseNames[aPhase] : "unknown";
+}
+
+void JoinerMetrics::Record(const JoinerSession &aSession)
+{
+    int milestone;
+
+    for (milestone = JoinerSession::kMilestoneFirstReply; milestone < JoinerSession::kNumMilestones; milestone++)
+    {
+        JoinerSession::Milestone begin = static_cast<JoinerSession::Milestone>(milestone - 1);
+        JoinerSession::Milestone end   = static_cast<JoinerSession::Milestone>(milestone);
+
+        if (!aSession.HasReached(end))
+        {
+            break;
+        }
+
+        mHistograms[milestone - 1].Add(aSession.GetMilestoneTime(end) - aSession.GetMilestoneTime(begin));
+    }
+
+    if (milestone == JoinerSession::kNumMilestones)
+    {
+        mHistograms[kPhaseTotal].Add(aSession.GetMilestoneTime(JoinerSession::kMilestoneKekSent) -
+                                     aSession.GetMilestoneTime(JoinerSession::kMilestoneCreated));
+    }
+    else
+    {
+        mNumFailed[milestone - 1]++;
+    }
+}
+
+void JoinerMetrics::WriteSummary(FILE *aStream) const
+{
+    fprintf(aStream, "%-14s %8s %8s %8s %8s %8s %8s %8s %8s\n", "phase(ms)", "count", "failed", "min", "mean", "p50",
+            "p90", "p99", "max");
+
+    for (int i = 0; i < kNumPhases; i++)
+    {
+        const LatencyHistogram &histogram = mHistograms[i];
+
+        fprintf(aStream, "%-14s %8lu %8lu %8lu %8lu %8lu %8lu %8lu %8lu\n", GetPhaseName(static_cast<Phase>(i)),
+                histogram.GetCount(), mNumFailed[i], histogram.GetMin(), histogram.GetMean(),
+                histogram.GetPercentile(50), histogram.GetPercentile(90), histogram.GetPercentile(99),
+                histogram.GetMax());
+    }
+}
+
+void JoinerMetrics::WriteJson(FILE *aStream) const
+{
+    fprintf(aStream, "{\"unit\":\"ms\",\"phases\":{");
+
+    for (int i = 0; i < kNumPhases; i++)
+    {
+        const LatencyHistogram &histogram = mHistograms[i];
+        bool                    first     = true;
+
+        fprintf(aStream,
+                "%s\"%s\":{\"count\":%lu,\"failed\":%lu,\"min\":%lu,\"mean\":%lu,\"p50\":%lu,\"p90\":%lu,\"p99\":%lu,"
+                "\"max\":%lu,\"buckets\":[",
+                i ? "," : "", GetPhaseName(static_cast<Phase>(i)), histogram.GetCount(), mNumFailed[i],
+                histogram.GetMin(), histogram.GetMean(), histogram.GetPercentile(50), histogram.GetPercentile(90),
+                histogram.GetPercentile(99), histogram.GetMax());
+
+        // Only non-empty buckets are listed, "lt" of the overflow bucket is null.
+        for (unsigned int bucket = 0; bucket < LatencyHistogram::kNumBuckets; bucket++)
+        {
+            unsigned long bound = LatencyHistogram::GetBucketBound(bucket);
+
+            if (histogram.GetBucketCount(bucket) == 0)
+            {
+                continue;
+            }
+
+            if (bound != 0)
+            {
+                fprintf(aStream, "%s{\"lt\":%lu,\"count\":%lu}", first ? "" : ",", bound,
+                        histogram.GetBucketCount(bucket));
+            }
+            else
+            {
+                fprintf(aStream, "%s{\"lt\":null,\"count\":%lu}", first ? "" : ",", histogram.GetBucketCount(bucket));
+            }
+
+            first = false;
+        }
+
+        fprintf(aStream, "]}");
+    }
+
+    fprintf(aStream, "}}\n");
+}
+
+} // namespace otbr
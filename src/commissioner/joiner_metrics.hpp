@@ -0,0 +1,208 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file is the header for the commissioning latency metrics of joiners
+ */
+
+#ifndef OTBR_COMMISSIONER_JOINER_METRICS_HPP_
+#define OTBR_COMMISSIONER_JOINER_METRICS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "commissioner/joiner_session.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a latency histogram with power-of-two millisecond buckets.
+ *
+ */
+class LatencyHistogram
+{
+public:
+    enum
+    {
+        kNumBuckets = 18, ///< Bucket i counts values below 2^i ms, the last bucket counts the overflow.
+    };
+
+    LatencyHistogram(void);
+
+    /**
+     * This method adds a sample.
+     *
+     * @param[in]   aValue      The latency in milliseconds.
+     *
+     */
+    void Add(unsigned long aValue);
+
+    /**
+     * This method returns the number of samples.
+     *
+     */
+    unsigned long GetCount(void) const { return mCount; }
+
+    /**
+     * This method returns the smallest sample, 0 if there is no sample.
+     *
+     */
+    unsigned long GetMin(void) const { return mCount ? mMin : 0; }
+
+    /**
+     * This method returns the largest sample, 0 if there is no sample.
+     *
+     */
+    unsigned long GetMax(void) const { return mMax; }
+
+    /**
+     * This method returns the mean of the samples, 0 if there is no sample.
+     *
+     */
+    unsigned long GetMean(void) const { return mCount ? static_cast<unsigned long>(mSum / mCount) : 0; }
+
+    /**
+     * This method estimates a percentile from the buckets.
+     *
+     * @param[in]   aPercent    The percentile, between 0 and 100.
+     *
+     * @returns The upper bound of the bucket holding the percentile, capped by the largest sample.
+     *
+     */
+    unsigned long GetPercentile(unsigned int aPercent) const;
+
+    /**
+     * This method returns the number of samples in a bucket.
+     *
+     * @param[in]   aBucket     The bucket index, less than kNumBuckets.
+     *
+     */
+    unsigned long GetBucketCount(unsigned int aBucket) const { return mBuckets[aBucket]; }
+
+    /**
+     * This method returns the exclusive upper bound of a bucket in milliseconds, 0 for the overflow bucket.
+     *
+     * @param[in]   aBucket     The bucket index, less than kNumBuckets.
+     *
+     */
+    static unsigned long GetBucketBound(unsigned int aBucket);
+
+private:
+    unsigned long mBuckets[kNumBuckets];
+    unsigned long mCount;
+    unsigned long mMin;
+    unsigned long mMax;
+    uint64_t      mSum;
+};
+
+/**
+ * This class aggregates the time joiners spend in each phase of commissioning.
+ *
+ */
+class JoinerMetrics
+{
+public:
+    /**
+     * This enumeration represents the phases of commissioning a joiner.
+     *
+     * Phase i starts at milestone i and ends at milestone i + 1 of JoinerSession.
+     *
+     */
+    enum Phase
+    {
+        kPhaseRelay = 0,    ///< RELAY_RX round trip, from the first record to the first reply.
+        kPhaseHandshake,    ///< EC-JPAKE handshake.
+        kPhaseJoinFinalize, ///< From the handshake to JOIN_FIN.req.
+        kPhaseEntrust,      ///< From JOIN_FIN.req to the KEK sent.
+        kPhaseTotal,        ///< From the first record to the KEK sent.
+        kNumPhases,
+    };
+
+    JoinerMetrics(void);
+
+    /**
+     * This method records the milestones of a joiner session.
+     *
+     * A session not reaching kMilestoneKekSent is counted as failed in the first phase it did not complete.
+     *
+     * @param[in]   aSession    The joiner session.
+     *
+     */
+    void Record(const JoinerSession &aSession);
+
+    /**
+     * This method returns the histogram of a phase.
+     *
+     * @param[in]   aPhase      The phase.
+     *
+     */
+    const LatencyHistogram &GetHistogram(Phase aPhase) const { return mHistograms[aPhase]; }
+
+    /**
+     * This method returns the number of joiners failed during a phase.
+     *
+     * @param[in]   aPhase      The phase.
+     *
+     */
+    unsigned long GetNumFailed(Phase aPhase) const { return mNumFailed[aPhase]; }
+
+    /**
+     * This method returns the name of a phase.
+     *
+     * @param[in]   aPhase      The phase.
+     *
+     */
+    static const char *GetPhaseName(Phase aPhase);
+
+    /**
+     * This method writes a human readable summary of each phase.
+     *
+     * @param[in]   aStream     The stream to write to.
+     *
+     */
+    void WriteSummary(FILE *aStream) const;
+
+    /**
+     * This method writes the metrics as a JSON object.
+     *
+     * @param[in]   aStream     The stream to write to.
+     *
+     */
+    void WriteJson(FILE *aStream) const;
+
+private:
+    LatencyHistogram mHistograms[kNumPhases];
+    unsigned long    mNumFailed[kNumPhases];
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMISSIONER_JOINER_METRICS_HPP_
@@ -33,22 +33,58 @@
 
 #include "commissioner/joiner_session.hpp"
 
+#include <arpa/inet.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
 #include "agent/uris.hpp"
 #include "commissioner/utils.hpp"
+#include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "common/tlv.hpp"
 
 namespace otbr {
 
 JoinerSession::JoinerSession(uint16_t aInternalServerPort, const char *aPskdAscii)
     : mDtlsServer(Dtls::Server::Create(aInternalServerPort, JoinerSession::HandleSessionChange, this))
+    , mDtlsSession(NULL)
     , mCoapAgent(Coap::Agent::Create(JoinerSession::SendCoap, this))
     , mJoinerFinalizeHandler(OT_URI_PATH_JOINER_FINALIZE, HandleJoinerFinalize, this)
     , mNeedAppendKek(false)
+    , mSessionClosed(false)
+    , mRelayFd(-1)
+    , mMilestonesReached(0)
 {
+    sockaddr_in addr;
+    int         fd = -1;
+
+    MarkMilestone(kMilestoneCreated);
     mDtlsServer->SetPSK(reinterpret_cast<const uint8_t *>(aPskdAscii), static_cast<uint8_t>(strlen(aPskdAscii)));
-    mDtlsServer->Start();
     mCoapAgent->AddResource(mJoinerFinalizeHandler);
+    SuccessOrExit(mDtlsServer->Start());
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = htons(aInternalServerPort);
+
+    VerifyOrExit((fd = socket(AF_INET, SOCK_DGRAM, 0)) >= 0);
+    SuccessOrExit(connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)));
+    mRelayFd = fd;
+    fd       = -1;
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    if (mRelayFd < 0)
+    {
+        otbrLog(OTBR_LOG_ERR, "joiner session on port %u: %s", aInternalServerPort, strerror(errno));
+    }
 }
 
 void JoinerSession::HandleSessionChange(Dtls::Session &aSession, Dtls::Session::State aState, void *aContext)
@@ -61,14 +97,18 @@ void JoinerSession::HandleSessionChange(Dtls::Session &aSession, Dtls::Session::
         memcpy(joinerSession->mKek, aSession.GetKek(), sizeof(joinerSession->mKek));
         aSession.SetDataHandler(JoinerSession::FeedCoap, joinerSession);
         joinerSession->mDtlsSession = &aSession;
+        joinerSession->MarkMilestone(kMilestoneReady);
         break;
 
     case Dtls::Session::kStateClose:
-        break;
-
     case Dtls::Session::kStateError:
     case Dtls::Session::kStateEnd:
-        joinerSession->mDtlsSession = NULL;
+    case Dtls::Session::kStateExpired:
+        if (joinerSession->mDtlsSession == &aSession)
+        {
+            joinerSession->mDtlsSession   = NULL;
+            joinerSession->mSessionClosed = true;
+        }
         break;
     default:
         break;
@@ -118,6 +158,7 @@ void JoinerSession::HandleJoinerFinalize(const Coap::Resource &aResource,
     Tlv *          responseTlv = reinterpret_cast<Tlv *>(payload);
 
     joinerSession->mNeedAppendKek = true;
+    joinerSession->MarkMilestone(kMilestoneJoinFinalize);
 
     responseTlv->SetType(Meshcop::kState);
     responseTlv->SetValue(static_cast<uint8_t>(Meshcop::kStateAccepted));
@@ -145,6 +186,36 @@ void JoinerSession::UpdateFdSet(fd_set & aReadFdSet,
                                 timeval &aTimeout)
 {
     mDtlsServer->UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
+
+    if (mRelayFd >= 0)
+    {
+        FD_SET(mRelayFd, &aReadFdSet);
+        aMaxFd = Utils::Max(mRelayFd, aMaxFd);
+    }
+}
+
+ssize_t JoinerSession::Write(const uint8_t *aBuf, uint16_t aLength)
+{
+    ssize_t ret = send(mRelayFd, aBuf, aLength, 0);
+
+    if (ret < 0)
+    {
+        otbrLog(OTBR_LOG_ERR, "relay receive, send() fails with %d", errno);
+    }
+
+    return ret;
+}
+
+ssize_t JoinerSession::Read(uint8_t *aBuf, uint16_t aLength)
+{
+    ssize_t ret = recv(mRelayFd, aBuf, aLength, MSG_DONTWAIT);
+
+    if (ret > 0)
+    {
+        MarkMilestone(kMilestoneFirstReply);
+    }
+
+    return ret;
 }
 
 bool JoinerSession::NeedAppendKek(void)
@@ -155,6 +226,18 @@ bool JoinerSession::NeedAppendKek(void)
 void JoinerSession::MarkKekSent(void)
 {
     mNeedAppendKek = false;
+    MarkMilestone(kMilestoneKekSent);
+}
+
+void JoinerSession::MarkMilestone(Milestone aMilestone)
+{
+    VerifyOrExit(!HasReached(aMilestone));
+
+    mMilestonesReached |= (1U << aMilestone);
+    mMilestoneTimes[aMilestone] = GetNow();
+
+exit:
+    return;
 }
 
 void JoinerSession::GetKek(uint8_t *aBuf, size_t aBufSize)
@@ -164,6 +247,11 @@ void JoinerSession::GetKek(uint8_t *aBuf, size_t aBufSize)
 
 JoinerSession::~JoinerSession()
 {
+    if (mRelayFd >= 0)
+    {
+        close(mRelayFd);
+    }
+
     Dtls::Server::Destroy(mDtlsServer);
     Coap::Agent::Destroy(mCoapAgent);
 }
@@ -48,6 +48,20 @@ namespace otbr {
 class JoinerSession
 {
 public:
+    /**
+     * This enumeration represents the milestones of commissioning a joiner, in the order they are reached.
+     *
+     */
+    enum Milestone
+    {
+        kMilestoneCreated = 0,  ///< Session created on the first RELAY_RX from the joiner.
+        kMilestoneFirstReply,   ///< First record relayed back to the joiner.
+        kMilestoneReady,        ///< EC-JPAKE handshake completed.
+        kMilestoneJoinFinalize, ///< JOIN_FIN.req received.
+        kMilestoneKekSent,      ///< KEK appended to a RELAY_TX, the joiner is entrusted.
+        kNumMilestones,
+    };
+
     /**
      * The constructor to initialize JoinerSession
      *
@@ -57,6 +71,14 @@ public:
      */
     JoinerSession(uint16_t aInternalServerPort, const char *aPskdAscii);
 
+    /**
+     * This method returns whether the session was successfully created
+     *
+     * @returns whether both the internal dtls server and the relay socket are ready
+     *
+     */
+    bool IsValid(void) const { return mRelayFd >= 0; }
+
     /**
      * This method updates the fd_set and timeout @p aTimeout should
      * only be updated if session has pending process in less than its current value.
@@ -108,12 +130,60 @@ public:
      */
     ssize_t Write(const uint8_t *aBuf, uint16_t aLength);
 
+    /**
+     * This method reads one datagram the dtls server sent to the joiner, without blocking
+     * @param[out] aBuf         data buffer to read into
+     * @param[in]  aLength      size of the data buffer
+     *
+     * @returns on success returns the number of bytes read,
+     *          on failure or if there is no pending datagram returns -1
+     */
+    ssize_t Read(uint8_t *aBuf, uint16_t aLength);
+
+    /**
+     * This method returns the fd of the socket relaying data between the joiner and the dtls server
+     *
+     * @returns the relay socket fd
+     *
+     */
+    int GetRelayFd(void) const { return mRelayFd; }
+
+    /**
+     * This method returns whether the dtls session with the joiner has been closed after being established
+     *
+     * @returns whether the dtls session has been closed
+     *
+     */
+    bool IsSessionClosed(void) const { return mSessionClosed; }
+
+    /**
+     * This method returns whether a milestone has been reached
+     *
+     * @param[in]  aMilestone   the milestone
+     *
+     * @returns whether @p aMilestone has been reached
+     *
+     */
+    bool HasReached(Milestone aMilestone) const { return (mMilestonesReached & (1U << aMilestone)) != 0; }
+
+    /**
+     * This method returns when a milestone was first reached
+     *
+     * @param[in]  aMilestone   the milestone
+     *
+     * @returns timestamp in milliseconds, only meaningful if @p aMilestone has been reached
+     *
+     */
+    unsigned long GetMilestoneTime(Milestone aMilestone) const { return mMilestoneTimes[aMilestone]; }
+
     ~JoinerSession();
 
 private:
     JoinerSession(const JoinerSession &);
     JoinerSession &operator=(const JoinerSession &);
 
+    void MarkMilestone(Milestone aMilestone);
+
     static void    HandleSessionChange(Dtls::Session &aSession, Dtls::Session::State aState, void *aContext);
     static ssize_t SendCoap(const uint8_t *aBuffer,
                             uint16_t       aLength,
@@ -135,6 +205,11 @@ private:
     Coap::Agent *  mCoapAgent;
     Coap::Resource mJoinerFinalizeHandler;
     bool           mNeedAppendKek;
+    bool           mSessionClosed;
+    int            mRelayFd;
+
+    unsigned int  mMilestonesReached;
+    unsigned long mMilestoneTimes[kNumMilestones];
 };
 
 } // namespace otbr
@@ -0,0 +1,345 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the manager of concurrent joiner sessions
+ */
+
+#include "commissioner/joiner_session_manager.hpp"
+
+#include <errno.h>
+#include <string.h>
+
+#include "commissioner/utils.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/time.hpp"
+#include "utils/strcpy_utils.hpp"
+
+namespace otbr {
+
+const char *JoinerStateToString(JoinerState aState)
+{
+    const char *name = "unknown";
+
+    switch (aState)
+    {
+    case kJoinerStatePending:
+        name = "pending";
+        break;
+    case kJoinerStateJoining:
+        name = "joining";
+        break;
+    case kJoinerStateFinalized:
+        name = "finalized";
+        break;
+    case kJoinerStateFailed:
+        name = "failed";
+        break;
+    }
+
+    return name;
+}
+
+JoinerSessionManager::JoinerSessionManager(RelayTransmitHandler aHandler,
+                                           void *               aContext,
+                                           int                  aMaxSessions,
+                                           int                  aSessionTimeout)
+    : mHandler(aHandler)
+    , mContext(aContext)
+    , mStateHandler(NULL)
+    , mStateContext(NULL)
+    , mSessionTimeout(aSessionTimeout)
+    , mSlotsInUse(static_cast<size_t>(aMaxSessions), false)
+    , mNextSession(0)
+    , mPeakNumSessions(0)
+    , mNumFinalizedJoiners(0)
+{
+    mPskd[0] = '\0';
+}
+
+void JoinerSessionManager::SetPskd(const char *aPskdAscii)
+{
+    strcpy_safe(mPskd, sizeof(mPskd), aPskdAscii);
+}
+
+void JoinerSessionManager::AddJoiner(const uint8_t *aJoinerId, const char *aPskdAscii)
+{
+    mJoinerPskds[GetJoinerKey(aJoinerId)] = aPskdAscii;
+}
+
+void JoinerSessionManager::RemoveJoiner(const uint8_t *aJoinerId)
+{
+    mJoinerPskds.erase(GetJoinerKey(aJoinerId));
+}
+
+void JoinerSessionManager::SetJoinerStateHandler(JoinerStateHandler aHandler, void *aContext)
+{
+    mStateHandler = aHandler;
+    mStateContext = aContext;
+}
+
+uint64_t JoinerSessionManager::GetJoinerKey(const uint8_t *aJoinerId)
+{
+    uint64_t key = 0;
+
+    for (size_t i = 0; i < kJoinerIidLength; i++)
+    {
+        key = (key << 8) | aJoinerId[i];
+    }
+
+    return key;
+}
+
+uint64_t JoinerSessionManager::GetKey(const uint8_t *aIid)
+{
+    // The joiner IID is the joiner id with the universal/local bit flipped.
+    return GetJoinerKey(aIid) ^ (static_cast<uint64_t>(0x02) << 56);
+}
+
+void JoinerSessionManager::NotifyJoinerState(uint64_t aKey, JoinerState aState)
+{
+    uint8_t joinerId[kJoinerIidLength];
+
+    VerifyOrExit(mStateHandler != NULL);
+
+    for (size_t i = 0; i < sizeof(joinerId); i++)
+    {
+        joinerId[sizeof(joinerId) - 1 - i] = static_cast<uint8_t>(aKey >> (8 * i));
+    }
+
+    mStateHandler(joinerId, aState, mStateContext);
+
+exit:
+    return;
+}
+
+JoinerSessionManager::Joiner *JoinerSessionManager::FindOrCreate(const JoinerRelayInfo &aJoiner)
+{
+    Joiner *            joiner = NULL;
+    uint64_t            key    = GetKey(aJoiner.mIid);
+    JoinerMap::iterator it     = mSessions.find(key);
+    PskdMap::iterator   pskdIt = mJoinerPskds.find(key);
+    const char *        pskd   = (pskdIt != mJoinerPskds.end() ? pskdIt->second.c_str() : mPskd);
+    int                 slot;
+
+    if (it != mSessions.end())
+    {
+        joiner = &it->second;
+        // The joiner router may change between messages.
+        joiner->mInfo = aJoiner;
+        ExitNow();
+    }
+
+    VerifyOrExit(pskd[0] != '\0', otbrLog(OTBR_LOG_WARNING, "joiner sessions: no pskd for joiner %016llx",
+                                           static_cast<unsigned long long>(key)));
+
+    for (slot = 0; slot < static_cast<int>(mSlotsInUse.size()); slot++)
+    {
+        if (!mSlotsInUse[static_cast<size_t>(slot)])
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(slot < static_cast<int>(mSlotsInUse.size()),
+                 otbrLog(OTBR_LOG_INFO, "joiner sessions: %d in progress, deferring new joiner", GetNumSessions()));
+
+    {
+        Joiner newJoiner;
+
+        newJoiner.mInfo       = aJoiner;
+        newJoiner.mSession    = new JoinerSession(static_cast<uint16_t>(kPortJoinerSession + slot), pskd);
+        newJoiner.mSlot       = slot;
+        newJoiner.mExpiration = GetNow() + static_cast<unsigned long>(mSessionTimeout) * 1000;
+        newJoiner.mFinalized  = false;
+
+        VerifyOrExit(newJoiner.mSession->IsValid(), delete newJoiner.mSession);
+
+        mSlotsInUse[static_cast<size_t>(slot)] = true;
+        joiner                                 = &mSessions.insert(std::make_pair(key, newJoiner)).first->second;
+        mPeakNumSessions                       = Utils::Max(mPeakNumSessions, GetNumSessions());
+        otbrLog(OTBR_LOG_INFO, "joiner sessions: new joiner %016llx on port %d, %d in progress",
+                static_cast<unsigned long long>(key), kPortJoinerSession + slot, GetNumSessions());
+        NotifyJoinerState(key, kJoinerStateJoining);
+    }
+
+exit:
+    return joiner;
+}
+
+otbrError JoinerSessionManager::HandleRelayReceive(const JoinerRelayInfo &aJoiner,
+                                                   const uint8_t *        aBuffer,
+                                                   uint16_t               aLength)
+{
+    otbrError error  = OTBR_ERROR_ERRNO;
+    Joiner *  joiner = FindOrCreate(aJoiner);
+
+    VerifyOrExit(joiner != NULL, errno = EBUSY);
+    VerifyOrExit(joiner->mSession->Write(aBuffer, aLength) >= 0);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+void JoinerSessionManager::RemoveExpired(void)
+{
+    unsigned long now = GetNow();
+
+    for (JoinerMap::iterator it = mSessions.begin(); it != mSessions.end();)
+    {
+        Joiner &joiner  = it->second;
+        bool    expired = static_cast<long>(now - joiner.mExpiration) >= 0;
+        bool    closed  = joiner.mSession->IsSessionClosed();
+
+        // A session closed before being finalized frees its slot at once, for the joiners deferred meanwhile.
+        if (expired || closed)
+        {
+            otbrLog(OTBR_LOG_INFO, "joiner sessions: remove joiner %016llx, %s",
+                    static_cast<unsigned long long>(it->first),
+                    joiner.mFinalized ? "finalized" : (closed ? "closed" : "timeout"));
+            if (!joiner.mFinalized)
+            {
+                mMetrics.Record(*joiner.mSession);
+                NotifyJoinerState(it->first, kJoinerStateFailed);
+            }
+            mSlotsInUse[static_cast<size_t>(joiner.mSlot)] = false;
+            delete joiner.mSession;
+            it = mSessions.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void JoinerSessionManager::UpdateFdSet(fd_set & aReadFdSet,
+                                       fd_set & aWriteFdSet,
+                                       fd_set & aErrorFdSet,
+                                       int &    aMaxFd,
+                                       timeval &aTimeout)
+{
+    unsigned long now     = GetNow();
+    unsigned long timeout = GetTimestamp(aTimeout);
+
+    RemoveExpired();
+
+    for (JoinerMap::iterator it = mSessions.begin(); it != mSessions.end(); ++it)
+    {
+        Joiner &joiner = it->second;
+
+        joiner.mSession->UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
+        timeout = Utils::Min(timeout, GetTimestamp(aTimeout));
+
+        if (static_cast<long>(joiner.mExpiration - (now + timeout)) < 0)
+        {
+            timeout = joiner.mExpiration - now;
+        }
+    }
+
+    aTimeout.tv_sec  = static_cast<time_t>(timeout / 1000);
+    aTimeout.tv_usec = static_cast<suseconds_t>((timeout % 1000) * 1000);
+}
+
+void JoinerSessionManager::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+{
+    JoinerMap::iterator it;
+
+    VerifyOrExit(!mSessions.empty());
+
+    // Start from a different session each round, so that no joiner is always served first.
+    mNextSession = (mNextSession + 1) % static_cast<unsigned int>(mSessions.size());
+    it           = mSessions.begin();
+
+    for (unsigned int i = 0; i < mNextSession; i++)
+    {
+        ++it;
+    }
+
+    for (size_t count = 0; count < mSessions.size(); count++, ++it)
+    {
+        if (it == mSessions.end())
+        {
+            it = mSessions.begin();
+        }
+
+        it->second.mSession->Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
+
+        if (FD_ISSET(it->second.mSession->GetRelayFd(), &aReadFdSet))
+        {
+            RelayTransmit(it->second);
+        }
+    }
+
+exit:
+    return;
+}
+
+void JoinerSessionManager::RelayTransmit(Joiner &aJoiner)
+{
+    uint8_t        buffer[kSizeMaxPacket];
+    uint8_t        kek[kKEKSize];
+    const uint8_t *appendKek = NULL;
+    ssize_t        n         = aJoiner.mSession->Read(buffer, sizeof(buffer));
+
+    VerifyOrExit(n > 0);
+
+    if (aJoiner.mSession->NeedAppendKek())
+    {
+        aJoiner.mSession->GetKek(kek, sizeof(kek));
+        aJoiner.mSession->MarkKekSent();
+        appendKek = kek;
+
+        if (!aJoiner.mFinalized)
+        {
+            aJoiner.mFinalized  = true;
+            aJoiner.mExpiration = GetNow() + kJoinerSessionLinger * 1000;
+            mNumFinalizedJoiners++;
+            mMetrics.Record(*aJoiner.mSession);
+            NotifyJoinerState(GetKey(aJoiner.mInfo.mIid), kJoinerStateFinalized);
+        }
+    }
+
+    mHandler(aJoiner.mInfo, buffer, static_cast<uint16_t>(n), appendKek, mContext);
+
+exit:
+    return;
+}
+
+JoinerSessionManager::~JoinerSessionManager(void)
+{
+    for (JoinerMap::iterator it = mSessions.begin(); it != mSessions.end(); ++it)
+    {
+        delete it->second.mSession;
+    }
+}
+
+} // namespace otbr
@@ -0,0 +1,289 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file is the header for the manager of concurrent joiner sessions
+ */
+
+#ifndef OTBR_COMMISSIONER_JOINER_SESSION_MANAGER_HPP_
+#define OTBR_COMMISSIONER_JOINER_SESSION_MANAGER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <sys/select.h>
+
+#include "commissioner/constants.hpp"
+#include "commissioner/joiner_metrics.hpp"
+#include "commissioner/joiner_session.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This structure represents the relay information of a joiner.
+ *
+ */
+struct JoinerRelayInfo
+{
+    uint8_t  mIid[kJoinerIidLength]; ///< Joiner IID.
+    uint16_t mUdpPort;               ///< Joiner UDP port.
+    uint16_t mRouterLocator;         ///< Joiner router locator.
+};
+
+/**
+ * This enumeration represents the commissioning state of a joiner.
+ *
+ */
+enum JoinerState
+{
+    kJoinerStatePending = 0, ///< Joiner provisioned but not seen yet.
+    kJoinerStateJoining,     ///< DTLS session with the joiner in progress.
+    kJoinerStateFinalized,   ///< KEK sent to the joiner.
+    kJoinerStateFailed,      ///< Joiner timed out before being finalized.
+};
+
+/**
+ * This function converts a joiner state to a string.
+ *
+ * @param[in]   aState      The joiner state.
+ *
+ * @returns The name of @p aState.
+ *
+ */
+const char *JoinerStateToString(JoinerState aState);
+
+/**
+ * This class manages the dtls sessions of joiners being commissioned at the same time.
+ *
+ * Each joiner, keyed by its IID, gets its own JoinerSession with an independent dtls state.
+ *
+ */
+class JoinerSessionManager
+{
+public:
+    /**
+     * This function pointer is called to send a RELAY_TX to a joiner.
+     *
+     * @param[in]   aJoiner     The relay information of the joiner.
+     * @param[in]   aBuffer     The dtls record to relay.
+     * @param[in]   aLength     Length of the dtls record.
+     * @param[in]   aKek        A pointer to the KEK to append, NULL if the KEK should not be appended.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    typedef void (*RelayTransmitHandler)(const JoinerRelayInfo &aJoiner,
+                                         const uint8_t *        aBuffer,
+                                         uint16_t               aLength,
+                                         const uint8_t *        aKek,
+                                         void *                 aContext);
+
+    /**
+     * This function pointer is called when the commissioning state of a joiner changes.
+     *
+     * @param[in]   aJoinerId   The joiner id.
+     * @param[in]   aState      The new state of the joiner.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    typedef void (*JoinerStateHandler)(const uint8_t *aJoinerId, JoinerState aState, void *aContext);
+
+    /**
+     * The constructor to initialize JoinerSessionManager
+     *
+     * @param[in]    aHandler           handler to send RELAY_TX
+     * @param[in]    aContext           context of @p aHandler
+     * @param[in]    aMaxSessions       max number of joiners handled at the same time
+     * @param[in]    aSessionTimeout    seconds a joiner is allowed to take before its session is dropped
+     *
+     */
+    JoinerSessionManager(RelayTransmitHandler aHandler, void *aContext, int aMaxSessions, int aSessionTimeout);
+
+    /**
+     * This method sets the pskd used by joiners
+     *
+     * @param[in]    aPskdAscii         ascii form of pskd
+     *
+     */
+    void SetPskd(const char *aPskdAscii);
+
+    /**
+     * This method sets the pskd of a specific joiner, which takes precedence over the one set by SetPskd().
+     *
+     * @param[in]    aJoinerId          joiner id
+     * @param[in]    aPskdAscii         ascii form of pskd
+     *
+     */
+    void AddJoiner(const uint8_t *aJoinerId, const char *aPskdAscii);
+
+    /**
+     * This method removes the pskd of a specific joiner, a session in progress is not affected.
+     *
+     * @param[in]    aJoinerId          joiner id
+     *
+     */
+    void RemoveJoiner(const uint8_t *aJoinerId);
+
+    /**
+     * This method sets the handler notified of joiner state changes
+     *
+     * @param[in]    aHandler           handler of joiner state changes, NULL to disable notification
+     * @param[in]    aContext           context of @p aHandler
+     *
+     */
+    void SetJoinerStateHandler(JoinerStateHandler aHandler, void *aContext);
+
+    /**
+     * This method relays a dtls record received from a joiner to the joiner's session,
+     * a new session is created if this is a new joiner and the concurrency cap is not reached.
+     *
+     * @param[in]    aJoiner            relay information of the joiner
+     * @param[in]    aBuffer            dtls record from the joiner
+     * @param[in]    aLength            length of the dtls record
+     *
+     * @retval OTBR_ERROR_NONE      Successfully relayed the record.
+     * @retval OTBR_ERROR_ERRNO     Failed to relay the record, or too many joiners in progress.
+     *
+     */
+    otbrError HandleRelayReceive(const JoinerRelayInfo &aJoiner, const uint8_t *aBuffer, uint16_t aLength);
+
+    /**
+     * This method updates the fd_set and timeout for mainloop.
+     *
+     * @param[inout]    aReadFdSet      A reference to fd_set for polling read.
+     * @param[inout]    aWriteFdSet     A reference to fd_set for polling write.
+     * @param[inout]    aErrorFdSet     A reference to fd_set for polling error.
+     * @param[inout]    aMaxFd          A reference to the current max fd in @p aReadFdSet and @p aWriteFdSet.
+     * @param[inout]    aTimeout        A reference to the timeout.
+     *
+     */
+    void UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, fd_set &aErrorFdSet, int &aMaxFd, timeval &aTimeout);
+
+    /**
+     * This method performs the sessions processing.
+     *
+     * Sessions are served round robin, and at most one record is relayed per session in each call.
+     *
+     * @param[in]   aReadFdSet          A reference to fd_set ready for reading.
+     * @param[in]   aWriteFdSet         A reference to fd_set ready for writing.
+     * @param[in]   aErrorFdSet         A reference to fd_set with error occurred.
+     *
+     */
+    void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet);
+
+    /**
+     * This method returns the number of joiners in progress
+     *
+     * @returns number of joiner sessions
+     *
+     */
+    int GetNumSessions(void) const { return static_cast<int>(mSessions.size()); }
+
+    /**
+     * This method returns the max number of joiners in progress at the same time so far
+     *
+     * @returns peak number of joiner sessions
+     *
+     */
+    int GetPeakNumSessions(void) const { return mPeakNumSessions; }
+
+    /**
+     * This method gets number of joiners finalized
+     *
+     * @returns number of KEKs sent to joiners
+     *
+     */
+    int GetNumFinalizedJoiners(void) const { return mNumFinalizedJoiners; }
+
+    /**
+     * This method returns the latency metrics of joiners finalized or timed out so far
+     *
+     * @returns the joiner metrics
+     *
+     */
+    const JoinerMetrics &GetMetrics(void) const { return mMetrics; }
+
+    /**
+     * This method converts a joiner id to the key used to index joiners
+     *
+     * @param[in]    aJoinerId          joiner id
+     *
+     * @returns the joiner id as a big endian integer
+     *
+     */
+    static uint64_t GetJoinerKey(const uint8_t *aJoinerId);
+
+    ~JoinerSessionManager(void);
+
+private:
+    struct Joiner
+    {
+        JoinerRelayInfo mInfo;
+        JoinerSession * mSession;
+        int             mSlot;
+        unsigned long   mExpiration;
+        bool            mFinalized;
+    };
+
+    typedef std::map<uint64_t, Joiner>      JoinerMap;
+    typedef std::map<uint64_t, std::string> PskdMap;
+
+    JoinerSessionManager(const JoinerSessionManager &);
+    JoinerSessionManager &operator=(const JoinerSessionManager &);
+
+    static uint64_t GetKey(const uint8_t *aIid);
+
+    Joiner *FindOrCreate(const JoinerRelayInfo &aJoiner);
+    void    RemoveExpired(void);
+    void    RelayTransmit(Joiner &aJoiner);
+    void    NotifyJoinerState(uint64_t aKey, JoinerState aState);
+
+    RelayTransmitHandler mHandler;
+    void *               mContext;
+    JoinerStateHandler   mStateHandler;
+    void *               mStateContext;
+    int                  mSessionTimeout;
+    char                 mPskd[kPSKdLength + 1];
+    PskdMap              mJoinerPskds;
+
+    JoinerMap         mSessions;
+    std::vector<bool> mSlotsInUse;
+    unsigned int      mNextSession;
+    int               mPeakNumSessions;
+    int               mNumFinalizedJoiners;
+    JoinerMetrics     mMetrics;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMISSIONER_JOINER_SESSION_MANAGER_HPP_
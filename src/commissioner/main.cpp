@@ -33,80 +33,249 @@
 
 #include "openthread-br/config.h"
 
+#include <errno.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include "commissioner/arguments.hpp"
 #include "commissioner/commissioner.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "utils/hex.hpp"
 
+#if OTBR_ENABLE_DBUS_SERVER
+#include "commissioner/dbus_commissioner_agent.hpp"
+#endif
+
 using namespace otbr;
 
+static const int             kLogBufferSize   = 256; ///< Logs buffered for the log writer thread.
+static volatile sig_atomic_t sShouldTerminate = 0;
+
 static void HandleSignal(int aSignal)
 {
     signal(aSignal, SIG_DFL);
+    sShouldTerminate = 1;
+}
+
+static void WriteJoinerMetrics(const JoinerMetrics &aMetrics, const char *aJsonPath)
+{
+    const LatencyHistogram &total     = aMetrics.GetHistogram(JoinerMetrics::kPhaseTotal);
+    unsigned long           numFailed = 0;
+
+    for (int i = 0; i < JoinerMetrics::kNumPhases; i++)
+    {
+        numFailed += aMetrics.GetNumFailed(static_cast<JoinerMetrics::Phase>(i));
+    }
+
+    if (total.GetCount() > 0 || numFailed > 0)
+    {
+        aMetrics.WriteSummary(stdout);
+    }
+
+    if (aJsonPath != NULL)
+    {
+        FILE *file = fopen(aJsonPath, "w");
+
+        VerifyOrExit(file != NULL, otbrLog(OTBR_LOG_ERR, "failed to open %s: %s", aJsonPath, strerror(errno)));
+        aMetrics.WriteJson(file);
+        fclose(file);
+    }
+
+exit:
+    return;
+}
+
+/**
+ * This function sends the energy scan and PAN ID query to each scan target.
+ *
+ * @returns The milliseconds to wait for the reports.
+ *
+ */
+static unsigned long StartChannelSurvey(Commissioner &aCommissioner, const CommissionerArgs &aArgs)
+{
+    // ff03::2, all routers of the mesh.
+    static const uint8_t kAllRouters[OTBR_IP6_ADDRESS_SIZE] = {0xff, 0x03, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02};
+
+    int numChannels = 0;
+
+    for (uint32_t mask = aArgs.mScanChannelMask; mask != 0; mask &= mask - 1)
+    {
+        numChannels++;
+    }
+
+    for (int i = 0; i < (aArgs.mNumScanTargets > 0 ? aArgs.mNumScanTargets : 1); i++)
+    {
+        const uint8_t *target = (aArgs.mNumScanTargets > 0 ? aArgs.mScanTargets[i] : kAllRouters);
+
+        if (aArgs.mEnergyScan &&
+            aCommissioner.EnergyScan(aArgs.mScanChannelMask, kEnergyScanCount, kEnergyScanPeriod, kEnergyScanDuration,
+                                     target) != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "failed to send energy scan: %s", strerror(errno));
+        }
+
+        if (aArgs.mPanIdQuery &&
+            aCommissioner.PanIdQuery(aArgs.mScanChannelMask, aArgs.mPanId, target) != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "failed to send PAN ID query: %s", strerror(errno));
+        }
+    }
+
+    return static_cast<unsigned long>(numChannels) * kEnergyScanCount * (kEnergyScanPeriod + kEnergyScanDuration) +
+           kChannelSurveyWait * 1000UL;
 }
 
 int main(int argc, char **argv)
 {
-    otbrError        error;
-    CommissionerArgs args;
-    int              ret = 0;
+    otbrError                     error;
+    CommissionerArgs              args;
+    std::vector<JoinerCredential> joiners;
+    int                           ret = 0;
 
     SuccessOrExit(error = ParseArgs(argc, argv, args));
 
+    if (args.mJoinerCsv != NULL)
+    {
+        SuccessOrExit(error = LoadJoinerCsv(args.mJoinerCsv, joiners));
+    }
+
     otbrLogInit("Commissioner", args.mDebugLevel, true);
+    otbrLogEnableAsync(kLogBufferSize, OTBR_LOG_OVERFLOW_DROP);
     signal(SIGTERM, HandleSignal);
     signal(SIGINT, HandleSignal);
 
     srand(static_cast<unsigned int>(time(0)));
 
     {
-        Commissioner commissioner(args.mPSKc, args.mKeepAliveInterval);
-        bool         joinerSetDone = false;
+        Commissioner  commissioner(args.mPSKc, args.mKeepAliveInterval, args.mMaxJoinerSessions,
+                                   args.mJoinerSessionTimeout);
+        bool          surveyOnly     = (args.mPSKd == NULL && args.mJoinerCsv == NULL && !args.mDaemon);
+        bool          surveyStarted  = false;
+        unsigned long surveyDeadline = 0;
+        bool          joinerSetDone  = (args.mJoinerCsv != NULL || args.mDaemon || surveyOnly);
+        int           numJoiners     = 0;
+#if OTBR_ENABLE_DBUS_SERVER
+        DBus::DBusCommissionerAgent dbusAgent(commissioner);
 
-        commissioner.InitDtls(args.mAgentHost, args.mAgentPort);
+        if (args.mDaemon)
+        {
+            SuccessOrExit(error = dbusAgent.Init());
+        }
+#endif
 
-        do
+        for (size_t i = 0; i < joiners.size(); i++)
         {
-            ret = commissioner.TryDtlsHandshake();
-        } while (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE);
+            if (commissioner.AddJoiner(joiners[i].mEui64, joiners[i].mPSKd) == OTBR_ERROR_NONE)
+            {
+                numJoiners++;
+            }
+            else
+            {
+                otbrLog(OTBR_LOG_WARNING, "skip joiner at entry %zu of %s: %s", i, args.mJoinerCsv, strerror(errno));
+            }
+        }
 
-        if (commissioner.IsValid())
+        ret = commissioner.InitDtls(args.mAgentHost, args.mAgentPort);
+        if (ret != 0)
         {
-            commissioner.CommissionerPetition();
+            otbrLog(OTBR_LOG_ERR, "InitDtls() failed: -0x%04x", -ret);
         }
+        // There is nothing to reconnect to without a valid agent address.
+        VerifyOrExit(ret != MBEDTLS_ERR_SSL_BAD_INPUT_DATA, error = OTBR_ERROR_DTLS);
 
-        while (commissioner.IsValid())
+        // The daemon keeps one session, a session lost or given up is reconnected after the retry delay.
+        while (commissioner.IsValid() || args.mDaemon)
         {
             int            maxFd   = -1;
-            struct timeval timeout = {10, 0};
+            struct timeval timeout = {60, 0};
             int            rval;
 
             fd_set readFdSet;
             fd_set writeFdSet;
             fd_set errorFdSet;
 
+            if (args.mDaemon && !commissioner.IsValid())
+            {
+                commissioner.Reconnect();
+            }
+
             FD_ZERO(&readFdSet);
             FD_ZERO(&writeFdSet);
             FD_ZERO(&errorFdSet);
             commissioner.UpdateFdSet(readFdSet, writeFdSet, errorFdSet, maxFd, timeout);
+            if (surveyStarted && surveyOnly)
+            {
+                long remaining = static_cast<long>(surveyDeadline - GetNow());
+
+                remaining       = (remaining > 0 ? remaining : 0);
+                timeout.tv_sec  = remaining / 1000;
+                timeout.tv_usec = (remaining % 1000) * 1000;
+            }
+#if OTBR_ENABLE_DBUS_SERVER
+            if (args.mDaemon)
+            {
+                dbusAgent.UpdateFdSet(readFdSet, writeFdSet, errorFdSet, maxFd, timeout);
+            }
+#endif
             rval = select(maxFd + 1, &readFdSet, &writeFdSet, &errorFdSet, &timeout);
+            if (sShouldTerminate)
+            {
+                commissioner.Cancel();
+                break;
+            }
             if (rval < 0)
             {
                 otbrLog(OTBR_LOG_ERR, "select() failed", strerror(errno));
                 break;
             }
             commissioner.Process(readFdSet, writeFdSet, errorFdSet);
+#if OTBR_ENABLE_DBUS_SERVER
+            if (args.mDaemon)
+            {
+                dbusAgent.Process(readFdSet, writeFdSet, errorFdSet);
+            }
+#endif
             if (commissioner.IsCommissionerAccepted() && !joinerSetDone)
             {
                 commissioner.SetJoiner(args.mPSKd, args.mSteeringData);
                 joinerSetDone = true;
             }
+            if (commissioner.IsCommissionerAccepted() && !surveyStarted && (args.mEnergyScan || args.mPanIdQuery))
+            {
+                surveyDeadline = GetNow() + StartChannelSurvey(commissioner, args);
+                surveyStarted  = true;
+            }
+            if (surveyStarted && surveyOnly && static_cast<long>(surveyDeadline - GetNow()) <= 0)
+            {
+                otbrLog(OTBR_LOG_INFO, "channel survey done");
+                break;
+            }
+            if (!args.mDaemon && numJoiners > 0 && commissioner.GetNumJoiners(kJoinerStateFinalized) == numJoiners)
+            {
+                otbrLog(OTBR_LOG_INFO, "all joiners finalized");
+                break;
+            }
+        }
+
+        otbrLog(OTBR_LOG_INFO, "time-to-active=%lums joiners-finalized=%d peak-joiner-sessions=%d",
+                commissioner.GetTimeToActive(), commissioner.GetNumFinalizedJoiners(),
+                commissioner.GetPeakNumJoinerSessions());
+
+        if (args.mJoinerCsv != NULL)
+        {
+            commissioner.WriteJoinerSummary(stdout);
+        }
+
+        WriteJoinerMetrics(commissioner.GetJoinerMetrics(), args.mMetricsJson);
+
+        if (surveyStarted)
+        {
+            commissioner.GetChannelSurvey().WriteReport(stdout);
         }
     }
 
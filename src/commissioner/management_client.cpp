@@ -0,0 +1,242 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the commissioner management request client.
+ */
+
+#include "commissioner/management_client.hpp"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <arpa/inet.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+ManagementClient::ManagementClient(Coap::Agent &aAgent, size_t aMaxInFlight, unsigned long aTimeout)
+    : mAgent(aAgent)
+    , mMaxInFlight(aMaxInFlight > 0 ? aMaxInFlight : 1)
+    , mTimeout(aTimeout)
+    , mNextToken(static_cast<uint16_t>(rand()))
+{
+}
+
+otbrError ManagementClient::SendRequest(const char *    aPath,
+                                        const uint8_t * aPayload,
+                                        uint16_t        aLength,
+                                        ResponseHandler aHandler,
+                                        void *          aContext)
+{
+    otbrError ret = OTBR_ERROR_NONE;
+    Request   request;
+
+    request.mPath = aPath;
+    request.mPayload.assign(aPayload, aPayload + aLength);
+    request.mHandler  = aHandler;
+    request.mContext  = aContext;
+    request.mDeadline = 0;
+
+    if (mInFlight.size() < mMaxInFlight && mQueue.empty())
+    {
+        ret = Transmit(request);
+    }
+    else
+    {
+        otbrLog(OTBR_LOG_DEBUG, "MGMT %s: queued behind %zu requests", aPath, mInFlight.size() + mQueue.size());
+        mQueue.push_back(request);
+    }
+
+    return ret;
+}
+
+void ManagementClient::SetMaxInFlight(size_t aMaxInFlight)
+{
+    mMaxInFlight = aMaxInFlight > 0 ? aMaxInFlight : 1;
+    SendQueued();
+}
+
+uint16_t ManagementClient::AllocateToken(void)
+{
+    // The window is far smaller than the token space, so this always terminates quickly.
+    do
+    {
+        ++mNextToken;
+    } while (mInFlight.count(mNextToken));
+
+    return mNextToken;
+}
+
+otbrError ManagementClient::Transmit(Request &aRequest)
+{
+    otbrError      ret     = OTBR_ERROR_ERRNO;
+    uint16_t       token   = AllocateToken();
+    uint16_t       tokenBe = htons(token);
+    Coap::Message *message;
+
+    message = mAgent.NewMessage(Coap::kTypeConfirmable, Coap::kCodePost, reinterpret_cast<const uint8_t *>(&tokenBe),
+                                sizeof(tokenBe));
+    VerifyOrExit(message != NULL, errno = ENOMEM);
+
+    message->SetPath(aRequest.mPath);
+    message->SetPayload(aRequest.mPayload.data(), static_cast<uint16_t>(aRequest.mPayload.size()));
+
+    aRequest.mDeadline = GetNow() + mTimeout;
+    mInFlight[token]   = aRequest;
+
+    ret = mAgent.Send(*message, NULL, 0, HandleResponse, this);
+    mAgent.FreeMessage(message);
+
+    if (ret != OTBR_ERROR_NONE)
+    {
+        mInFlight.erase(token);
+    }
+
+exit:
+    if (ret != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "MGMT %s: failed to send: %s", aRequest.mPath, strerror(errno));
+    }
+
+    return ret;
+}
+
+void ManagementClient::SendQueued(void)
+{
+    while (mInFlight.size() < mMaxInFlight && !mQueue.empty())
+    {
+        Request request = mQueue.front();
+
+        mQueue.pop_front();
+
+        if (Transmit(request) != OTBR_ERROR_NONE && request.mHandler != NULL)
+        {
+            request.mHandler(NULL, request.mContext);
+        }
+    }
+}
+
+void ManagementClient::HandleResponse(const Coap::Message &aMessage, void *aContext)
+{
+    static_cast<ManagementClient *>(aContext)->HandleResponse(aMessage);
+}
+
+void ManagementClient::HandleResponse(const Coap::Message &aMessage)
+{
+    uint8_t              length;
+    const uint8_t *      token = aMessage.GetToken(length);
+    uint16_t             key;
+    RequestMap::iterator it;
+    Request              request;
+
+    VerifyOrExit(length == sizeof(key), otbrLog(OTBR_LOG_WARNING, "MGMT response with unexpected token length"));
+
+    memcpy(&key, token, sizeof(key));
+    key = ntohs(key);
+    it  = mInFlight.find(key);
+    VerifyOrExit(it != mInFlight.end(), otbrLog(OTBR_LOG_INFO, "MGMT response for expired token %04x", key));
+
+    request = it->second;
+    mInFlight.erase(it);
+
+    // Refill the window before running the handler, which may queue further requests.
+    SendQueued();
+
+    if (request.mHandler != NULL)
+    {
+        request.mHandler(&aMessage, request.mContext);
+    }
+
+exit:
+    return;
+}
+
+void ManagementClient::UpdateFdSet(timeval &aTimeout) const
+{
+    unsigned long now = GetNow();
+
+    for (RequestMap::const_iterator it = mInFlight.begin(); it != mInFlight.end(); ++it)
+    {
+        long remaining = static_cast<long>(it->second.mDeadline - now);
+
+        if (remaining < 0)
+        {
+            remaining = 0;
+        }
+
+        if (static_cast<unsigned long>(remaining) < GetTimestamp(aTimeout))
+        {
+            aTimeout.tv_sec  = remaining / 1000;
+            aTimeout.tv_usec = (remaining % 1000) * 1000;
+        }
+    }
+}
+
+void ManagementClient::Process(void)
+{
+    unsigned long        now = GetNow();
+    std::vector<Request> expired;
+
+    for (RequestMap::iterator it = mInFlight.begin(); it != mInFlight.end();)
+    {
+        if (static_cast<long>(it->second.mDeadline - now) <= 0)
+        {
+            otbrLog(OTBR_LOG_WARNING, "MGMT %s: token %04x timed out", it->second.mPath, it->first);
+            expired.push_back(it->second);
+            mInFlight.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    SendQueued();
+
+    for (std::vector<Request>::iterator it = expired.begin(); it != expired.end(); ++it)
+    {
+        if (it->mHandler != NULL)
+        {
+            it->mHandler(NULL, it->mContext);
+        }
+    }
+}
+
+void ManagementClient::Clear(void)
+{
+    mInFlight.clear();
+    mQueue.clear();
+}
+
+} // namespace otbr
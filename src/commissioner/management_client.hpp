@@ -0,0 +1,186 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file is the header for the commissioner management request client.
+ */
+
+#ifndef OTBR_COMMISSIONER_MANAGEMENT_CLIENT_HPP_
+#define OTBR_COMMISSIONER_MANAGEMENT_CLIENT_HPP_
+
+#include "openthread-br/config.h"
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+#include "common/coap.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class pipelines the MeshCoP management requests (MGMT_GET/SET, COMM_KA, ...) of a commissioner session.
+ *
+ * Up to a bounded number of confirmable requests are outstanding at the same time, responses are matched to their
+ * requests by CoAP token. Requests beyond the window are queued and sent in order as responses arrive.
+ *
+ */
+class ManagementClient
+{
+public:
+    /**
+     * This function pointer is called when a management request completes.
+     *
+     * @param[in]   aResponse   A pointer to the response, NULL if the request timed out or failed to send.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    typedef void (*ResponseHandler)(const Coap::Message *aResponse, void *aContext);
+
+    enum
+    {
+        kDefaultMaxInFlight = 4,     ///< Default number of outstanding requests.
+        kDefaultTimeout     = 10000, ///< Default response timeout in milliseconds.
+    };
+
+    /**
+     * The constructor to initialize a management client.
+     *
+     * @param[in]   aAgent          A reference to the CoAP agent of the commissioner session.
+     * @param[in]   aMaxInFlight    The max number of outstanding requests, at least 1.
+     * @param[in]   aTimeout        The response timeout of each request in milliseconds.
+     *
+     */
+    ManagementClient(Coap::Agent & aAgent,
+                     size_t        aMaxInFlight = kDefaultMaxInFlight,
+                     unsigned long aTimeout     = kDefaultTimeout);
+
+    /**
+     * This method sends a management request, or queues it if the window is full.
+     *
+     * @param[in]   aPath       The CoAP Uri Path, which must remain valid until the request completes.
+     * @param[in]   aPayload    A pointer to the TLVs of the request.
+     * @param[in]   aLength     Number of bytes in @p aPayload.
+     * @param[in]   aHandler    A function pointer to be called when the request completes, may be NULL.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     * @retval OTBR_ERROR_NONE      Successfully sent or queued the request.
+     * @retval OTBR_ERROR_ERRNO     Failed to send the request, @p aHandler is not called.
+     *
+     */
+    otbrError SendRequest(const char *    aPath,
+                          const uint8_t * aPayload,
+                          uint16_t        aLength,
+                          ResponseHandler aHandler,
+                          void *          aContext);
+
+    /**
+     * This method sets the max number of outstanding requests.
+     *
+     * @param[in]   aMaxInFlight    The max number of outstanding requests, at least 1.
+     *
+     */
+    void SetMaxInFlight(size_t aMaxInFlight);
+
+    /**
+     * This method returns the max number of outstanding requests.
+     *
+     */
+    size_t GetMaxInFlight(void) const { return mMaxInFlight; }
+
+    /**
+     * This method returns the number of requests waiting for response.
+     *
+     */
+    size_t GetNumInFlight(void) const { return mInFlight.size(); }
+
+    /**
+     * This method returns the number of requests waiting for a free slot in the window.
+     *
+     */
+    size_t GetNumQueued(void) const { return mQueue.size(); }
+
+    /**
+     * This method updates the timeout to expire the oldest outstanding request.
+     *
+     * @param[inout]    aTimeout    A reference to the timeout.
+     *
+     */
+    void UpdateFdSet(timeval &aTimeout) const;
+
+    /**
+     * This method expires the outstanding requests that have timed out.
+     *
+     */
+    void Process(void);
+
+    /**
+     * This method drops all outstanding and queued requests without calling their handlers.
+     *
+     */
+    void Clear(void);
+
+private:
+    struct Request
+    {
+        const char *         mPath;
+        std::vector<uint8_t> mPayload;
+        ResponseHandler      mHandler;
+        void *               mContext;
+        unsigned long        mDeadline;
+    };
+
+    typedef std::map<uint16_t, Request> RequestMap;
+
+    ManagementClient(const ManagementClient &);
+    ManagementClient &operator=(const ManagementClient &);
+
+    otbrError Transmit(Request &aRequest);
+    void      SendQueued(void);
+    uint16_t  AllocateToken(void);
+
+    static void HandleResponse(const Coap::Message &aMessage, void *aContext);
+    void        HandleResponse(const Coap::Message &aMessage);
+
+    Coap::Agent &       mAgent;
+    size_t              mMaxInFlight;
+    unsigned long       mTimeout;
+    uint16_t            mNextToken;
+    RequestMap          mInFlight;
+    std::deque<Request> mQueue;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMISSIONER_MANAGEMENT_CLIENT_HPP_
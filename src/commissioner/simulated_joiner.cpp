@@ -0,0 +1,180 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a simulated joiner, commissioned through relayed DTLS records.
+ */
+
+#include "commissioner/simulated_joiner.hpp"
+
+#include <algorithm>
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/time.hpp"
+#include "utils/steering_data.hpp"
+
+namespace otbr {
+
+SimulatedJoiner::SimulatedJoiner(const uint8_t *aEui64, const char *aPskd)
+    : mPskd(aPskd)
+    , mState(kStateIdle)
+    , mStartTime(0)
+    , mHandshakeTime(0)
+    , mFinishTime(0)
+{
+    memcpy(mEui64, aEui64, sizeof(mEui64));
+
+    // The joiner IID is the joiner id with the universal/local bit flipped.
+    SteeringData::ComputeJoinerId(mEui64, mIid);
+    mIid[0] ^= 0x02;
+
+    mbedtls_ssl_init(&mSsl);
+    mbedtls_ssl_config_init(&mConf);
+    mbedtls_ctr_drbg_init(&mDrbg);
+    mbedtls_entropy_init(&mEntropy);
+}
+
+SimulatedJoiner::~SimulatedJoiner(void)
+{
+    mbedtls_ssl_free(&mSsl);
+    mbedtls_ssl_config_free(&mConf);
+    mbedtls_ctr_drbg_free(&mDrbg);
+    mbedtls_entropy_free(&mEntropy);
+}
+
+otbrError SimulatedJoiner::Start(void)
+{
+    static const int kCipherSuites[] = {MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8, 0};
+    int              ret;
+
+    mState     = kStateFailed;
+    mStartTime = GetNow();
+
+    SuccessOrExit(ret = mbedtls_ctr_drbg_seed(&mDrbg, mbedtls_entropy_func, &mEntropy, mEui64, sizeof(mEui64)));
+    SuccessOrExit(ret = mbedtls_ssl_config_defaults(&mConf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_DATAGRAM,
+                                                    MBEDTLS_SSL_PRESET_DEFAULT));
+    mbedtls_ssl_conf_rng(&mConf, mbedtls_ctr_drbg_random, &mDrbg);
+    mbedtls_ssl_conf_min_version(&mConf, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
+    mbedtls_ssl_conf_max_version(&mConf, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
+    mbedtls_ssl_conf_authmode(&mConf, MBEDTLS_SSL_VERIFY_NONE);
+    mbedtls_ssl_conf_ciphersuites(&mConf, kCipherSuites);
+    SuccessOrExit(ret = mbedtls_ssl_setup(&mSsl, &mConf));
+    mbedtls_ssl_set_bio(&mSsl, this, SimulatedJoiner::Send, SimulatedJoiner::Receive, NULL);
+    mbedtls_ssl_set_timer_cb(&mSsl, &mTimer, mbedtls_timing_set_delay, mbedtls_timing_get_delay);
+    SuccessOrExit(ret = mbedtls_ssl_set_hs_ecjpake_password(&mSsl, reinterpret_cast<const unsigned char *>(mPskd),
+                                                             strlen(mPskd)));
+
+    mState = kStateHandshaking;
+    Run();
+
+exit:
+    if (ret != 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "simulated joiner: mbedtls error -0x%04x", -ret);
+    }
+
+    return mState == kStateFailed ? OTBR_ERROR_DTLS : OTBR_ERROR_NONE;
+}
+
+void SimulatedJoiner::Run(void)
+{
+    int ret;
+
+    VerifyOrExit(mState == kStateHandshaking);
+
+    ret = mbedtls_ssl_handshake(&mSsl);
+
+    if (ret == 0)
+    {
+        // CON POST c/jf
+        static const uint8_t kJoinerFinalize[] = {0x41, 0x02, 0x12, 0x34, 0xaa, 0xb1, 'c', 0x02, 'j', 'f'};
+
+        mHandshakeTime = GetNow();
+        mState         = kStateFinalizing;
+        VerifyOrExit(mbedtls_ssl_write(&mSsl, kJoinerFinalize, sizeof(kJoinerFinalize)) > 0, Fail());
+    }
+    else if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE)
+    {
+        Fail();
+    }
+
+exit:
+    return;
+}
+
+void SimulatedJoiner::HandleRelayTransmit(const uint8_t *aBuffer, uint16_t aLength, bool aHasKek)
+{
+    VerifyOrExit(IsActive());
+
+    mInbox.push_back(std::vector<uint8_t>(aBuffer, aBuffer + aLength));
+
+    if (aHasKek && mState == kStateFinalizing)
+    {
+        mFinishTime = GetNow();
+        mState      = kStateFinalized;
+    }
+
+exit:
+    return;
+}
+
+void SimulatedJoiner::Fail(void)
+{
+    mFinishTime = GetNow();
+    mState      = kStateFailed;
+}
+
+int SimulatedJoiner::Send(void *aContext, const unsigned char *aBuffer, size_t aLength)
+{
+    static_cast<SimulatedJoiner *>(aContext)->mOutbox.push_back(std::vector<uint8_t>(aBuffer, aBuffer + aLength));
+
+    return static_cast<int>(aLength);
+}
+
+int SimulatedJoiner::Receive(void *aContext, unsigned char *aBuffer, size_t aLength)
+{
+    SimulatedJoiner &joiner = *static_cast<SimulatedJoiner *>(aContext);
+    int              ret    = MBEDTLS_ERR_SSL_WANT_READ;
+
+    if (!joiner.mInbox.empty())
+    {
+        std::vector<uint8_t> &record = joiner.mInbox.front();
+
+        ret = static_cast<int>(std::min(record.size(), aLength));
+        memcpy(aBuffer, &record[0], static_cast<size_t>(ret));
+        joiner.mInbox.pop_front();
+    }
+
+    return ret;
+}
+
+} // namespace otbr
@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a simulated joiner, commissioned through relayed DTLS records.
+ */
+
+#ifndef OTBR_COMMISSIONER_SIMULATED_JOINER_HPP_
+#define OTBR_COMMISSIONER_SIMULATED_JOINER_HPP_
+
+#include <deque>
+#include <vector>
+
+#include <stdint.h>
+
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/timing.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class simulates a joiner behind a joiner router.
+ *
+ * The DTLS records of the joiner are queued instead of being sent, the caller relays them to the commissioner and
+ * hands the records relayed back with HandleRelayTransmit().
+ *
+ */
+class SimulatedJoiner
+{
+public:
+    enum
+    {
+        kEui64Length = 8, ///< Length of the EUI64 and of the IID in bytes.
+    };
+
+    enum State
+    {
+        kStateIdle,        ///< Not started.
+        kStateHandshaking, ///< DTLS handshake in progress.
+        kStateFinalizing,  ///< JOIN_FIN.req sent, waiting for the KEK.
+        kStateFinalized,   ///< KEK received.
+        kStateFailed,      ///< Failed or timed out.
+    };
+
+    /**
+     * The constructor to initialize a simulated joiner.
+     *
+     * @param[in]   aEui64  The EUI64 of the joiner.
+     * @param[in]   aPskd   The PSKd of the joiner, which must outlive the joiner.
+     *
+     */
+    SimulatedJoiner(const uint8_t *aEui64, const char *aPskd);
+
+    ~SimulatedJoiner(void);
+
+    /**
+     * This method starts the DTLS handshake.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully started the handshake.
+     * @retval OTBR_ERROR_DTLS  Failed to set up DTLS, the joiner is failed.
+     *
+     */
+    otbrError Start(void);
+
+    /**
+     * This method advances the DTLS handshake with the records received so far, and sends JOIN_FIN.req once done.
+     *
+     */
+    void Run(void);
+
+    /**
+     * This method hands a DTLS record relayed to the joiner.
+     *
+     * @param[in]   aBuffer     The DTLS record.
+     * @param[in]   aLength     Length of the DTLS record.
+     * @param[in]   aHasKek     Whether the KEK was relayed with the record.
+     *
+     */
+    void HandleRelayTransmit(const uint8_t *aBuffer, uint16_t aLength, bool aHasKek);
+
+    /**
+     * This method marks the joiner as failed.
+     *
+     */
+    void Fail(void);
+
+    /**
+     * This method returns the next DTLS record to relay from the joiner.
+     *
+     * @returns A pointer to the record, NULL if there is none.
+     *
+     */
+    const std::vector<uint8_t> *GetNextRecord(void) const { return mOutbox.empty() ? NULL : &mOutbox.front(); }
+
+    /**
+     * This method removes the record returned by GetNextRecord(), once relayed.
+     *
+     */
+    void PopRecord(void) { mOutbox.pop_front(); }
+
+    bool           IsActive(void) const { return mState == kStateHandshaking || mState == kStateFinalizing; }
+    State          GetState(void) const { return mState; }
+    const uint8_t *GetEui64(void) const { return mEui64; }
+    const uint8_t *GetIid(void) const { return mIid; }
+    unsigned long  GetStartTime(void) const { return mStartTime; }
+    unsigned long  GetHandshakeLatency(void) const { return mHandshakeTime - mStartTime; }
+    unsigned long  GetTotalLatency(void) const { return mFinishTime - mStartTime; }
+
+private:
+    SimulatedJoiner(const SimulatedJoiner &);
+    SimulatedJoiner &operator=(const SimulatedJoiner &);
+
+    static int Send(void *aContext, const unsigned char *aBuffer, size_t aLength);
+    static int Receive(void *aContext, unsigned char *aBuffer, size_t aLength);
+
+    const char *                     mPskd;
+    State                            mState;
+    uint8_t                          mEui64[kEui64Length];
+    uint8_t                          mIid[kEui64Length];
+    unsigned long                    mStartTime;
+    unsigned long                    mHandshakeTime;
+    unsigned long                    mFinishTime;
+    mbedtls_ssl_context              mSsl;
+    mbedtls_ssl_config               mConf;
+    mbedtls_ctr_drbg_context         mDrbg;
+    mbedtls_entropy_context          mEntropy;
+    mbedtls_timing_delay_context     mTimer;
+    std::deque<std::vector<uint8_t>> mInbox;
+    std::deque<std::vector<uint8_t>> mOutbox;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMISSIONER_SIMULATED_JOINER_HPP_
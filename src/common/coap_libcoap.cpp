@@ -31,6 +31,8 @@
  *   The file implements the CoAP service.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_COAP
+
 #include "common/coap_libcoap.hpp"
 
 #include <errno.h>
@@ -34,6 +34,8 @@
 #define __APPLE_USE_RFC_3542
 #endif
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_DTLS
+
 #include "common/dtls_mbedtls.hpp"
 
 #include <algorithm>
@@ -56,7 +58,7 @@ static int FromOtbrLogLevel(void)
 {
     int level = 0;
 
-    switch (otbrLogGetLevel())
+    switch (otbrLogGetModuleLevel(OTBR_LOG_MODULE_DTLS))
     {
     case OTBR_LOG_EMERG:
     case OTBR_LOG_ALERT:
@@ -125,7 +127,7 @@ void MbedtlsServer::MbedtlsDebug(int aLevel, const char *aFile, int aLine, const
 
     if (level != 0)
     {
-        otbrLog(aLevel, "DTLS[:%hu] %s:%04d: %s", mPort, aFile, aLine, aMessage);
+        otbrLogDeferred(level, "DTLS[:%hu] %s:%04d: %s", mPort, aFile, aLine, aMessage);
     }
 }
 
@@ -517,6 +519,9 @@ void MbedtlsServer::UpdateFdSet(fd_set & aReadFdSet,
     unsigned long now     = GetNow();
     unsigned long timeout = GetTimestamp(aTimeout);
 
+    // The log level of DTLS may be changed at runtime.
+    mbedtls_debug_set_threshold(FromOtbrLogLevel());
+
     for (SessionSet::iterator it = mSessions.begin(); it != mSessions.end();)
     {
         MbedtlsSession *session = *it;
@@ -532,7 +537,7 @@ void MbedtlsServer::UpdateFdSet(fd_set & aReadFdSet,
         {
             int fd = session->GetFd();
 
-            otbrLog(OTBR_LOG_INFO, "DTLS session[%d] alive.", fd);
+            otbrLogDeferred(OTBR_LOG_INFO, "DTLS session[%d] alive.", fd);
             FD_SET(fd, &aReadFdSet);
 
             if (aMaxFd < fd)
@@ -670,7 +675,7 @@ void MbedtlsServer::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet,
 
         if (FD_ISSET(fd, &aReadFdSet))
         {
-            otbrLog(OTBR_LOG_INFO, "DTLS session [%d] become readable.", fd);
+            otbrLogDeferred(OTBR_LOG_INFO, "DTLS session [%d] become readable.", fd);
             session->Process();
         }
     }
@@ -0,0 +1,364 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements fast text formatting, without locale and without printf.
+ */
+
+#include "common/format.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace Format {
+
+namespace {
+
+enum
+{
+    kMaxDigits    = 20, ///< Max number of decimal digits of a 64-bit integer.
+    kMaxHexDigits = 16, ///< Max number of hex digits of a 64-bit integer.
+    kInvalidHex   = 0xff,
+};
+
+/**
+ * The two hex digits of each byte value, in lower and upper case.
+ *
+ */
+const char kHexPairs[][513] = {
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+    "404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+    "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+    "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+    "a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+    "c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+    "e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+    "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF",
+};
+
+const char kDecimalPairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+const uint8_t kHexValues[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+/**
+ * This function writes the decimal digits of a value backwards, ending right before @p aEnd.
+ *
+ * @returns A pointer to the first digit.
+ *
+ */
+char *WriteDecimalBackwards(uint64_t aValue, char *aEnd)
+{
+    while (aValue >= 100)
+    {
+        const char *pair = &kDecimalPairs[(aValue % 100) * 2];
+
+        aValue /= 100;
+        *--aEnd = pair[1];
+        *--aEnd = pair[0];
+    }
+
+    if (aValue >= 10)
+    {
+        *--aEnd = kDecimalPairs[aValue * 2 + 1];
+        *--aEnd = kDecimalPairs[aValue * 2];
+    }
+    else
+    {
+        *--aEnd = static_cast<char>('0' + aValue);
+    }
+
+    return aEnd;
+}
+
+/**
+ * This function writes the hex digits of a value, padded with zeros to @p aMinDigits digits.
+ *
+ * @returns Number of digits written.
+ *
+ */
+size_t WriteHex(uint64_t aValue, unsigned int aMinDigits, char *aOutput, HexCase aCase)
+{
+    const char *digits    = kHexPairs[aCase];
+    size_t      numDigits = 1;
+
+    while (numDigits < kMaxHexDigits && (aValue >> (numDigits * 4)) != 0)
+    {
+        numDigits++;
+    }
+
+    if (numDigits < aMinDigits)
+    {
+        memset(aOutput, '0', aMinDigits - numDigits);
+        aOutput += aMinDigits - numDigits;
+    }
+
+    // Odd positions of the pair table are the single digits 0 to f.
+    for (size_t i = numDigits; i > 0; i--)
+    {
+        *aOutput++ = digits[((aValue >> ((i - 1) * 4)) & 0xf) * 2 + 1];
+    }
+
+    return numDigits < aMinDigits ? aMinDigits : numDigits;
+}
+
+} // namespace
+
+char *EncodeHex(const uint8_t *aBytes, size_t aLength, char *aHex, HexCase aCase)
+{
+    const char *pairs = kHexPairs[aCase];
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        memcpy(aHex, &pairs[aBytes[i] * 2], 2);
+        aHex += 2;
+    }
+
+    *aHex = '\0';
+
+    return aHex;
+}
+
+int DecodeHex(const char *aHex, size_t aHexLength, uint8_t *aBytes, size_t aBytesLength)
+{
+    size_t   numBytes = (aHexLength + 1) / 2;
+    uint8_t *cur      = aBytes;
+    int      ret      = -1;
+
+    VerifyOrExit(numBytes <= aBytesLength);
+
+    if (aHexLength & 1)
+    {
+        uint8_t value = kHexValues[static_cast<uint8_t>(*aHex++)];
+
+        VerifyOrExit(value != kInvalidHex);
+        *cur++ = value;
+    }
+
+    for (; cur < aBytes + numBytes; aHex += 2)
+    {
+        uint8_t high = kHexValues[static_cast<uint8_t>(aHex[0])];
+        uint8_t low  = kHexValues[static_cast<uint8_t>(aHex[1])];
+
+        // Valid digits are below 16, so one test catches an invalid digit in either position.
+        VerifyOrExit((high | low) < 16);
+        *cur++ = static_cast<uint8_t>((high << 4) | low);
+    }
+
+    ret = static_cast<int>(numBytes);
+
+exit:
+    return ret;
+}
+
+char *FormatUnsigned(uint64_t aValue, char *aOutput)
+{
+    char   digits[kMaxDigits];
+    char * first  = WriteDecimalBackwards(aValue, digits + sizeof(digits));
+    size_t length = static_cast<size_t>(digits + sizeof(digits) - first);
+
+    memcpy(aOutput, first, length);
+    aOutput[length] = '\0';
+
+    return aOutput + length;
+}
+
+char *FormatSigned(int64_t aValue, char *aOutput)
+{
+    if (aValue < 0)
+    {
+        *aOutput++ = '-';
+    }
+
+    // Negating as unsigned is also right for the most negative value.
+    return FormatUnsigned(aValue < 0 ? 0 - static_cast<uint64_t>(aValue) : static_cast<uint64_t>(aValue), aOutput);
+}
+
+char *FormatHex(uint64_t aValue, unsigned int aMinDigits, char *aOutput, HexCase aCase)
+{
+    aOutput += WriteHex(aValue, aMinDigits, aOutput, aCase);
+    *aOutput = '\0';
+
+    return aOutput;
+}
+
+StringBuilder::StringBuilder(char *aBuffer, size_t aSize)
+    : mBuffer(aBuffer)
+    , mSize(aSize)
+    , mLength(0)
+    , mIsTruncated(false)
+{
+    if (mSize > 0)
+    {
+        mBuffer[0] = '\0';
+    }
+}
+
+StringBuilder &StringBuilder::Append(const char *aString)
+{
+    return Append(aString, strlen(aString));
+}
+
+StringBuilder &StringBuilder::Append(const char *aChars, size_t aLength)
+{
+    size_t available = (mSize > mLength ? mSize - mLength - 1 : 0);
+
+    if (aLength > available)
+    {
+        aLength      = available;
+        mIsTruncated = true;
+    }
+
+    memcpy(mBuffer + mLength, aChars, aLength);
+    mLength += aLength;
+
+    if (mSize > 0)
+    {
+        mBuffer[mLength] = '\0';
+    }
+
+    return *this;
+}
+
+StringBuilder &StringBuilder::AppendChar(char aChar)
+{
+    return Append(&aChar, 1);
+}
+
+StringBuilder &StringBuilder::AppendPadded(const char *aText, size_t aLength, unsigned int aMinWidth)
+{
+    while (aMinWidth > aLength)
+    {
+        AppendChar(' ');
+        aMinWidth--;
+    }
+
+    return Append(aText, aLength);
+}
+
+StringBuilder &StringBuilder::AppendUnsigned(uint64_t aValue, unsigned int aMinWidth)
+{
+    char  digits[kMaxDigits];
+    char *first = WriteDecimalBackwards(aValue, digits + sizeof(digits));
+
+    return AppendPadded(first, static_cast<size_t>(digits + sizeof(digits) - first), aMinWidth);
+}
+
+StringBuilder &StringBuilder::AppendSigned(int64_t aValue, unsigned int aMinWidth)
+{
+    char text[kMaxDigits + 2];
+
+    return AppendPadded(text, static_cast<size_t>(FormatSigned(aValue, text) - text), aMinWidth);
+}
+
+StringBuilder &StringBuilder::AppendHex(uint64_t aValue, unsigned int aMinDigits, HexCase aCase)
+{
+    char digits[kMaxHexDigits];
+
+    for (; aMinDigits > kMaxHexDigits; aMinDigits--)
+    {
+        AppendChar('0');
+    }
+
+    return Append(digits, WriteHex(aValue, aMinDigits, digits, aCase));
+}
+
+StringBuilder &StringBuilder::AppendHexBytes(const uint8_t *aBytes, size_t aLength, char aSeparator, HexCase aCase)
+{
+    const char *pairs  = kHexPairs[aCase];
+    size_t      length = aLength * 2 + (aSeparator != '\0' && aLength > 0 ? aLength - 1 : 0);
+
+    if (mLength + length < mSize)
+    {
+        char *cur = mBuffer + mLength;
+
+        for (size_t i = 0; i < aLength; i++)
+        {
+            if (i > 0 && aSeparator != '\0')
+            {
+                *cur++ = aSeparator;
+            }
+
+            memcpy(cur, &pairs[aBytes[i] * 2], 2);
+            cur += 2;
+        }
+
+        *cur = '\0';
+        mLength += length;
+        ExitNow();
+    }
+
+    // Slow path appending digit by digit, to truncate at the end of the buffer.
+    for (size_t i = 0; i < aLength; i++)
+    {
+        if (i > 0 && aSeparator != '\0')
+        {
+            AppendChar(aSeparator);
+        }
+
+        Append(&pairs[aBytes[i] * 2], 2);
+    }
+
+exit:
+    return *this;
+}
+
+} // namespace Format
+} // namespace otbr
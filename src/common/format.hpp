@@ -0,0 +1,247 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file provides fast text formatting, without locale and without printf.
+ */
+
+#ifndef OTBR_COMMON_FORMAT_HPP_
+#define OTBR_COMMON_FORMAT_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace otbr {
+namespace Format {
+
+/**
+ * Letter case of hex digits.
+ *
+ */
+enum HexCase
+{
+    kLowerCase, ///< Digits a to f.
+    kUpperCase, ///< Digits A to F.
+};
+
+/**
+ * This function encodes bytes in hex, two digits per byte.
+ *
+ * @param[in]   aBytes      A pointer to the bytes.
+ * @param[in]   aLength     Number of bytes.
+ * @param[out]  aHex        A pointer to at least 2 * @p aLength + 1 chars, receiving the null terminated hex.
+ * @param[in]   aCase       Letter case of the digits.
+ *
+ * @returns A pointer to the null terminator written.
+ *
+ */
+char *EncodeHex(const uint8_t *aBytes, size_t aLength, char *aHex, HexCase aCase = kLowerCase);
+
+/**
+ * This function decodes hex digits into bytes.
+ *
+ * An odd number of digits is decoded as if there were a leading zero.
+ *
+ * @param[in]   aHex            A pointer to the hex digits, either case.
+ * @param[in]   aHexLength      Number of hex digits.
+ * @param[out]  aBytes          A pointer to receive the bytes.
+ * @param[in]   aBytesLength    Max number of bytes.
+ *
+ * @returns Number of bytes decoded, or -1 if there is an invalid digit or the bytes do not fit.
+ *
+ */
+int DecodeHex(const char *aHex, size_t aHexLength, uint8_t *aBytes, size_t aBytesLength);
+
+/**
+ * This function formats an unsigned integer in decimal.
+ *
+ * @param[in]   aValue      The value.
+ * @param[out]  aOutput     A pointer to at least 21 chars, receiving the null terminated text.
+ *
+ * @returns A pointer to the null terminator written.
+ *
+ */
+char *FormatUnsigned(uint64_t aValue, char *aOutput);
+
+/**
+ * This function formats a signed integer in decimal.
+ *
+ * @param[in]   aValue      The value.
+ * @param[out]  aOutput     A pointer to at least 21 chars, receiving the null terminated text.
+ *
+ * @returns A pointer to the null terminator written.
+ *
+ */
+char *FormatSigned(int64_t aValue, char *aOutput);
+
+/**
+ * This function formats an integer in hex, like printf("%0*llx").
+ *
+ * @param[in]   aValue      The value.
+ * @param[in]   aMinDigits  Min number of digits, padded with zeros.
+ * @param[out]  aOutput     A pointer to at least max(@p aMinDigits, 16) + 1 chars, receiving the null terminated text.
+ * @param[in]   aCase       Letter case of the digits.
+ *
+ * @returns A pointer to the null terminator written.
+ *
+ */
+char *FormatHex(uint64_t aValue, unsigned int aMinDigits, char *aOutput, HexCase aCase = kLowerCase);
+
+/**
+ * This class implements an append-only string builder writing into a preallocated buffer.
+ *
+ * Text that does not fit is dropped, the string is always null terminated and the builder remembers it is truncated.
+ *
+ */
+class StringBuilder
+{
+public:
+    /**
+     * The constructor of a string builder, starting with an empty string.
+     *
+     * @param[in]  aBuffer  A pointer to the buffer.
+     * @param[in]  aSize    Size of the buffer, including the null terminator.
+     *
+     */
+    StringBuilder(char *aBuffer, size_t aSize);
+
+    /**
+     * This method appends a string.
+     *
+     * @param[in]  aString  A pointer to the null terminated string.
+     *
+     * @returns A reference to this builder.
+     *
+     */
+    StringBuilder &Append(const char *aString);
+
+    /**
+     * This method appends chars.
+     *
+     * @param[in]  aChars   A pointer to the chars.
+     * @param[in]  aLength  Number of chars.
+     *
+     * @returns A reference to this builder.
+     *
+     */
+    StringBuilder &Append(const char *aChars, size_t aLength);
+
+    /**
+     * This method appends a char.
+     *
+     * @param[in]  aChar    The char.
+     *
+     * @returns A reference to this builder.
+     *
+     */
+    StringBuilder &AppendChar(char aChar);
+
+    /**
+     * This method appends an unsigned integer in decimal, right aligned on @p aMinWidth chars like printf("%*llu").
+     *
+     * @param[in]  aValue       The value.
+     * @param[in]  aMinWidth    Min number of chars, padded with spaces.
+     *
+     * @returns A reference to this builder.
+     *
+     */
+    StringBuilder &AppendUnsigned(uint64_t aValue, unsigned int aMinWidth = 0);
+
+    /**
+     * This method appends a signed integer in decimal, right aligned on @p aMinWidth chars like printf("%*lld").
+     *
+     * @param[in]  aValue       The value.
+     * @param[in]  aMinWidth    Min number of chars, padded with spaces.
+     *
+     * @returns A reference to this builder.
+     *
+     */
+    StringBuilder &AppendSigned(int64_t aValue, unsigned int aMinWidth = 0);
+
+    /**
+     * This method appends an integer in hex, like printf("%0*llx").
+     *
+     * @param[in]  aValue       The value.
+     * @param[in]  aMinDigits   Min number of digits, padded with zeros.
+     * @param[in]  aCase        Letter case of the digits.
+     *
+     * @returns A reference to this builder.
+     *
+     */
+    StringBuilder &AppendHex(uint64_t aValue, unsigned int aMinDigits = 0, HexCase aCase = kLowerCase);
+
+    /**
+     * This method appends bytes in hex, two digits per byte.
+     *
+     * @param[in]  aBytes       A pointer to the bytes.
+     * @param[in]  aLength      Number of bytes.
+     * @param[in]  aSeparator   Char appended between bytes, or '\0' for none.
+     * @param[in]  aCase        Letter case of the digits.
+     *
+     * @returns A reference to this builder.
+     *
+     */
+    StringBuilder &AppendHexBytes(const uint8_t *aBytes,
+                                  size_t         aLength,
+                                  char           aSeparator = '\0',
+                                  HexCase        aCase      = kLowerCase);
+
+    /**
+     * This method returns the string built so far.
+     *
+     */
+    const char *GetString(void) const { return mBuffer; }
+
+    /**
+     * This method returns the length of the string built so far.
+     *
+     */
+    size_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method tells whether some text did not fit in the buffer.
+     *
+     */
+    bool IsTruncated(void) const { return mIsTruncated; }
+
+private:
+    StringBuilder &AppendPadded(const char *aText, size_t aLength, unsigned int aMinWidth);
+
+    char * mBuffer;
+    size_t mSize;
+    size_t mLength;
+    bool   mIsTruncated;
+};
+
+} // namespace Format
+} // namespace otbr
+
+#endif // OTBR_COMMON_FORMAT_HPP_
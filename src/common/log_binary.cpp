@@ -0,0 +1,381 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements binary log records.
+ */
+
+#include "common/log_binary.hpp"
+
+#include <atomic>
+#include <mutex>
+
+#include <stdio.h>
+
+#include "common/code_utils.hpp"
+#include "common/format.hpp"
+
+namespace otbr {
+namespace BinaryLog {
+
+namespace {
+
+enum
+{
+    kMaxSpecLength = 32,               ///< Max length of a conversion specification.
+    kMaxArgText    = kMaxArgsLength,   ///< Max length of a formatted argument.
+    kValueSize     = sizeof(uint64_t), ///< Size of an encoded value.
+};
+
+const char *          sFormats[kMaxFormats];
+std::atomic<uint16_t> sNumFormats(0);
+std::mutex            sFormatsMutex;
+
+void WriteLittleEndian(uint64_t aValue, size_t aSize, uint8_t *aOutput)
+{
+    for (size_t i = 0; i < aSize; i++)
+    {
+        aOutput[i] = static_cast<uint8_t>(aValue >> (i * 8));
+    }
+}
+
+uint64_t ReadLittleEndian(const uint8_t *aInput, size_t aSize)
+{
+    uint64_t value = 0;
+
+    for (size_t i = aSize; i > 0; i--)
+    {
+        value = (value << 8) | aInput[i - 1];
+    }
+
+    return value;
+}
+
+/**
+ * This class reads encoded arguments one by one.
+ *
+ */
+class ArgsDecoder
+{
+public:
+    ArgsDecoder(const uint8_t *aArgs, size_t aLength)
+        : mCur(aArgs)
+        , mEnd(aArgs + aLength)
+    {
+    }
+
+    /**
+     * This method reads the next argument.
+     *
+     * @returns The type of the argument, or 0 if there is none left.
+     *
+     */
+    uint8_t Next(uint64_t &aValue, const char *&aString, size_t &aStringLength)
+    {
+        uint8_t type = 0;
+
+        VerifyOrExit(mCur < mEnd);
+        type = *mCur++;
+
+        if (type == kArgString)
+        {
+            VerifyOrExit(mEnd - mCur >= 2, type = 0);
+            aStringLength = static_cast<size_t>(ReadLittleEndian(mCur, 2));
+            mCur += 2;
+            VerifyOrExit(static_cast<size_t>(mEnd - mCur) >= aStringLength, type = 0);
+            aString = reinterpret_cast<const char *>(mCur);
+            mCur += aStringLength;
+        }
+        else
+        {
+            VerifyOrExit(mEnd - mCur >= kValueSize, type = 0);
+            aValue = ReadLittleEndian(mCur, kValueSize);
+            mCur += kValueSize;
+        }
+
+    exit:
+        if (type == 0)
+        {
+            mCur = mEnd;
+        }
+        return type;
+    }
+
+private:
+    const uint8_t *mCur;
+    const uint8_t *mEnd;
+};
+
+bool IsFlag(char aChar)
+{
+    return aChar == '-' || aChar == '+' || aChar == ' ' || aChar == '#' || aChar == '0';
+}
+
+bool IsLengthModifier(char aChar)
+{
+    return aChar == 'h' || aChar == 'l' || aChar == 'L' || aChar == 'q' || aChar == 'j' || aChar == 'z' || aChar == 't';
+}
+
+/**
+ * This function formats one argument according to a conversion specification without length modifier.
+ *
+ */
+void FormatArg(otbr::Format::StringBuilder &aOutput,
+               const char *                 aSpec,
+               size_t                       aSpecLength,
+               char                         aConversion,
+               ArgsDecoder &                aDecoder)
+{
+    char        spec[kMaxSpecLength + 4];
+    char        text[kMaxArgText + 1];
+    uint64_t    value  = 0;
+    const char *string = NULL;
+    size_t      length = 0;
+    uint8_t     type   = aDecoder.Next(value, string, length);
+    int         rval   = -1;
+
+    memcpy(spec, aSpec, aSpecLength);
+
+    switch (aConversion)
+    {
+    case 'd':
+    case 'i':
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+        VerifyOrExit(type == kArgSigned || type == kArgUnsigned || type == kArgPointer);
+        spec[aSpecLength++] = 'l';
+        spec[aSpecLength++] = 'l';
+        spec[aSpecLength++] = aConversion;
+        spec[aSpecLength]   = '\0';
+        if (aConversion == 'd' || aConversion == 'i')
+        {
+            rval = snprintf(text, sizeof(text), spec, static_cast<long long>(value));
+        }
+        else
+        {
+            rval = snprintf(text, sizeof(text), spec, static_cast<unsigned long long>(value));
+        }
+        break;
+
+    case 'c':
+        VerifyOrExit(type == kArgSigned || type == kArgUnsigned);
+        spec[aSpecLength++] = aConversion;
+        spec[aSpecLength]   = '\0';
+        rval                = snprintf(text, sizeof(text), spec, static_cast<int>(value));
+        break;
+
+    case 'a':
+    case 'A':
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    {
+        double number;
+
+        VerifyOrExit(type == kArgDouble);
+        memcpy(&number, &value, sizeof(number));
+        spec[aSpecLength++] = aConversion;
+        spec[aSpecLength]   = '\0';
+        rval                = snprintf(text, sizeof(text), spec, number);
+        break;
+    }
+
+    case 's':
+    {
+        char copy[kMaxArgsLength + 1];
+
+        VerifyOrExit(type == kArgString);
+        memcpy(copy, string, length);
+        copy[length]        = '\0';
+        spec[aSpecLength++] = 's';
+        spec[aSpecLength]   = '\0';
+        rval                = snprintf(text, sizeof(text), spec, copy);
+        break;
+    }
+
+    case 'p':
+        VerifyOrExit(type == kArgPointer || type == kArgUnsigned);
+        spec[aSpecLength++] = 'p';
+        spec[aSpecLength]   = '\0';
+        rval = snprintf(text, sizeof(text), spec, reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    if (rval < 0)
+    {
+        aOutput.AppendChar('?');
+    }
+    else
+    {
+        aOutput.Append(text, static_cast<size_t>(rval) < sizeof(text) ? static_cast<size_t>(rval) : sizeof(text) - 1);
+    }
+}
+
+} // namespace
+
+const char kFileMagic[8] = {'O', 'T', 'B', 'R', 'L', 'O', 'G', '1'};
+
+uint16_t RegisterFormat(const char *aFormat)
+{
+    std::lock_guard<std::mutex> lock(sFormatsMutex);
+    uint16_t                    id = sNumFormats.load(std::memory_order_relaxed) + 1;
+
+    VerifyOrExit(id < kMaxFormats, id = 0);
+    sFormats[id] = aFormat;
+    sNumFormats.store(id, std::memory_order_release);
+
+exit:
+    return id;
+}
+
+const char *GetFormat(uint16_t aFormatId)
+{
+    return (aFormatId != 0 && aFormatId <= sNumFormats.load(std::memory_order_acquire)) ? sFormats[aFormatId] : NULL;
+}
+
+size_t FormatArgs(const char *aFormat, const uint8_t *aArgs, size_t aLength, char *aOutput, size_t aSize)
+{
+    otbr::Format::StringBuilder output(aOutput, aSize);
+    ArgsDecoder                 decoder(aArgs, aLength);
+
+    while (*aFormat != '\0')
+    {
+        const char *spec = aFormat;
+        size_t      specLength;
+
+        if (*aFormat != '%')
+        {
+            const char *literal = aFormat;
+
+            while (*aFormat != '\0' && *aFormat != '%')
+            {
+                aFormat++;
+            }
+            output.Append(literal, static_cast<size_t>(aFormat - literal));
+            continue;
+        }
+
+        if (aFormat[1] == '%')
+        {
+            output.AppendChar('%');
+            aFormat += 2;
+            continue;
+        }
+
+        // Flags, width and precision are kept, the length modifier is replaced by the one of the encoded type.
+        aFormat++;
+        while (IsFlag(*aFormat) || (*aFormat >= '0' && *aFormat <= '9') || *aFormat == '.')
+        {
+            aFormat++;
+        }
+        specLength = static_cast<size_t>(aFormat - spec);
+
+        while (IsLengthModifier(*aFormat))
+        {
+            aFormat++;
+        }
+
+        if (*aFormat == '\0' || specLength > kMaxSpecLength)
+        {
+            output.AppendChar('?');
+            break;
+        }
+
+        FormatArg(output, spec, specLength, *aFormat++, decoder);
+    }
+
+    return output.GetLength();
+}
+
+void EncodeFormatHeader(uint16_t aFormatId, uint16_t aLength, uint8_t *aHeader)
+{
+    aHeader[0] = kEntryFormat;
+    WriteLittleEndian(aFormatId, 2, &aHeader[1]);
+    WriteLittleEndian(aLength, 2, &aHeader[3]);
+}
+
+void EncodeRecordHeader(uint16_t aFormatId, uint8_t aLevel, uint32_t aTimestamp, uint16_t aLength, uint8_t *aHeader)
+{
+    aHeader[0] = kEntryRecord;
+    WriteLittleEndian(aFormatId, 2, &aHeader[1]);
+    aHeader[3] = aLevel;
+    WriteLittleEndian(aTimestamp, 4, &aHeader[4]);
+    WriteLittleEndian(aLength, 2, &aHeader[8]);
+}
+
+void ArgsEncoder::AddValue(uint8_t aType, uint64_t aValue)
+{
+    VerifyOrExit(mLength + 1 + kValueSize <= kMaxArgsLength);
+
+    mArgs[mLength++] = aType;
+    WriteLittleEndian(aValue, kValueSize, &mArgs[mLength]);
+    mLength += kValueSize;
+
+exit:
+    return;
+}
+
+void ArgsEncoder::AddString(const char *aString)
+{
+    size_t length = (aString != NULL ? strlen(aString) : 0);
+
+    if (aString == NULL)
+    {
+        aString = "(null)";
+        length  = 6;
+    }
+
+    VerifyOrExit(mLength + 3 <= kMaxArgsLength);
+
+    if (length > kMaxArgsLength - mLength - 3)
+    {
+        length = kMaxArgsLength - mLength - 3;
+    }
+
+    mArgs[mLength++] = kArgString;
+    WriteLittleEndian(length, 2, &mArgs[mLength]);
+    mLength += 2;
+    memcpy(&mArgs[mLength], aString, length);
+    mLength += length;
+
+exit:
+    return;
+}
+
+} // namespace BinaryLog
+} // namespace otbr
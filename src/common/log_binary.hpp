@@ -0,0 +1,258 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file provides binary log records, whose formatting is deferred to the log writer or to an offline decoder.
+ */
+
+#ifndef OTBR_COMMON_LOG_BINARY_HPP_
+#define OTBR_COMMON_LOG_BINARY_HPP_
+
+#include "openthread-br/config.h"
+
+#include <type_traits>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace otbr {
+namespace BinaryLog {
+
+/**
+ * Constants.
+ */
+enum
+{
+    kMaxFormats       = 1024, ///< Max number of registered format strings.
+    kMaxArgsLength    = 480,  ///< Max length of the encoded arguments of a record.
+    kFormatHeaderSize = 5,    ///< Size of the header of a format entry of a binary log file.
+    kRecordHeaderSize = 10,   ///< Size of the header of a record entry of a binary log file.
+};
+
+/**
+ * Types of the entries of a binary log file.
+ *
+ * A binary log file starts with kFileMagic. Each entry starts with its type, followed by, in little endian:
+ * - a format entry: the 16 bits format ID, the 16 bits length of the format string and the format string.
+ * - a record entry: the 16 bits format ID, the 8 bits level, the 32 bits timestamp in milliseconds, the 16 bits
+ *   length of the arguments and the arguments. The format ID 0 means the arguments are the text itself.
+ *
+ * The format entry of an ID is written before the first record using it.
+ *
+ */
+enum EntryType
+{
+    kEntryFormat = 1, ///< Format entry.
+    kEntryRecord = 2, ///< Record entry.
+};
+
+/**
+ * Types of the encoded arguments.
+ *
+ * Each argument is its type followed by, in little endian, either a 64 bits value, or the 16 bits length of a string
+ * and the string.
+ *
+ */
+enum ArgType
+{
+    kArgSigned   = 1, ///< Signed integer.
+    kArgUnsigned = 2, ///< Unsigned integer.
+    kArgDouble   = 3, ///< Floating point number.
+    kArgString   = 4, ///< String.
+    kArgPointer  = 5, ///< Pointer.
+};
+
+/**
+ * The magic at the beginning of a binary log file.
+ *
+ */
+extern const char kFileMagic[8];
+
+/**
+ * This function registers a format string, it is usually called once per call site.
+ *
+ * @param[in]  aFormat  A pointer to the format string, which must outlive the process' logging.
+ *
+ * @returns The ID of the format string, or 0 if there are too many format strings.
+ *
+ */
+uint16_t RegisterFormat(const char *aFormat);
+
+/**
+ * This function returns the format string of an ID.
+ *
+ * @param[in]  aFormatId    The format ID.
+ *
+ * @returns A pointer to the format string, or NULL if the ID is not registered.
+ *
+ */
+const char *GetFormat(uint16_t aFormatId);
+
+/**
+ * This function formats encoded arguments, like snprintf().
+ *
+ * Arguments missing or of an unexpected type are printed as '?'.
+ *
+ * @param[in]   aFormat     A pointer to the format string.
+ * @param[in]   aArgs       A pointer to the encoded arguments.
+ * @param[in]   aLength     Length of the encoded arguments.
+ * @param[out]  aOutput     A pointer to receive the null terminated text.
+ * @param[in]   aSize       Size of @p aOutput.
+ *
+ * @returns Length of the text, truncated to @p aSize - 1.
+ *
+ */
+size_t FormatArgs(const char *aFormat, const uint8_t *aArgs, size_t aLength, char *aOutput, size_t aSize);
+
+/**
+ * This function encodes the header of a format entry.
+ *
+ * @param[in]   aFormatId   The format ID.
+ * @param[in]   aLength     Length of the format string.
+ * @param[out]  aHeader     A pointer to receive kFormatHeaderSize bytes.
+ *
+ */
+void EncodeFormatHeader(uint16_t aFormatId, uint16_t aLength, uint8_t *aHeader);
+
+/**
+ * This function encodes the header of a record entry.
+ *
+ * @param[in]   aFormatId   The format ID, 0 for text.
+ * @param[in]   aLevel      The log level.
+ * @param[in]   aTimestamp  Milliseconds since the logger started.
+ * @param[in]   aLength     Length of the arguments.
+ * @param[out]  aHeader     A pointer to receive kRecordHeaderSize bytes.
+ *
+ */
+void EncodeRecordHeader(uint16_t aFormatId, uint8_t aLevel, uint32_t aTimestamp, uint16_t aLength, uint8_t *aHeader);
+
+/**
+ * This class encodes the arguments of a binary log record.
+ *
+ * Arguments which do not fit are dropped, and strings are truncated to fit.
+ *
+ */
+class ArgsEncoder
+{
+public:
+    /**
+     * The constructor of an arguments encoder, without arguments.
+     *
+     */
+    ArgsEncoder(void)
+        : mLength(0)
+    {
+    }
+
+    /**
+     * This method encodes arguments.
+     *
+     */
+    void Add(void) {}
+
+    /**
+     * This method encodes arguments.
+     *
+     * @param[in]  aArg     The first argument.
+     * @param[in]  aArgs    The other arguments.
+     *
+     */
+    template <typename Arg, typename... Args> void Add(const Arg &aArg, const Args &... aArgs)
+    {
+        Encode(aArg);
+        Add(aArgs...);
+    }
+
+    /**
+     * This method returns the encoded arguments.
+     *
+     */
+    const uint8_t *GetArgs(void) const { return mArgs; }
+
+    /**
+     * This method returns the length of the encoded arguments.
+     *
+     */
+    size_t GetLength(void) const { return mLength; }
+
+private:
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type Encode(T aValue)
+    {
+        AddValue(kArgSigned, static_cast<uint64_t>(static_cast<int64_t>(aValue)));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type Encode(T aValue)
+    {
+        AddValue(kArgUnsigned, static_cast<uint64_t>(aValue));
+    }
+
+    template <typename T> typename std::enable_if<std::is_enum<T>::value>::type Encode(T aValue)
+    {
+        AddValue(kArgSigned, static_cast<uint64_t>(static_cast<int64_t>(aValue)));
+    }
+
+    template <typename T> typename std::enable_if<std::is_floating_point<T>::value>::type Encode(T aValue)
+    {
+        double   value = static_cast<double>(aValue);
+        uint64_t bits;
+
+        memcpy(&bits, &value, sizeof(bits));
+        AddValue(kArgDouble, bits);
+    }
+
+    template <typename T> void Encode(const T *aPointer)
+    {
+        AddValue(kArgPointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(aPointer)));
+    }
+
+    void Encode(const char *aString) { AddString(aString); }
+
+    void AddValue(uint8_t aType, uint64_t aValue);
+    void AddString(const char *aString);
+
+    uint8_t mArgs[kMaxArgsLength];
+    size_t  mLength;
+};
+
+/**
+ * This function returns the first of its arguments, the format string of the otbrLogDeferred() arguments.
+ *
+ */
+template <typename... Args> const char *GetFormatArg(const char *aFormat, const Args &...)
+{
+    return aFormat;
+}
+
+} // namespace BinaryLog
+} // namespace otbr
+
+#endif // OTBR_COMMON_LOG_BINARY_HPP_
@@ -0,0 +1,226 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a lock-free ring of log records.
+ */
+
+#include "common/log_ring.hpp"
+
+#include <thread>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+LogRing::LogRing(size_t aCapacity, OverflowPolicy aPolicy)
+    : mRecords(NULL)
+    , mMask(0)
+    , mPolicy(aPolicy)
+    , mTail(0)
+    , mHead(0)
+    , mDroppedCount(0)
+    , mIsClosed(false)
+{
+    size_t capacity = 1;
+
+    while (capacity < aCapacity)
+    {
+        capacity <<= 1;
+    }
+
+    mRecords = new Record[capacity];
+    mMask    = capacity - 1;
+
+    for (size_t i = 0; i < capacity; i++)
+    {
+        mRecords[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+LogRing::~LogRing(void)
+{
+    delete[] mRecords;
+}
+
+LogRing::Record *LogRing::Claim(size_t &aPosition)
+{
+    Record *record = NULL;
+
+    aPosition = mTail.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        size_t    sequence;
+        ptrdiff_t diff;
+
+        VerifyOrExit(!mIsClosed.load(std::memory_order_relaxed), record = NULL);
+
+        record   = &mRecords[aPosition & mMask];
+        sequence = record->mSequence.load(std::memory_order_acquire);
+        diff     = static_cast<ptrdiff_t>(sequence - aPosition);
+
+        if (diff == 0)
+        {
+            // The slot is free for this position, claim it.
+            if (mTail.compare_exchange_weak(aPosition, aPosition + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The slot still holds the record of the previous lap, the ring is full.
+            VerifyOrExit(mPolicy == kOverflowBlock, record = NULL);
+
+            std::this_thread::yield();
+            aPosition = mTail.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            // Another producer claimed this position.
+            aPosition = mTail.load(std::memory_order_relaxed);
+        }
+    }
+
+exit:
+    if (record == NULL)
+    {
+        mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return record;
+}
+
+void LogRing::Publish(Record &aRecord, size_t aPosition, int aLevel, int aFlags, unsigned long aTimestamp)
+{
+    aRecord.mTimestamp = aTimestamp;
+    aRecord.mLevel     = static_cast<uint8_t>(aLevel);
+    aRecord.mFlags     = static_cast<uint8_t>(aFlags);
+
+    // Publish the record to the consumer.
+    aRecord.mSequence.store(aPosition + 1, std::memory_order_release);
+}
+
+bool LogRing::Push(int aLevel, int aFlags, unsigned long aTimestamp, const char *aFormat, va_list aArgs)
+{
+    size_t  position;
+    Record *record = Claim(position);
+    int     length;
+
+    VerifyOrExit(record != NULL);
+
+    length = vsnprintf(record->mText, kMaxTextLength + 1, aFormat, aArgs);
+    if (length < 0)
+    {
+        length = 0;
+    }
+    else if (length > kMaxTextLength)
+    {
+        length = kMaxTextLength;
+    }
+
+    record->mFormatId              = 0;
+    record->mLength                = static_cast<uint16_t>(length);
+    record->mText[record->mLength] = '\0';
+    Publish(*record, position, aLevel, aFlags, aTimestamp);
+
+exit:
+    return record != NULL;
+}
+
+bool LogRing::Push(int           aLevel,
+                   int           aFlags,
+                   unsigned long aTimestamp,
+                   uint16_t      aFormatId,
+                   const void *  aArgs,
+                   size_t        aLength)
+{
+    size_t  position;
+    Record *record = Claim(position);
+
+    VerifyOrExit(record != NULL);
+
+    if (aLength > kMaxTextLength)
+    {
+        aLength = kMaxTextLength;
+    }
+
+    memcpy(record->mText, aArgs, aLength);
+    record->mFormatId = aFormatId;
+    record->mLength   = static_cast<uint16_t>(aLength);
+    Publish(*record, position, aLevel, aFlags, aTimestamp);
+
+exit:
+    return record != NULL;
+}
+
+size_t LogRing::Read(Record **aRecords, size_t aMaxRecords)
+{
+    size_t position = mHead.load(std::memory_order_relaxed);
+    size_t count    = 0;
+
+    // Records are published out of order when producers race, stop at the first one not published yet.
+    while (count < aMaxRecords && count <= mMask)
+    {
+        Record *record = &mRecords[(position + count) & mMask];
+
+        if (record->mSequence.load(std::memory_order_acquire) != position + count + 1)
+        {
+            break;
+        }
+
+        aRecords[count++] = record;
+    }
+
+    return count;
+}
+
+void LogRing::Release(size_t aNumRecords)
+{
+    size_t position = mHead.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < aNumRecords; i++)
+    {
+        // The slot is free again for the producer of the next lap.
+        mRecords[(position + i) & mMask].mSequence.store(position + i + mMask + 1, std::memory_order_release);
+    }
+
+    mHead.store(position + aNumRecords, std::memory_order_release);
+}
+
+void LogRing::Close(void)
+{
+    mIsClosed.store(true, std::memory_order_relaxed);
+}
+
+} // namespace otbr
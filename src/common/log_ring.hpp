@@ -0,0 +1,206 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file provides a lock-free ring of log records, for the asynchronous logger.
+ */
+
+#ifndef OTBR_COMMON_LOG_RING_HPP_
+#define OTBR_COMMON_LOG_RING_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class implements a bounded multiple producer, single consumer ring of formatted log records.
+ *
+ * Producers claim a slot with a compare-and-swap and publish it with a per slot sequence number, so logging never
+ * takes a lock or makes a system call. The consumer reads the published records in the order their slots were
+ * claimed, which is the order of the calls to Push() from each producer thread.
+ *
+ */
+class LogRing
+{
+public:
+    enum
+    {
+        kMaxTextLength   = 480, ///< Max length of the text of a record, longer text is truncated.
+        kDefaultCapacity = 256, ///< Default number of records.
+    };
+
+    /**
+     * What to do when a producer finds the ring full.
+     *
+     */
+    enum OverflowPolicy
+    {
+        kOverflowDrop,  ///< Drop the record and count it.
+        kOverflowBlock, ///< Wait for the consumer to free a slot.
+    };
+
+    /**
+     * This structure represents a log record.
+     *
+     */
+    struct Record
+    {
+        std::atomic<size_t> mSequence;                ///< Position this slot is next written or read at.
+        unsigned long       mTimestamp;               ///< Milliseconds since the logger started.
+        uint16_t            mFormatId;                ///< Format of the binary arguments in mText, 0 for text.
+        uint16_t            mLength;                  ///< Length of the text or of the binary arguments.
+        uint8_t             mLevel;                   ///< Log level.
+        uint8_t             mFlags;                   ///< Where to write the record, for the consumer.
+        char                mText[kMaxTextLength + 2]; ///< Text, with room for a new line and a null terminator.
+    };
+
+    /**
+     * The constructor of a log ring.
+     *
+     * @param[in]  aCapacity    Number of records, rounded up to a power of two.
+     * @param[in]  aPolicy      What to do when the ring is full.
+     *
+     */
+    explicit LogRing(size_t aCapacity = kDefaultCapacity, OverflowPolicy aPolicy = kOverflowDrop);
+
+    ~LogRing(void);
+
+    /**
+     * This method formats a record into the ring. It may be called from any thread.
+     *
+     * @param[in]  aLevel       Log level.
+     * @param[in]  aFlags       Where to write the record.
+     * @param[in]  aTimestamp   Milliseconds since the logger started.
+     * @param[in]  aFormat      Format string as in printf.
+     * @param[in]  aArgs        Arguments of the format string.
+     *
+     * @retval true     The record was queued.
+     * @retval false    The ring was full, or closed while waiting for a slot, and the record was dropped.
+     *
+     */
+    bool Push(int aLevel, int aFlags, unsigned long aTimestamp, const char *aFormat, va_list aArgs);
+
+    /**
+     * This method copies a binary record into the ring, to be formatted by the consumer. It may be called from any
+     * thread.
+     *
+     * @param[in]  aLevel       Log level.
+     * @param[in]  aFlags       Where to write the record.
+     * @param[in]  aTimestamp   Milliseconds since the logger started.
+     * @param[in]  aFormatId    ID of the format string, not 0.
+     * @param[in]  aArgs        A pointer to the encoded arguments.
+     * @param[in]  aLength      Length of the encoded arguments, at most kMaxTextLength.
+     *
+     * @retval true     The record was queued.
+     * @retval false    The ring was full, or closed while waiting for a slot, and the record was dropped.
+     *
+     */
+    bool Push(int           aLevel,
+              int           aFlags,
+              unsigned long aTimestamp,
+              uint16_t      aFormatId,
+              const void *  aArgs,
+              size_t        aLength);
+
+    /**
+     * This method returns the next records queued, in order. It must only be called by the consumer.
+     *
+     * The records are owned by the consumer until they are released with Release().
+     *
+     * @param[out]  aRecords    An array receiving pointers to the records.
+     * @param[in]   aMaxRecords Max number of records.
+     *
+     * @returns Number of records returned.
+     *
+     */
+    size_t Read(Record **aRecords, size_t aMaxRecords);
+
+    /**
+     * This method frees the slots of the records returned by the last call to Read().
+     *
+     * @param[in]  aNumRecords  Number of records returned by Read().
+     *
+     */
+    void Release(size_t aNumRecords);
+
+    /**
+     * This method makes producers waiting for a slot give up, and all later records be dropped.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method returns the number of records ever claimed by producers.
+     *
+     */
+    size_t GetPushedCount(void) const { return mTail.load(std::memory_order_acquire); }
+
+    /**
+     * This method returns the number of records ever released by the consumer.
+     *
+     */
+    size_t GetReleasedCount(void) const { return mHead.load(std::memory_order_acquire); }
+
+    /**
+     * This method returns the number of records dropped.
+     *
+     */
+    unsigned long GetDroppedCount(void) const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+    /**
+     * This method returns the number of records.
+     *
+     */
+    size_t GetCapacity(void) const { return mMask + 1; }
+
+private:
+    LogRing(const LogRing &);
+    LogRing &operator=(const LogRing &);
+
+    Record *Claim(size_t &aPosition);
+    void    Publish(Record &aRecord, size_t aPosition, int aLevel, int aFlags, unsigned long aTimestamp);
+
+    Record *                   mRecords;
+    size_t                     mMask;
+    OverflowPolicy             mPolicy;
+    std::atomic<size_t>        mTail;
+    std::atomic<size_t>        mHead;
+    std::atomic<unsigned long> mDroppedCount;
+    std::atomic<bool>          mIsClosed;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_LOG_RING_HPP_
@@ -28,30 +28,88 @@
 
 #include "common/logging.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include <assert.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
+#include <sys/uio.h>
 #include <syslog.h>
+#include <time.h>
+#include <unistd.h>
 
+#include "common/code_utils.hpp"
+#include "common/format.hpp"
+#include "common/log_binary.hpp"
+#include "common/log_ring.hpp"
 #include "common/time.hpp"
 
-static int        sLevel      = LOG_INFO;
-static const char kHexChars[] = "0123456789abcdef";
+static const char *const kLogModuleNames[] = {"default", "agent", "dtls", "coap", "dbus", "mdns", "web", "ubus", "ncp"};
+
+static_assert(sizeof(kLogModuleNames) / sizeof(kLogModuleNames[0]) == OTBR_LOG_MODULE_NUM, "missing module names");
+
+std::atomic<int> otbr::gLogModuleLevels[OTBR_LOG_MODULE_NUM] = {{LOG_INFO}, {LOG_INFO}, {LOG_INFO},
+                                                                {LOG_INFO}, {LOG_INFO}, {LOG_INFO},
+                                                                {LOG_INFO}, {LOG_INFO}, {LOG_INFO}};
 
 static unsigned long sMsecsStart;
 static bool          sLogCol0 = true; /* we start at col0 */
 static FILE *        sLogFp;
 static bool          sSyslogEnabled = true;
 static bool          sSyslogOpened  = false;
+static int           sLogBinaryFd   = -1;
 
 #define LOGFLAG_syslog 1
 #define LOGFLAG_file 2
 
+/**
+ * Constants of the asynchronous logger.
+ */
+enum
+{
+    kLogWriterBatch      = 64,  ///< max records written with one writev()
+    kLogWriterInterval   = 100, ///< milliseconds the writer sleeps when there is little to write
+    kLogFlushInterval    = 10,  ///< milliseconds between checks of otbrLogFlush()
+    kLogCrashDrainTries  = 100, ///< times a crash handler waits 1ms for the writer to release the ring
+    kLogTimestampMaxSize = 32,  ///< size of the timestamp written before each line of the log file
+    kLogEntryMaxIov      = 4,   ///< max iovecs of a record, with the format entry of a binary record
+    kLogEntryHeaderSize  = otbr::BinaryLog::kFormatHeaderSize + otbr::BinaryLog::kRecordHeaderSize,
+};
+
+static_assert(static_cast<int>(otbr::BinaryLog::kMaxArgsLength) <= static_cast<int>(otbr::LogRing::kMaxTextLength),
+              "binary records must fit in the log ring");
+
+/* The asynchronous logger, NULL when logs are written by the calling thread. */
+static std::atomic<otbr::LogRing *> sLogRing(NULL);
+static std::thread *                sLogWriter;
+static std::mutex                   sLogWriterMutex;
+static std::condition_variable      sLogWriterCondition;
+static std::condition_variable      sLogFlushCondition;
+static bool                         sLogWriterStop;
+static bool                         sLogFlushRequested;
+static bool                         sLogAtExitRegistered;
+static std::atomic<bool>            sLogWriterSleeping(false);
+static std::atomic<bool>            sLogConsuming(false);
+static unsigned long                sLogDroppedReported;
+static uint8_t                      sLogFormatsWritten[(otbr::BinaryLog::kMaxFormats + 7) / 8];
+
+/* The limits of hex dumps, as a GCRA token bucket, no limits until otbrDumpSetLimits() is called. */
+static std::atomic<uint64_t>     sDumpInterval(0);
+static std::atomic<uint64_t>     sDumpTolerance(0);
+static std::atomic<unsigned int> sDumpSampleRate(1);
+static std::atomic<size_t>       sDumpMaxSize(0);
+
 /** Set/Clear syslog enable flag */
 void otbrLogEnableSyslog(bool b)
 {
@@ -75,21 +133,126 @@ void otbrLogSetFilename(const char *filename)
     }
 }
 
+/** Enable logging binary records to a specific file */
+void otbrLogSetBinaryFilename(const char *aFilename)
+{
+    if (sLogBinaryFd >= 0)
+    {
+        close(sLogBinaryFd);
+        sLogBinaryFd = -1;
+    }
+    sLogBinaryFd = open(aFilename, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (sLogBinaryFd < 0 ||
+        write(sLogBinaryFd, otbr::BinaryLog::kFileMagic, sizeof(otbr::BinaryLog::kFileMagic)) !=
+            static_cast<ssize_t>(sizeof(otbr::BinaryLog::kFileMagic)))
+    {
+        fprintf(stderr, "Cannot open binary log file: %s\n", aFilename);
+        perror(aFilename);
+        exit(EXIT_FAILURE);
+    }
+    memset(sLogFormatsWritten, 0, sizeof(sLogFormatsWritten));
+}
+
 /** Get the current debug log level */
 int otbrLogGetLevel(void)
 {
-    return sLevel;
+    return otbrLogGetModuleLevel(OTBR_LOG_MODULE_DEFAULT);
 }
 
-/** Set the debug log level */
+/** Set the debug log level of all the modules */
 void otbrLogSetLevel(int aLevel)
 {
+    for (int module = 0; module < OTBR_LOG_MODULE_NUM; module++)
+    {
+        otbrLogSetModuleLevel(module, aLevel);
+    }
+}
+
+int otbrLogGetModuleLevel(int aModule)
+{
+    assert(aModule >= 0 && aModule < OTBR_LOG_MODULE_NUM);
+    return otbr::gLogModuleLevels[aModule].load(std::memory_order_relaxed);
+}
+
+void otbrLogSetModuleLevel(int aModule, int aLevel)
+{
+    assert(aModule >= 0 && aModule < OTBR_LOG_MODULE_NUM);
     assert(aLevel >= LOG_EMERG && aLevel <= LOG_DEBUG);
-    sLevel = aLevel;
+    otbr::gLogModuleLevels[aModule].store(aLevel, std::memory_order_relaxed);
+}
+
+const char *otbrLogGetModuleName(int aModule)
+{
+    assert(aModule >= 0 && aModule < OTBR_LOG_MODULE_NUM);
+    return kLogModuleNames[aModule];
+}
+
+/** Whether the first @p aLength characters of @p aName are the name @p aModuleName */
+static bool IsModuleName(const char *aName, size_t aLength, const char *aModuleName)
+{
+    return strlen(aModuleName) == aLength && strncmp(aName, aModuleName, aLength) == 0;
+}
+
+otbrError otbrLogSetModuleLevels(const char *aLevels)
+{
+    static const char kSeparators[] = ", \t\r\n";
+
+    int         levels[OTBR_LOG_MODULE_NUM];
+    const char *cur   = aLevels;
+    otbrError   error = OTBR_ERROR_ERRNO;
+
+    for (int module = 0; module < OTBR_LOG_MODULE_NUM; module++)
+    {
+        levels[module] = otbrLogGetModuleLevel(module);
+    }
+
+    // All the levels are parsed before any is changed.
+    while (*(cur += strspn(cur, kSeparators)) != '\0')
+    {
+        const char *name       = cur;
+        size_t      nameLength = strcspn(cur, "=");
+        int         level;
+        int         module;
+
+        VerifyOrExit(name[nameLength] == '=' && nameLength > 0, errno = EINVAL);
+        cur += nameLength + 1;
+        VerifyOrExit(*cur >= '0' && *cur <= '7' && (cur[1] == '\0' || strchr(kSeparators, cur[1]) != NULL),
+                     errno = EINVAL);
+        level = *cur++ - '0';
+
+        if (IsModuleName(name, nameLength, "all"))
+        {
+            for (module = 0; module < OTBR_LOG_MODULE_NUM; module++)
+            {
+                levels[module] = level;
+            }
+        }
+        else
+        {
+            for (module = 0; module < OTBR_LOG_MODULE_NUM; module++)
+            {
+                if (IsModuleName(name, nameLength, kLogModuleNames[module]))
+                {
+                    break;
+                }
+            }
+            VerifyOrExit(module < OTBR_LOG_MODULE_NUM, errno = EINVAL);
+            levels[module] = level;
+        }
+    }
+
+    for (int module = 0; module < OTBR_LOG_MODULE_NUM; module++)
+    {
+        otbrLogSetModuleLevel(module, levels[module]);
+    }
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
 }
 
 /** Determine if we should not or not log, and if so where to */
-static int LogCheck(int aLevel)
+static int LogCheck(int aModule, int aLevel)
 {
     int r;
 
@@ -97,16 +260,17 @@ static int LogCheck(int aLevel)
 
     r = 0;
 
-    if (sSyslogOpened && sSyslogEnabled && (aLevel <= sLevel))
+    if (aLevel > otbrLogGetModuleLevel(aModule))
+    {
+        return r;
+    }
+
+    if (sSyslogOpened && sSyslogEnabled)
     {
         r = r | LOGFLAG_syslog;
     }
 
-    /* if someone has turned on the seperate file the most likely
-     * situation is they are debugging a problem, or need a extra
-     * information. In this case, we do not test the log level.
-     */
-    if (sLogFp != NULL)
+    if (sLogFp != NULL || sLogBinaryFd >= 0)
     {
         r = r | LOGFLAG_file;
     }
@@ -174,6 +338,373 @@ static void LogPrintf(const char *fmt, ...)
     va_end(ap);
 }
 
+/** Format the timestamp written before each line of the log file, returns its length */
+static size_t FormatTimestamp(unsigned long aMsecs, char *aOutput)
+{
+    otbr::Format::StringBuilder builder(aOutput, kLogTimestampMaxSize);
+    unsigned long               msecs = aMsecs % 1000;
+
+    /* same as "%4lu.%03lu | " */
+    builder.AppendUnsigned(aMsecs / 1000, 4).AppendChar('.');
+    builder.AppendUnsigned(msecs / 100).AppendUnsigned(msecs / 10 % 10).AppendUnsigned(msecs % 10).Append(" | ");
+
+    return builder.GetLength();
+}
+
+/** Format the arguments of a binary record, returns the length of the text */
+static size_t FormatBinaryRecord(const otbr::LogRing::Record &aRecord, char *aOutput, size_t aSize)
+{
+    const char *format = otbr::BinaryLog::GetFormat(aRecord.mFormatId);
+
+    return otbr::BinaryLog::FormatArgs(format != NULL ? format : "?", reinterpret_cast<const uint8_t *>(aRecord.mText),
+                                       aRecord.mLength, aOutput, aSize);
+}
+
+/**
+ * Add the entries of a record of the binary log file to @p aIov, returns the number of iovecs added
+ *
+ * The format entry is added before the first record of each format.
+ */
+static int AddBinaryEntry(uint16_t      aFormatId,
+                          int           aLevel,
+                          unsigned long aTimestamp,
+                          const void *  aData,
+                          size_t        aLength,
+                          uint8_t *     aHeaders,
+                          struct iovec *aIov)
+{
+    int         numIov = 0;
+    const char *format = otbr::BinaryLog::GetFormat(aFormatId);
+
+    if (format != NULL && !(sLogFormatsWritten[aFormatId / 8] & (1U << (aFormatId % 8))))
+    {
+        size_t length = strlen(format);
+
+        sLogFormatsWritten[aFormatId / 8] |= static_cast<uint8_t>(1U << (aFormatId % 8));
+        otbr::BinaryLog::EncodeFormatHeader(aFormatId, static_cast<uint16_t>(length), aHeaders);
+
+        aIov[numIov].iov_base = aHeaders;
+        aIov[numIov].iov_len  = otbr::BinaryLog::kFormatHeaderSize;
+        numIov++;
+        aIov[numIov].iov_base = const_cast<char *>(format);
+        aIov[numIov].iov_len  = length;
+        numIov++;
+    }
+
+    aHeaders += otbr::BinaryLog::kFormatHeaderSize;
+    otbr::BinaryLog::EncodeRecordHeader(aFormatId, static_cast<uint8_t>(aLevel), static_cast<uint32_t>(aTimestamp),
+                                        static_cast<uint16_t>(aLength), aHeaders);
+
+    aIov[numIov].iov_base = aHeaders;
+    aIov[numIov].iov_len  = otbr::BinaryLog::kRecordHeaderSize;
+    numIov++;
+    aIov[numIov].iov_base = const_cast<void *>(aData);
+    aIov[numIov].iov_len  = aLength;
+    numIov++;
+
+    return numIov;
+}
+
+/**
+ * Write the records queued to the asynchronous logger, returns the number of records written
+ *
+ * Only one thread may read the ring at a time, this returns 0 if another one is. From a signal handler, records are
+ * only written to the log file, or to stderr if there is none, as syslog() is not async-signal-safe.
+ *
+ * Binary records are formatted here, unless they are only written to the binary log file.
+ */
+static size_t DrainLogRing(otbr::LogRing &aRing, bool aFromSignal)
+{
+    otbr::LogRing::Record *records[kLogWriterBatch];
+    struct iovec           iov[kLogWriterBatch * kLogEntryMaxIov];
+    char                   timestamps[kLogWriterBatch][kLogTimestampMaxSize];
+    uint8_t                headers[kLogWriterBatch][kLogEntryHeaderSize];
+    char                   text[otbr::LogRing::kMaxTextLength + 1];
+    bool                   binary = (sLogBinaryFd >= 0);
+    int                    fd     = (binary ? sLogBinaryFd
+                                            : (sLogFp != NULL ? fileno(sLogFp) : (aFromSignal ? STDERR_FILENO : -1)));
+    size_t                 total  = 0;
+    size_t                 count;
+    unsigned long          dropped;
+
+    VerifyOrExit(!sLogConsuming.exchange(true, std::memory_order_acquire));
+
+    while ((count = aRing.Read(records, kLogWriterBatch)) > 0)
+    {
+        int numIov = 0;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            otbr::LogRing::Record &record   = *records[i];
+            bool                   toSyslog = ((record.mFlags & LOGFLAG_syslog) && !aFromSignal);
+            bool                   toFile   = (fd >= 0 && ((record.mFlags & LOGFLAG_file) || aFromSignal));
+            const char *           line     = record.mText;
+            size_t                 length   = record.mLength;
+
+            if (record.mFormatId != 0 && (toSyslog || (toFile && !binary)))
+            {
+                length = FormatBinaryRecord(record, text, sizeof(text));
+                line   = text;
+            }
+
+            if (toSyslog)
+            {
+                syslog(record.mLevel, "%s", line);
+            }
+
+            if (toFile && binary)
+            {
+                numIov += AddBinaryEntry(record.mFormatId, record.mLevel, record.mTimestamp, record.mText,
+                                         record.mLength, headers[i], &iov[numIov]);
+            }
+            else if (toFile)
+            {
+                iov[numIov].iov_base = timestamps[i];
+                iov[numIov].iov_len  = FormatTimestamp(record.mTimestamp, timestamps[i]);
+                numIov++;
+
+                /* the text of a binary record replaces its arguments, which are not needed anymore */
+                if (line != record.mText)
+                {
+                    memcpy(record.mText, line, length);
+                }
+
+                /* logs do not end with a NEWLINE, we add one here */
+                record.mText[length] = '\n';
+                iov[numIov].iov_base = record.mText;
+                iov[numIov].iov_len  = length + 1U;
+                numIov++;
+            }
+        }
+
+        if (numIov > 0 && writev(fd, iov, numIov) < 0)
+        {
+            /* nothing better to do than losing these logs */
+        }
+
+        aRing.Release(count);
+        total += count;
+    }
+
+    dropped = aRing.GetDroppedCount();
+    if (dropped != sLogDroppedReported && !aFromSignal)
+    {
+        char                        line[64];
+        otbr::Format::StringBuilder builder(line, sizeof(line));
+
+        builder.AppendUnsigned(dropped - sLogDroppedReported).Append(" log messages dropped");
+        sLogDroppedReported = dropped;
+
+        syslog(LOG_WARNING, "%s", line);
+        if (binary)
+        {
+            int numIov = AddBinaryEntry(0, LOG_WARNING, GetMsecsNow(), line, builder.GetLength(), headers[0], iov);
+
+            if (writev(fd, iov, numIov) < 0)
+            {
+                /* nothing better to do than losing this log */
+            }
+        }
+        else if (sLogFp != NULL)
+        {
+            LogPrintf("%s\n", line);
+        }
+    }
+
+    sLogConsuming.store(false, std::memory_order_release);
+
+exit:
+    return total;
+}
+
+/** Main function of the thread writing the records queued to the asynchronous logger */
+static void LogWriterMain(otbr::LogRing *aRing)
+{
+    std::unique_lock<std::mutex> lock(sLogWriterMutex);
+
+    while (!sLogWriterStop)
+    {
+        lock.unlock();
+        DrainLogRing(*aRing, false);
+        lock.lock();
+
+        sLogFlushCondition.notify_all();
+
+        if (!sLogFlushRequested && !sLogWriterStop)
+        {
+            sLogWriterSleeping.store(true);
+            sLogWriterCondition.wait_for(lock, std::chrono::milliseconds(kLogWriterInterval));
+            sLogWriterSleeping.store(false);
+        }
+        sLogFlushRequested = false;
+    }
+
+    lock.unlock();
+    DrainLogRing(*aRing, false);
+}
+
+/** Wake the writer up early if the ring is getting full, so that it writes larger batches the rest of the time */
+static void WakeLogWriter(const otbr::LogRing &aRing)
+{
+    if ((aRing.GetPushedCount() - aRing.GetReleasedCount()) * 2 >= aRing.GetCapacity() &&
+        sLogWriterSleeping.exchange(false))
+    {
+        sLogWriterCondition.notify_one();
+    }
+}
+
+/** Stop the asynchronous logger, after writing all the records queued */
+static void StopLogWriter(void)
+{
+    otbr::LogRing *ring = sLogRing.exchange(NULL);
+
+    VerifyOrExit(ring != NULL);
+
+    {
+        std::lock_guard<std::mutex> lock(sLogWriterMutex);
+
+        sLogWriterStop = true;
+        sLogWriterCondition.notify_one();
+    }
+
+    sLogWriter->join();
+    delete sLogWriter;
+    sLogWriter = NULL;
+
+    /* a thread may still be logging into the ring, so it is not freed */
+    ring->Close();
+    DrainLogRing(*ring, false);
+
+    if (sLogFp != NULL)
+    {
+        fflush(sLogFp);
+    }
+
+exit:
+    return;
+}
+
+/** Write the records queued before the process dies */
+static void HandleCrash(int aSignal)
+{
+    otbr::LogRing *ring = sLogRing.load();
+
+    if (ring != NULL)
+    {
+        for (int i = 0; i < kLogCrashDrainTries && DrainLogRing(*ring, true) == 0; i++)
+        {
+            struct timespec delay = {0, 1000000};
+
+            /* the writer may own the ring, or there is nothing to write */
+            if (!sLogConsuming.load())
+            {
+                break;
+            }
+            nanosleep(&delay, NULL);
+        }
+    }
+
+    /* the default action was restored by SA_RESETHAND */
+    raise(aSignal);
+}
+
+void otbrLogEnableAsync(size_t aCapacity, int aOverflowPolicy)
+{
+    static const int kCrashSignals[] = {SIGABRT, SIGBUS, SIGFPE, SIGILL, SIGSEGV};
+
+    otbr::LogRing::OverflowPolicy policy;
+    otbr::LogRing *               ring;
+    struct sigaction              action;
+
+    assert(aOverflowPolicy == OTBR_LOG_OVERFLOW_DROP || aOverflowPolicy == OTBR_LOG_OVERFLOW_BLOCK);
+    policy = (aOverflowPolicy == OTBR_LOG_OVERFLOW_BLOCK) ? otbr::LogRing::kOverflowBlock
+                                                          : otbr::LogRing::kOverflowDrop;
+
+    StopLogWriter();
+
+    sLogWriterStop      = false;
+    sLogFlushRequested  = false;
+    sLogDroppedReported = 0;
+
+    ring       = new otbr::LogRing(aCapacity, policy);
+    sLogWriter = new std::thread(LogWriterMain, ring);
+    sLogRing.store(ring);
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = HandleCrash;
+    action.sa_flags   = SA_RESETHAND;
+    sigemptyset(&action.sa_mask);
+    for (size_t i = 0; i < sizeof(kCrashSignals) / sizeof(kCrashSignals[0]); i++)
+    {
+        sigaction(kCrashSignals[i], &action, NULL);
+    }
+
+    if (!sLogAtExitRegistered)
+    {
+        sLogAtExitRegistered = true;
+        atexit(StopLogWriter);
+    }
+}
+
+void otbrLogFlush(void)
+{
+    otbr::LogRing *ring = sLogRing.load();
+
+    if (ring != NULL)
+    {
+        std::unique_lock<std::mutex> lock(sLogWriterMutex);
+        size_t                       target = ring->GetPushedCount();
+
+        while (!sLogWriterStop && static_cast<ptrdiff_t>(ring->GetReleasedCount() - target) < 0)
+        {
+            sLogFlushRequested = true;
+            sLogWriterCondition.notify_one();
+            sLogFlushCondition.wait_for(lock, std::chrono::milliseconds(kLogFlushInterval));
+        }
+    }
+    else if (sLogFp != NULL)
+    {
+        fflush(sLogFp);
+    }
+}
+
+void otbrLogDeferredv(int aModule, int aLevel, uint16_t aFormatId, const uint8_t *aArgs, size_t aLength)
+{
+    int            r;
+    otbr::LogRing *ring;
+
+    assert(aArgs != NULL || aLength == 0);
+
+    r = LogCheck(aModule, aLevel);
+    VerifyOrExit(r != 0);
+
+    ring = sLogRing.load(std::memory_order_acquire);
+    if (ring != NULL)
+    {
+        WakeLogWriter(*ring);
+        ring->Push(aLevel, r, GetMsecsNow(), aFormatId, aArgs, aLength);
+    }
+    else
+    {
+        const char *format = otbr::BinaryLog::GetFormat(aFormatId);
+        char        text[otbr::LogRing::kMaxTextLength + 1];
+
+        VerifyOrExit(format != NULL);
+        otbr::BinaryLog::FormatArgs(format, aArgs, aLength, text, sizeof(text));
+        otbrLogModule(aModule, aLevel, "%s", text);
+    }
+
+exit:
+    return;
+}
+
+unsigned long otbrLogGetDroppedCount(void)
+{
+    otbr::LogRing *ring = sLogRing.load();
+
+    return ring != NULL ? ring->GetDroppedCount() : 0;
+}
+
 /** Initialize logging */
 void otbrLogInit(const char *aIdent, int aLevel, bool aPrintStderr)
 {
@@ -188,27 +719,37 @@ void otbrLogInit(const char *aIdent, int aLevel, bool aPrintStderr)
         sSyslogOpened = true;
         openlog(aIdent, (LOG_CONS | LOG_PID) | (aPrintStderr ? LOG_PERROR : 0), LOG_USER);
     }
-    sLevel = aLevel;
+    otbrLogSetLevel(aLevel);
 }
 
 /** log to the syslog or log file */
-void otbrLog(int aLevel, const char *aFormat, ...)
+void otbrLogModule(int aModule, int aLevel, const char *aFormat, ...)
 {
     va_list ap;
 
     va_start(ap, aFormat);
-    otbrLogv(aLevel, aFormat, ap);
+    otbrLogModulev(aModule, aLevel, aFormat, ap);
     va_end(ap);
 }
 
 /** log to the syslog or log file */
-void otbrLogv(int aLevel, const char *aFormat, va_list ap)
+void otbrLogModulev(int aModule, int aLevel, const char *aFormat, va_list ap)
 {
-    int r;
+    int            r;
+    otbr::LogRing *ring;
 
     assert(aFormat);
 
-    r = LogCheck(aLevel);
+    r = LogCheck(aModule, aLevel);
+    VerifyOrExit(r != 0);
+
+    ring = sLogRing.load(std::memory_order_acquire);
+    if (ring != NULL)
+    {
+        WakeLogWriter(*ring);
+        ring->Push(aLevel, r, GetMsecsNow(), aFormat, ap);
+        ExitNow();
+    }
 
     if (r & LOGFLAG_file)
     {
@@ -225,23 +766,94 @@ void otbrLogv(int aLevel, const char *aFormat, va_list ap)
     {
         vsyslog(aLevel, aFormat, ap);
     }
+
+exit:
+    return;
+}
+
+void otbrDumpSetLimits(unsigned int aRate, unsigned int aBurst, unsigned int aSampleRate, size_t aMaxSize)
+{
+    uint64_t interval = (aRate == 0 ? 0 : 1000000 / aRate);
+
+    assert(aBurst >= 1 && aSampleRate >= 1);
+
+    sDumpInterval.store(interval, std::memory_order_relaxed);
+    sDumpTolerance.store((aBurst - 1) * interval, std::memory_order_relaxed);
+    sDumpSampleRate.store(aSampleRate, std::memory_order_relaxed);
+    sDumpMaxSize.store(aMaxSize, std::memory_order_relaxed);
+}
+
+/** return the monotonic time, in microseconds */
+static uint64_t GetMicrosMonotonic(void)
+{
+    timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
+
+bool otbrDumpCheck(otbrDumpSite &aSite, int aModule, int aLevel, const char *aPrefix)
+{
+    uint64_t     interval   = sDumpInterval.load(std::memory_order_relaxed);
+    unsigned int sampleRate = sDumpSampleRate.load(std::memory_order_relaxed);
+    bool         allowed    = false;
+    unsigned int suppressed;
+
+    // Sampled out dumps take no token.
+    VerifyOrExit(sampleRate <= 1 || aSite.mCalls.fetch_add(1, std::memory_order_relaxed) % sampleRate == 0);
+
+    if (interval != 0)
+    {
+        uint64_t tolerance = sDumpTolerance.load(std::memory_order_relaxed);
+        uint64_t now       = GetMicrosMonotonic();
+        uint64_t next      = aSite.mNextAllowed.load(std::memory_order_relaxed);
+        uint64_t start;
+
+        // Each dump moves the time the bucket is full again by one interval, up to the tolerance ahead of now.
+        do
+        {
+            start = (next > now ? next : now);
+            VerifyOrExit(start - now <= tolerance);
+        } while (!aSite.mNextAllowed.compare_exchange_weak(next, start + interval, std::memory_order_relaxed));
+    }
+
+    allowed    = true;
+    suppressed = aSite.mSuppressed.exchange(0, std::memory_order_relaxed);
+    if (suppressed > 0)
+    {
+        otbrLogModule(aModule, aLevel, "%s: %u dumps suppressed", aPrefix, suppressed);
+    }
+
+exit:
+    if (!allowed)
+    {
+        aSite.mSuppressed.fetch_add(1, std::memory_order_relaxed);
+    }
+    return allowed;
 }
 
 /** Hex dump data to the log */
-void otbrDump(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize)
+void otbrDumpModule(int aModule, int aLevel, const char *aPrefix, const void *aMemory, size_t aSize)
 {
     assert(aPrefix && (aMemory || aSize == 0));
-    const uint8_t *pEnd;
     const uint8_t *p8;
     int            r;
     int            addr;
+    size_t         maxSize   = sDumpMaxSize.load(std::memory_order_relaxed);
+    size_t         truncated = 0;
 
-    r = LogCheck(aLevel);
+    r = LogCheck(aModule, aLevel);
     if (r == 0)
     {
         return;
     }
 
+    if (maxSize != 0 && aSize > maxSize)
+    {
+        truncated = aSize - maxSize;
+        aSize     = maxSize;
+    }
+
     /* break hex dumps into 16byte lines
      * In the form ADDR: XX XX XX XX ...
      */
@@ -265,24 +877,14 @@ void otbrDump(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize
         }
         aSize = aSize - this_size;
 
-        char *ch = hex - 1;
+        otbr::Format::StringBuilder(hex, sizeof(hex)).AppendHexBytes(p8, this_size, ' ');
 
-        for (pEnd = p8 + this_size; p8 < pEnd; p8++)
-        {
-            *++ch = kHexChars[(*p8) >> 4];
-            *++ch = kHexChars[(*p8) & 0x0f];
-            *++ch = ' ';
-        }
-        *ch = 0;
+        otbrLogModule(aModule, aLevel, "%s: %04x: %s", aPrefix, addr, hex);
+    }
 
-        if (r & LOGFLAG_syslog)
-        {
-            syslog(aLevel, "%s: %04x: %s", aPrefix, addr, hex);
-        }
-        if (r & LOGFLAG_file)
-        {
-            LogPrintf("%s: %04x: %s\n", aPrefix, addr, hex);
-        }
+    if (truncated > 0)
+    {
+        otbrLogModule(aModule, aLevel, "%s: %zu bytes truncated", aPrefix, truncated);
     }
 }
 
@@ -323,13 +925,20 @@ const char *otbrErrorString(otbrError aError)
     return error;
 }
 
-void otbrLogResult(const char *aAction, otbrError aError)
+void otbrLogResultModule(int aModule, const char *aAction, otbrError aError)
 {
-    otbrLog((aError == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING), "%s: %s", aAction, otbrErrorString(aError));
+    otbrLogModule(aModule, (aError == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING), "%s: %s", aAction,
+                  otbrErrorString(aError));
 }
 
 void otbrLogDeinit(void)
 {
+    StopLogWriter();
+    if (sLogBinaryFd >= 0)
+    {
+        close(sLogBinaryFd);
+        sLogBinaryFd = -1;
+    }
     sSyslogOpened = false;
     closelog();
 }
@@ -31,9 +31,13 @@
 
 #include "openthread-br/config.h"
 
+#include <atomic>
+
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 
+#include "common/log_binary.hpp"
 #include "common/types.hpp"
 
 /**
@@ -53,7 +57,47 @@ enum
 };
 
 /**
- * Change the log level
+ * Modules whose log levels are set independently
+ *
+ * A source file logs for a module by defining OTBR_LOG_MODULE before including any header.
+ *
+ */
+enum
+{
+    OTBR_LOG_MODULE_DEFAULT, /* logs of no module */
+    OTBR_LOG_MODULE_AGENT,   /* border agent */
+    OTBR_LOG_MODULE_DTLS,    /* DTLS sessions */
+    OTBR_LOG_MODULE_COAP,    /* CoAP agent */
+    OTBR_LOG_MODULE_DBUS,    /* D-Bus server */
+    OTBR_LOG_MODULE_MDNS,    /* mDNS publisher */
+    OTBR_LOG_MODULE_WEB,     /* web service */
+    OTBR_LOG_MODULE_UBUS,    /* ubus server */
+    OTBR_LOG_MODULE_NCP,     /* NCP controller */
+    OTBR_LOG_MODULE_NUM,
+};
+
+#ifndef OTBR_LOG_MODULE
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_DEFAULT
+#endif
+
+/**
+ * Logs above this level are compiled out, this is OTBR_LOG_DEBUG by default
+ */
+#ifndef OTBR_LOG_LEVEL_MAX
+#define OTBR_LOG_LEVEL_MAX 7
+#endif
+
+/**
+ * What the asynchronous logger does when its buffer is full
+ */
+enum
+{
+    OTBR_LOG_OVERFLOW_DROP,  /* drop the log, and count it */
+    OTBR_LOG_OVERFLOW_BLOCK, /* wait for the writer thread to make room */
+};
+
+/**
+ * Change the log level, of all the modules
  *
  * @param[in]   alevel  new log level
  */
@@ -61,10 +105,69 @@ enum
 void otbrLogSetLevel(int aLevel);
 
 /**
- * Get current log level
+ * Get current log level, of the logs of no module
  */
 int otbrLogGetLevel(void);
 
+/**
+ * Change the log level of a module
+ *
+ * @param[in]   aModule the module
+ * @param[in]   aLevel  new log level
+ */
+void otbrLogSetModuleLevel(int aModule, int aLevel);
+
+/**
+ * Get current log level of a module
+ *
+ * @param[in]   aModule the module
+ */
+int otbrLogGetModuleLevel(int aModule);
+
+/**
+ * Change the log levels of modules
+ *
+ * The levels are a list of MODULE=LEVEL, separated by commas or white spaces, where MODULE is the name of a module or
+ * "all", and LEVEL is a number from 0 to 7. Nothing is changed if the list is invalid.
+ *
+ * @param[in]   aLevels the list of levels, such as "dtls=7,coap=6"
+ *
+ * @retval OTBR_ERROR_NONE  Successfully changed the levels.
+ * @retval OTBR_ERROR_ERRNO Failed to parse the levels, errno is set to EINVAL.
+ *
+ */
+otbrError otbrLogSetModuleLevels(const char *aLevels);
+
+/**
+ * Get the name of a module
+ *
+ * @param[in]   aModule the module
+ */
+const char *otbrLogGetModuleName(int aModule);
+
+namespace otbr {
+
+/**
+ * The log level of each module, only for otbrLogIsEnabled()
+ *
+ */
+extern std::atomic<int> gLogModuleLevels[OTBR_LOG_MODULE_NUM];
+
+} // namespace otbr
+
+/**
+ * This function returns whether logs of a module at a level are enabled, it is checked before evaluating the
+ * arguments of the logs.
+ *
+ * @param[in]   aModule The module.
+ * @param[in]   aLevel  The log level.
+ *
+ */
+inline bool otbrLogIsEnabled(int aModule, int aLevel)
+{
+    return aLevel <= OTBR_LOG_LEVEL_MAX && aLevel <= otbr::gLogModuleLevels[aModule].load(std::memory_order_relaxed);
+}
+
 /**
  * Control log to syslog
  *
@@ -81,6 +184,16 @@ void otbrLogEnableSyslog(bool aEnabled);
  */
 void otbrLogSetFilename(const char *aFilename);
 
+/**
+ * This function causes the asynchronous logger to write binary records to a specific file, instead of the log file.
+ *
+ * The records logged with otbrLogDeferred() are written without being formatted, and the file is decoded by
+ * the log-decode tool. Records logged with otbrLog() are written as text.
+ *
+ * @param[in] aFilename filename to use for the binary log file.
+ */
+void otbrLogSetBinaryFilename(const char *aFilename);
+
 /**
  * This function initialize the logging service.
  *
@@ -92,37 +205,130 @@ void otbrLogSetFilename(const char *aFilename);
 void otbrLogInit(const char *aIdent, int aLevel, bool aPrintStderr);
 
 /**
- * This function log at level @p aLevel.
+ * This function log at level @p aLevel for module @p aModule.
  *
+ * @param[in]   aModule The module.
  * @param[in]   aLevel  Log level of the logger.
  * @param[in]   aFormat Format string as in printf.
  *
  */
-void otbrLog(int aLevel, const char *aFormat, ...);
+void otbrLogModule(int aModule, int aLevel, const char *aFormat, ...);
 
 /**
- * This function log a action result according to @p aError.
+ * This macro log at level @p aLevel for the module of the source file.
+ *
+ * The arguments are not evaluated if the level is not enabled.
+ *
+ * @param[in]   aLevel  Log level of the logger.
+ * @param[in]   ...     Format string as in printf, followed by its arguments.
+ *
+ */
+#define otbrLog(aLevel, ...)                                                                                        \
+    (otbrLogIsEnabled(OTBR_LOG_MODULE, (aLevel)) ? otbrLogModule(OTBR_LOG_MODULE, (aLevel), __VA_ARGS__) : (void)0)
+
+/**
+ * This function log a action result according to @p aError, for module @p aModule.
  *
  * If @p aError is OTBR_ERROR_NONE, the log level will be OTBR_LOG_INFO,
  * otherwise OTBR_LOG_WARNING.
  *
+ * @param[in]   aModule The module.
  * @param[in]   aAction The action description.
  * @param[in]   aError  The action result.
  *
  */
-void otbrLogResult(const char *aAction, otbrError aError);
+void otbrLogResultModule(int aModule, const char *aAction, otbrError aError);
 
 /**
- * This function log at level @p aLevel.
+ * This macro log a action result according to @p aError, for the module of the source file.
  *
+ * @param[in]   aAction The action description.
+ * @param[in]   aError  The action result.
+ *
+ */
+#define otbrLogResult(aAction, aError) otbrLogResultModule(OTBR_LOG_MODULE, (aAction), (aError))
+
+/**
+ * This function log at level @p aLevel for module @p aModule.
+ *
+ * @param[in]   aModule The module.
  * @param[in]   aLevel  Log level of the logger.
  * @param[in]   aFormat Format string as in printf.
  *
  */
-void otbrLogv(int aLevel, const char *aFormat, va_list);
+void otbrLogModulev(int aModule, int aLevel, const char *aFormat, va_list);
 
 /**
- * This function dump memory as hex string at level @p aLevel.
+ * This macro log at level @p aLevel for the module of the source file.
+ *
+ * @param[in]   aLevel  Log level of the logger.
+ * @param[in]   aFormat Format string as in printf.
+ * @param[in]   aArgs   The arguments.
+ *
+ */
+#define otbrLogv(aLevel, aFormat, aArgs) otbrLogModulev(OTBR_LOG_MODULE, (aLevel), (aFormat), aArgs)
+
+/**
+ * This structure holds the rate limiting state of a call site of otbrDump().
+ *
+ * It must have static storage duration, so that it starts zeroed.
+ *
+ */
+struct otbrDumpSite
+{
+    std::atomic<uint64_t>     mNextAllowed; ///< microseconds when the bucket is full again
+    std::atomic<unsigned int> mCalls;       ///< number of dumps, for sampling
+    std::atomic<unsigned int> mSuppressed;  ///< number of dumps suppressed since the last written one
+};
+
+/**
+ * Change the limits of hex dumps
+ *
+ * Each call site of otbrDump() writes at most @p aRate dumps per second, with bursts of @p aBurst dumps, and only one
+ * dump out of @p aSampleRate. Dumps are truncated to their first @p aMaxSize bytes. Dumps are not limited until
+ * this function is called.
+ *
+ * @param[in]   aRate       max dumps per second of each call site, 0 for no limit
+ * @param[in]   aBurst      max dumps written in a burst, at least 1
+ * @param[in]   aSampleRate one dump out of this number is written, 1 to write all
+ * @param[in]   aMaxSize    max bytes of a dump, 0 for no limit
+ */
+void otbrDumpSetLimits(unsigned int aRate, unsigned int aBurst, unsigned int aSampleRate, size_t aMaxSize);
+
+/**
+ * This function decides whether a dump of call site @p aSite is written.
+ *
+ * When the dump is written, the number of dumps suppressed before it, if any, is logged first.
+ *
+ * @param[in]   aSite   The call site.
+ * @param[in]   aModule The module.
+ * @param[in]   aLevel  Log level of the logger.
+ * @param[in]   aPrefix String before dumping memory.
+ *
+ * @returns Whether the dump is written.
+ *
+ */
+bool otbrDumpCheck(otbrDumpSite &aSite, int aModule, int aLevel, const char *aPrefix);
+
+/**
+ * This function dump memory as hex string at level @p aLevel for module @p aModule.
+ *
+ * The dump is truncated as set by otbrDumpSetLimits(), but not rate limited.
+ *
+ * @param[in]   aModule The module.
+ * @param[in]   aLevel  Log level of the logger.
+ * @param[in]   aPrefix String before dumping memory.
+ * @param[in]   aMemory The pointer to the memory to be dumped.
+ * @param[in]   aSize   The size of memory in bytes to be dumped.
+ *
+ */
+void otbrDumpModule(int aModule, int aLevel, const char *aPrefix, const void *aMemory, size_t aSize);
+
+/**
+ * This macro dump memory as hex string at level @p aLevel for the module of the source file.
+ *
+ * Dumps are rate limited, sampled and truncated as set by otbrDumpSetLimits(), and nothing is formatted when the
+ * level is disabled.
  *
  * @param[in]   aLevel  Log level of the logger.
  * @param[in]   aPrefix String before dumping memory.
@@ -130,7 +336,17 @@ void otbrLogv(int aLevel, const char *aFormat, va_list);
  * @param[in]   aSize   The size of memory in bytes to be dumped.
  *
  */
-void otbrDump(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize);
+#define otbrDump(aLevel, aPrefix, aMemory, aSize)                                     \
+    do                                                                                \
+    {                                                                                 \
+        static otbrDumpSite sOtbrDumpSite;                                            \
+                                                                                      \
+        if (otbrLogIsEnabled(OTBR_LOG_MODULE, (aLevel)) &&                            \
+            otbrDumpCheck(sOtbrDumpSite, OTBR_LOG_MODULE, (aLevel), (aPrefix)))       \
+        {                                                                             \
+            otbrDumpModule(OTBR_LOG_MODULE, (aLevel), (aPrefix), (aMemory), (aSize)); \
+        }                                                                             \
+    } while (false)
 
 /**
  * This function converts error code to string.
@@ -142,10 +358,91 @@ void otbrDump(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize
  */
 const char *otbrErrorString(otbrError aError);
 
+/**
+ * This function makes logs be written by a background thread, instead of the thread logging them.
+ *
+ * Logs are formatted into a lock-free ring buffer, and written to the syslog and the log file in batches. They are
+ * flushed by otbrLogFlush(), otbrLogDeinit() and at exit, and written to the log file, or to stderr, when the process
+ * crashes. The log file must be set before.
+ *
+ * @param[in]   aCapacity       Number of logs the buffer holds.
+ * @param[in]   aOverflowPolicy OTBR_LOG_OVERFLOW_DROP or OTBR_LOG_OVERFLOW_BLOCK.
+ *
+ */
+void otbrLogEnableAsync(size_t aCapacity, int aOverflowPolicy);
+
+/**
+ * This function waits until all the logs so far are written.
+ *
+ */
+void otbrLogFlush(void);
+
+/**
+ * This function returns the number of logs the asynchronous logger dropped as its buffer was full.
+ *
+ */
+unsigned long otbrLogGetDroppedCount(void);
+
 /**
  * This function deinitializes the logging service.
  *
  */
 void otbrLogDeinit(void);
 
+/**
+ * This function logs a record whose formatting is deferred, see otbrLogDeferred().
+ *
+ * @param[in]   aModule     The module.
+ * @param[in]   aLevel      Log level of the logger.
+ * @param[in]   aFormatId   ID of the format string, returned by otbr::BinaryLog::RegisterFormat().
+ * @param[in]   aArgs       A pointer to the arguments, encoded by otbr::BinaryLog::ArgsEncoder.
+ * @param[in]   aLength     Length of the encoded arguments.
+ *
+ */
+void otbrLogDeferredv(int aModule, int aLevel, uint16_t aFormatId, const uint8_t *aArgs, size_t aLength);
+
+/**
+ * This function encodes the arguments of otbrLogDeferred().
+ *
+ * Logs are formatted right away if the format string could not be registered.
+ *
+ */
+template <typename... Args>
+void otbrLogDeferredArgs(int aModule, int aLevel, uint16_t aFormatId, const char *aFormat, const Args &... aArgs)
+{
+    if (aFormatId != 0)
+    {
+        otbr::BinaryLog::ArgsEncoder encoder;
+
+        encoder.Add(aArgs...);
+        otbrLogDeferredv(aModule, aLevel, aFormatId, encoder.GetArgs(), encoder.GetLength());
+    }
+    else
+    {
+        otbrLogModule(aModule, aLevel, aFormat, aArgs...);
+    }
+}
+
+/**
+ * This macro logs at level @p aLevel for the module of the source file, deferring the formatting.
+ *
+ * The format string is registered once per call site, and only its ID and the raw arguments are queued. With the
+ * asynchronous logger, they are formatted by the writer thread, or written as is to the binary log file. Otherwise,
+ * they are formatted right away. Arguments must be integers, enumerations, floating point numbers, strings or
+ * pointers.
+ *
+ * @param[in]   aLevel  Log level of the logger.
+ * @param[in]   ...     Format string as in printf, followed by its arguments.
+ *
+ */
+#define otbrLogDeferred(aLevel, ...)                                                            \
+    (otbrLogIsEnabled(OTBR_LOG_MODULE, (aLevel))                                                \
+         ? [&](void) {                                                                          \
+               static const uint16_t sOtbrLogFormatId =                                         \
+                   otbr::BinaryLog::RegisterFormat(otbr::BinaryLog::GetFormatArg(__VA_ARGS__)); \
+                                                                                                \
+               otbrLogDeferredArgs(OTBR_LOG_MODULE, (aLevel), sOtbrLogFormatId, __VA_ARGS__);   \
+           }()                                                                                  \
+         : (void)0)
+
 #endif // OTBR_COMMON_LOGGING_HPP_
@@ -223,6 +223,38 @@ enum
     kIPv6Address             = 49,
 };
 
+/**
+ * MeshCoP TLV types of the operational dataset.
+ *
+ */
+enum
+{
+    kChannel          = 0,
+    kPanId            = 1,
+    kExtendedPanId    = 2,
+    kNetworkName      = 3,
+    kPskc             = 4,
+    kMasterKey        = 5,
+    kMeshLocalPrefix  = 7,
+    kSecurityPolicy   = 12,
+    kActiveTimestamp  = 14,
+    kPendingTimestamp = 51,
+    kDelayTimer       = 52,
+    kChannelMask      = 53,
+};
+
+/**
+ * MeshCoP TLV types of the energy scan and PAN ID query.
+ *
+ */
+enum
+{
+    kCount        = 54,
+    kPeriod       = 55,
+    kScanDuration = 56,
+    kEnergyList   = 57,
+};
+
 enum
 {
     kStateAccepted = 1,
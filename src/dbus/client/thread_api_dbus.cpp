@@ -125,6 +125,14 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 {
     (void)aConnection;
 
+    DeviceRoleFilter(aMessage);
+    CountersDeltaFilter(aMessage);
+
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
+void ThreadApiDBus::DeviceRoleFilter(DBusMessage *aMessage)
+{
     DBusMessageIter iter, subIter, dictEntryIter, valIter;
     std::string     interfaceName, propertyName, val;
     DeviceRole      role;
@@ -136,14 +144,23 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 
     VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
     dbus_message_iter_recurse(&iter, &subIter);
-    VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
-    dbus_message_iter_recurse(&subIter, &dictEntryIter);
-    SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+
+    // Properties changed together are sent in one signal.
+    while (true)
+    {
+        VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+        if (propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE)
+        {
+            break;
+        }
+        dbus_message_iter_next(&subIter);
+    }
+
     VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
     dbus_message_iter_recurse(&dictEntryIter, &valIter);
     SuccessOrExit(DBusMessageExtract(&valIter, val));
-
-    VerifyOrExit(propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
     SuccessOrExit(NameToDeviceRole(val, role));
 
     for (const auto &f : mDeviceRoleHandlers)
@@ -151,7 +168,24 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
         f(role);
     }
 exit:
-    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    return;
+}
+
+void ThreadApiDBus::CountersDeltaFilter(DBusMessage *aMessage)
+{
+    uint32_t              elapsed;
+    std::vector<uint32_t> deltas;
+    auto                  args = std::tie(elapsed, deltas);
+
+    VerifyOrExit(dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_COUNTERS_DELTA_SIGNAL));
+    SuccessOrExit(DBusMessageToTuple(*aMessage, args));
+
+    for (const auto &f : mCountersDeltaHandlers)
+    {
+        f(elapsed, deltas);
+    }
+exit:
+    return;
 }
 
 void ThreadApiDBus::AddDeviceRoleHandler(const DeviceRoleHandler &aHandler)
@@ -159,6 +193,11 @@ void ThreadApiDBus::AddDeviceRoleHandler(const DeviceRoleHandler &aHandler)
     mDeviceRoleHandlers.push_back(aHandler);
 }
 
+void ThreadApiDBus::AddCountersDeltaHandler(const CountersDeltaHandler &aHandler)
+{
+    mCountersDeltaHandlers.push_back(aHandler);
+}
+
 ClientError ThreadApiDBus::Scan(const ScanHandler &aHandler)
 {
     ClientError error = ClientError::ERROR_NONE;
@@ -358,6 +397,28 @@ ClientError ThreadApiDBus::RemoveExternalRoute(const Ip6Prefix &aPrefix)
     return CallDBusMethodSync(OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD, std::tie(aPrefix));
 }
 
+ClientError ThreadApiDBus::SetLogLevels(const std::string &aLevels)
+{
+    return CallDBusMethodSync(OTBR_DBUS_SET_LOG_LEVELS_METHOD, std::tie(aLevels));
+}
+
+ClientError ThreadApiDBus::SubscribeCounters(const std::vector<std::string> &aCounters, uint32_t aPeriod)
+{
+    return CallDBusMethodSync(OTBR_DBUS_SUBSCRIBE_COUNTERS_METHOD, std::tie(aCounters, aPeriod));
+}
+
+ClientError ThreadApiDBus::UnsubscribeCounters(void)
+{
+    return CallDBusMethodSync(OTBR_DBUS_UNSUBSCRIBE_COUNTERS_METHOD);
+}
+
+ClientError ThreadApiDBus::GetTelemetry(uint32_t aFields, Telemetry &aTelemetry)
+{
+    auto reply = std::tie(aTelemetry);
+
+    return CallDBusMethodSync(OTBR_DBUS_GET_TELEMETRY_METHOD, std::tie(aFields), reply);
+}
+
 ClientError ThreadApiDBus::SetMeshLocalPrefix(const std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> &aPrefix)
 {
     return SetProperty(OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX, aPrefix);
@@ -575,6 +636,29 @@ exit:
     return ret;
 }
 
+template <typename ArgType, typename ReplyType>
+ClientError ThreadApiDBus::CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs, ReplyType &aReply)
+{
+    ClientError             ret = ClientError::ERROR_NONE;
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
+    DBus::UniqueDBusMessage reply = nullptr;
+    DBusError               error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(otbr::DBus::TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error) && reply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(reply.get()));
+    VerifyOrExit(otbr::DBus::DBusMessageToTuple(*reply, aReply) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
 template <typename ArgType>
 ClientError ThreadApiDBus::CallDBusMethodAsync(const std::string &           aMethodName,
                                                const ArgType &               aArgs,
@@ -46,9 +46,10 @@ bool IsThreadActive(DeviceRole aRole);
 class ThreadApiDBus
 {
 public:
-    using DeviceRoleHandler = std::function<void(DeviceRole)>;
-    using ScanHandler       = std::function<void(const std::vector<ActiveScanResult> &)>;
-    using OtResultHandler   = std::function<void(ClientError)>;
+    using DeviceRoleHandler    = std::function<void(DeviceRole)>;
+    using ScanHandler          = std::function<void(const std::vector<ActiveScanResult> &)>;
+    using OtResultHandler      = std::function<void(ClientError)>;
+    using CountersDeltaHandler = std::function<void(uint32_t aElapsed, const std::vector<uint32_t> &aDeltas)>;
 
     /**
      * The constructor of a d-bus object.
@@ -77,6 +78,17 @@ public:
      */
     void AddDeviceRoleHandler(const DeviceRoleHandler &aHandler);
 
+    /**
+     * This method adds a callback for the counters deltas.
+     *
+     * The handler is called every period of the subscription with the milliseconds elapsed since the previous delta
+     * and the increments of the subscribed counters, in the subscribed order.
+     *
+     * @param[in]   aHandler  The counters delta handler.
+     *
+     */
+    void AddCountersDeltaHandler(const CountersDeltaHandler &aHandler);
+
     /**
      * This method permits unsecure join on port.
      *
@@ -231,6 +243,56 @@ public:
      */
     ClientError RemoveExternalRoute(const Ip6Prefix &aPrefix);
 
+    /**
+     * This method changes the log levels of modules of the agent.
+     *
+     * @param[in]   aLevels     The levels, such as "dtls=7,coap=6".
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError SetLogLevels(const std::string &aLevels);
+
+    /**
+     * This method subscribes to deltas of counters, replacing the previous subscription.
+     *
+     * The subscription is removed when the client leaves the bus.
+     *
+     * @param[in]   aCounters   The counters, such as "LinkCounters.TxTotal" or "Ip6Counters.RxSuccess".
+     * @param[in]   aPeriod     The milliseconds between two deltas.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError SubscribeCounters(const std::vector<std::string> &aCounters, uint32_t aPeriod);
+
+    /**
+     * This method removes the subscription to deltas of counters.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError UnsubscribeCounters(void);
+
+    /**
+     * This method gets the telemetry, captured by the agent at once.
+     *
+     * @param[in]   aFields     The sections to capture, bitmask of TelemetryField.
+     * @param[out]  aTelemetry  The telemetry, with the sections present in its mFields.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetTelemetry(uint32_t aFields, Telemetry &aTelemetry);
+
     /**
      * This method sets the mesh-local prefix.
      *
@@ -594,6 +656,9 @@ private:
 
     template <typename ArgType> ClientError CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs);
 
+    template <typename ArgType, typename ReplyType>
+    ClientError CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs, ReplyType &aReply);
+
     template <typename ArgType>
     ClientError CallDBusMethodAsync(const std::string &           aMethodName,
                                     const ArgType &               aArgs,
@@ -606,6 +671,8 @@ private:
     ClientError              SubscribeDeviceRoleSignal(void);
     static DBusHandlerResult sDBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        DBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage);
+    void                     DeviceRoleFilter(DBusMessage *aMessage);
+    void                     CountersDeltaFilter(DBusMessage *aMessage);
 
     template <void (ThreadApiDBus::*Handler)(DBusPendingCall *aPending)>
     static void sHandleDBusPendingCall(DBusPendingCall *aPending, void *aThreadApiDBus);
@@ -627,7 +694,8 @@ private:
     OtResultHandler mFactoryResetHandler;
     OtResultHandler mJoinerHandler;
 
-    std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+    std::vector<DeviceRoleHandler>    mDeviceRoleHandlers;
+    std::vector<CountersDeltaHandler> mCountersDeltaHandlers;
 };
 
 } // namespace DBus
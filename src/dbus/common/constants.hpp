@@ -37,6 +37,8 @@
 #define OTBR_DBUS_SERVER_PREFIX "io.openthread.BorderRouter."
 #define OTBR_DBUS_THREAD_INTERFACE "io.openthread.BorderRouter"
 #define OTBR_DBUS_OBJECT_PREFIX "/io/openthread/BorderRouter/"
+#define OTBR_DBUS_COMMISSIONER_INTERFACE "io.openthread.BorderRouter.Commissioner"
+#define OTBR_DBUS_COMMISSIONER_NAME "Commissioner"
 
 #define OTBR_DBUS_SCAN_METHOD "Scan"
 #define OTBR_DBUS_ATTACH_METHOD "Attach"
@@ -49,6 +51,16 @@
 #define OTBR_DBUS_JOINER_STOP_METHOD "JoinerStop"
 #define OTBR_DBUS_ADD_EXTERNAL_ROUTE_METHOD "AddExternalRoute"
 #define OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD "RemoveExternalRoute"
+#define OTBR_DBUS_SET_LOG_LEVELS_METHOD "SetLogLevels"
+#define OTBR_DBUS_SUBSCRIBE_COUNTERS_METHOD "SubscribeCounters"
+#define OTBR_DBUS_UNSUBSCRIBE_COUNTERS_METHOD "UnsubscribeCounters"
+#define OTBR_DBUS_GET_TELEMETRY_METHOD "GetTelemetry"
+#define OTBR_DBUS_ADD_JOINER_METHOD "AddJoiner"
+#define OTBR_DBUS_REMOVE_JOINER_METHOD "RemoveJoiner"
+#define OTBR_DBUS_COMMISSIONER_STATUS_METHOD "Status"
+
+#define OTBR_DBUS_JOINER_STATE_CHANGED_SIGNAL "JoinerStateChanged"
+#define OTBR_DBUS_COUNTERS_DELTA_SIGNAL "CountersDelta"
 
 #define OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX "MeshLocalPrefix"
 #define OTBR_DBUS_PROPERTY_LEGACY_ULA_PREFIX "LegacyULAPrefix"
@@ -85,4 +97,6 @@
 #define OTBR_ROLE_NAME_ROUTER "router"
 #define OTBR_ROLE_NAME_LEADER "leader"
 
+#define OTBR_DBUS_TELEMETRY_VERSION 1
+
 #endif // OTBR_DBUS_CONSTANTS_HPP_
@@ -29,6 +29,7 @@
 #ifndef DBUS_MESSAGE_HELPER_HPP_
 #define DBUS_MESSAGE_HELPER_HPP_
 
+#include <algorithm>
 #include <array>
 #include <string>
 #include <tuple>
@@ -68,9 +69,55 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const LeaderData &aLeaderDat
 otbrError DBusMessageExtract(DBusMessageIter *aIter, LeaderData &aLeaderData);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelQuality &aQuality);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelQuality &aQuality);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const Telemetry &aTelemetry);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, Telemetry &aTelemetry);
 
 template <typename T> struct DBusTypeTrait;
 
+template <size_t... I> struct IndexSequence
+{
+};
+
+template <size_t N, size_t... I> struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, I...>
+{
+};
+
+template <size_t... I> struct MakeIndexSequence<0, I...>
+{
+    using Type = IndexSequence<I...>;
+};
+
+constexpr size_t SignatureLength(const char *aSignature)
+{
+    return *aSignature == '\0' ? 0 : 1 + SignatureLength(aSignature + 1);
+}
+
+/**
+ * This class builds the signature of an array of @p T at compile time.
+ *
+ */
+template <typename T, typename = typename MakeIndexSequence<SignatureLength(DBusTypeTrait<T>::TYPE_AS_STRING)>::Type>
+struct DBusArraySignature;
+
+template <typename T, size_t... I> struct DBusArraySignature<T, IndexSequence<I...>>
+{
+    static constexpr char kValue[] = {DBUS_TYPE_ARRAY, DBusTypeTrait<T>::TYPE_AS_STRING[I]..., '\0'};
+};
+
+template <typename T, size_t... I> constexpr char DBusArraySignature<T, IndexSequence<I...>>::kValue[];
+
+template <typename T> struct DBusTypeTrait<std::vector<T>>
+{
+    static constexpr int         TYPE           = DBUS_TYPE_ARRAY;
+    static constexpr const char *TYPE_AS_STRING = DBusArraySignature<T>::kValue;
+};
+
+template <typename T, size_t SIZE> struct DBusTypeTrait<std::array<T, SIZE>>
+{
+    static constexpr int         TYPE           = DBUS_TYPE_ARRAY;
+    static constexpr const char *TYPE_AS_STRING = DBusArraySignature<T>::kValue;
+};
+
 template <> struct DBusTypeTrait<IpCounters>
 {
     // struct of 32 bytes
@@ -89,18 +136,6 @@ template <> struct DBusTypeTrait<LinkModeConfig>
     static constexpr const char *TYPE_AS_STRING = "(bbbb)";
 };
 
-template <> struct DBusTypeTrait<std::vector<uint8_t>>
-{
-    // array of bytes
-    static constexpr const char *TYPE_AS_STRING = "ay";
-};
-
-template <size_t SIZE> struct DBusTypeTrait<std::array<uint8_t, SIZE>>
-{
-    // array of bytes
-    static constexpr const char *TYPE_AS_STRING = "ay";
-};
-
 template <> struct DBusTypeTrait<Ip6Prefix>
 {
     // struct of {array of bytes, byte}
@@ -113,24 +148,12 @@ template <> struct DBusTypeTrait<ExternalRoute>
     static constexpr const char *TYPE_AS_STRING = "((ayy)qybb)";
 };
 
-template <> struct DBusTypeTrait<std::vector<ExternalRoute>>
-{
-    // array of {{array of bytes, byte}, uint16, byte, bool, bool}
-    static constexpr const char *TYPE_AS_STRING = "a((ayy)qybb)";
-};
-
 template <> struct DBusTypeTrait<LeaderData>
 {
     // struct of { uint32, byte, byte, byte, byte }
     static constexpr const char *TYPE_AS_STRING = "(uyyyy)";
 };
 
-template <> struct DBusTypeTrait<std::vector<ChannelQuality>>
-{
-    // array of struct of { uint8, uint16 }
-    static constexpr const char *TYPE_AS_STRING = "a(yq)";
-};
-
 template <> struct DBusTypeTrait<NeighborInfo>
 {
     // struct of { uint64, uint32, uint16, uint32, uint32, uint8,
@@ -138,13 +161,6 @@ template <> struct DBusTypeTrait<NeighborInfo>
     static constexpr const char *TYPE_AS_STRING = "(tuquuyyyqqbbbbb)";
 };
 
-template <> struct DBusTypeTrait<std::vector<NeighborInfo>>
-{
-    // array of struct of { uint64, uint32, uint16, uint32, uint32, uint8,
-    //                      uint8, uint8, uint16, uint16, bool, bool, bool, bool }
-    static constexpr const char *TYPE_AS_STRING = "a(tuquuyyyqqbbbbb)";
-};
-
 template <> struct DBusTypeTrait<ChildInfo>
 {
     // struct of { uint64, uint32, uint32, uint16, uint16, uint8, uint8,
@@ -166,14 +182,6 @@ template <> struct DBusTypeTrait<ChannelQuality>
     static constexpr const char *TYPE_AS_STRING = "(yq)";
 };
 
-template <> struct DBusTypeTrait<std::vector<ChildInfo>>
-{
-    // array of struct of { uint64, uint32, uint32, uint16, uint16, uint8, uint8,
-    //                      uint8, uint8, uint16, uint16, bool, bool, bool, bool,
-    //                      bool}
-    static constexpr const char *TYPE_AS_STRING = "a(tuuqqyyyyqqbbbbb)";
-};
-
 template <> struct DBusTypeTrait<int8_t>
 {
     static constexpr int         TYPE           = DBUS_TYPE_BYTE;
@@ -228,6 +236,13 @@ template <> struct DBusTypeTrait<std::string>
     static constexpr const char *TYPE_AS_STRING = DBUS_TYPE_STRING_AS_STRING;
 };
 
+// A string extracted as a C string is valid as long as the message.
+template <> struct DBusTypeTrait<const char *>
+{
+    static constexpr int         TYPE           = DBUS_TYPE_STRING;
+    static constexpr const char *TYPE_AS_STRING = DBUS_TYPE_STRING_AS_STRING;
+};
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, bool aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, int8_t aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::string &aValue);
@@ -295,6 +310,7 @@ template <typename T> otbrError DBusMessageExtractPrimitive(DBusMessageIter *aIt
     VerifyOrExit(dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_ARRAY, error = OTBR_ERROR_DBUS);
     dbus_message_iter_recurse(aIter, &subIter);
 
+    aValue.clear();
     subtype = dbus_message_iter_get_arg_type(&subIter);
     if (subtype != DBUS_TYPE_INVALID)
     {
@@ -303,7 +319,7 @@ template <typename T> otbrError DBusMessageExtractPrimitive(DBusMessageIter *aIt
 
         if (val != nullptr)
         {
-            aValue = std::vector<T>(val, val + n);
+            aValue.assign(val, val + n);
         }
     }
     dbus_message_iter_next(aIter);
@@ -335,6 +351,11 @@ template <typename T, size_t SIZE> otbrError DBusMessageExtract(DBusMessageIter
             std::copy(val, val + n, aValue.begin());
         }
     }
+    else
+    {
+        // An empty array only fits an array of zero elements.
+        VerifyOrExit(SIZE == 0, error = OTBR_ERROR_DBUS);
+    }
     dbus_message_iter_next(aIter);
 
 exit:
@@ -440,5 +440,41 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const Telemetry &aTelemetry)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+    auto            args  = std::tie(aTelemetry.mVersion, aTelemetry.mFields, aTelemetry.mDeviceRole,
+                         aTelemetry.mPartitionId, aTelemetry.mRloc16, aTelemetry.mLeaderData,
+                         aTelemetry.mChildTable, aTelemetry.mNeighborTable, aTelemetry.mNetworkData,
+                         aTelemetry.mStableNetworkData, aTelemetry.mLinkCounters, aTelemetry.mIp6Counters,
+                         aTelemetry.mChannelMonitorSampleCount, aTelemetry.mChannelQualities);
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, Telemetry &aTelemetry)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+    auto            args  = std::tie(aTelemetry.mVersion, aTelemetry.mFields, aTelemetry.mDeviceRole,
+                         aTelemetry.mPartitionId, aTelemetry.mRloc16, aTelemetry.mLeaderData,
+                         aTelemetry.mChildTable, aTelemetry.mNeighborTable, aTelemetry.mNetworkData,
+                         aTelemetry.mStableNetworkData, aTelemetry.mLinkCounters, aTelemetry.mIp6Counters,
+                         aTelemetry.mChannelMonitorSampleCount, aTelemetry.mChannelQualities);
+
+    // Fields appended by newer versions are skipped.
+    VerifyOrExit(dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_STRUCT, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_recurse(aIter, &sub);
+    SuccessOrExit(error = ConvertToTuple(&sub, args));
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 } // namespace DBus
 } // namespace otbr
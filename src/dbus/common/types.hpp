@@ -488,6 +488,47 @@ struct LeaderData
     uint8_t  mLeaderRouterId;    ///< Leader Router ID
 };
 
+/**
+ * This enumeration defines the sections of the telemetry.
+ *
+ */
+enum TelemetryField
+{
+    OTBR_TELEMETRY_STATE           = 1 << 0, ///< Device role, partition ID and RLOC16
+    OTBR_TELEMETRY_LEADER_DATA     = 1 << 1, ///< Leader data
+    OTBR_TELEMETRY_CHILD_TABLE     = 1 << 2, ///< Child table
+    OTBR_TELEMETRY_NEIGHBOR_TABLE  = 1 << 3, ///< Neighbor table
+    OTBR_TELEMETRY_NETWORK_DATA    = 1 << 4, ///< Full and stable network data
+    OTBR_TELEMETRY_COUNTERS        = 1 << 5, ///< Link and IPv6 counters
+    OTBR_TELEMETRY_CHANNEL_MONITOR = 1 << 6, ///< Channel monitor sample count and channel qualities
+    OTBR_TELEMETRY_ALL             = (1 << 7) - 1,
+};
+
+/**
+ * This structure represents the telemetry captured at once.
+ *
+ * New fields are only appended, along with a new version, so that older clients still decode the fields they know.
+ * The fields of a section missing from @p mFields hold default values.
+ *
+ */
+struct Telemetry
+{
+    uint16_t                    mVersion;                   ///< The version of the telemetry layout
+    uint32_t                    mFields;                    ///< The sections present, bitmask of TelemetryField
+    std::string                 mDeviceRole;                ///< Device role name
+    uint32_t                    mPartitionId;               ///< Partition ID
+    uint16_t                    mRloc16;                    ///< RLOC16
+    LeaderData                  mLeaderData;                ///< Leader data
+    std::vector<ChildInfo>      mChildTable;                ///< Child table
+    std::vector<NeighborInfo>   mNeighborTable;             ///< Neighbor table
+    std::vector<uint8_t>        mNetworkData;               ///< Full network data
+    std::vector<uint8_t>        mStableNetworkData;         ///< Stable network data
+    MacCounters                 mLinkCounters;              ///< Link counters
+    IpCounters                  mIp6Counters;               ///< IPv6 counters
+    uint32_t                    mChannelMonitorSampleCount; ///< Channel monitor sample count
+    std::vector<ChannelQuality> mChannelQualities;          ///< Channel qualities
+};
+
 } // namespace DBus
 } // namespace otbr
 
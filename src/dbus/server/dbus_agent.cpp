@@ -26,6 +26,8 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_DBUS
+
 #include "dbus/server/dbus_agent.hpp"
 #include "common/logging.hpp"
 #include "dbus/common/constants.hpp"
@@ -43,144 +45,34 @@ DBusAgent::DBusAgent(const std::string &aInterfaceName, otbr::Ncp::ControllerOpe
 
 otbrError DBusAgent::Init(void)
 {
-    DBusError   dbusError;
-    otbrError   error = OTBR_ERROR_NONE;
-    int         requestReply;
-    std::string serverName = OTBR_DBUS_SERVER_PREFIX + mInterfaceName;
+    otbrError error;
+
+    SuccessOrExit(error = Connect(OTBR_DBUS_SERVER_PREFIX + mInterfaceName));
+    mThreadObject = std::unique_ptr<DBusThreadObject>(new DBusThreadObject(GetConnection(), mInterfaceName, mNcp));
+    SetObject(mThreadObject.get());
+    error = mThreadObject->Init();
 
-    dbus_error_init(&dbusError);
-    DBusConnection *conn = dbus_bus_get(DBUS_BUS_SYSTEM, &dbusError);
-    mConnection          = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>(
-        conn, [](DBusConnection *aConnection) { dbus_connection_unref(aConnection); });
-    VerifyOrExit(mConnection != nullptr, error = OTBR_ERROR_DBUS);
-    dbus_bus_register(mConnection.get(), &dbusError);
-    requestReply =
-        dbus_bus_request_name(mConnection.get(), serverName.c_str(), DBUS_NAME_FLAG_REPLACE_EXISTING, &dbusError);
-    VerifyOrExit(requestReply == DBUS_REQUEST_NAME_REPLY_PRIMARY_OWNER ||
-                     requestReply == DBUS_REQUEST_NAME_REPLY_ALREADY_OWNER,
-                 error = OTBR_ERROR_DBUS);
-    VerifyOrExit(dbus_connection_set_watch_functions(mConnection.get(), AddDBusWatch, RemoveDBusWatch, ToggleDBusWatch,
-                                                     this, NULL));
-    mThreadObject = std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, mNcp));
-    error         = mThreadObject->Init();
 exit:
-    dbus_error_free(&dbusError);
-    if (error != OTBR_ERROR_NONE)
-    {
-        otbrLog(OTBR_LOG_ERR, "dbus error %s: %s", dbusError.name, dbusError.message);
-    }
     return error;
 }
 
-dbus_bool_t DBusAgent::AddDBusWatch(struct DBusWatch *aWatch, void *aContext)
-{
-    static_cast<DBusAgent *>(aContext)->mWatches[aWatch] = true;
-    return TRUE;
-}
-
-void DBusAgent::RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext)
-{
-    static_cast<DBusAgent *>(aContext)->mWatches.erase(aWatch);
-}
-
-void DBusAgent::ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext)
+void DBusAgent::UpdateTimeout(struct timeval &aTimeOut)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches[aWatch] = (dbus_watch_get_enabled(aWatch) ? true : false);
-}
+    unsigned long delay;
 
-void DBusAgent::UpdateFdSet(fd_set &        aReadFdSet,
-                            fd_set &        aWriteFdSet,
-                            fd_set &        aErrorFdSet,
-                            int &           aMaxFd,
-                            struct timeval &aTimeOut)
-{
-    DBusWatch *  watch = NULL;
-    unsigned int flags;
-    int          fd;
+    DBusAgentBase::UpdateTimeout(aTimeOut);
 
-    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    // Counters deltas are sent by Process() once they are due.
+    if (mThreadObject->GetCountersDeltaDelay(delay))
     {
-        aTimeOut = {0, 0};
-    }
-
-    for (const auto &p : mWatches)
-    {
-        if (!p.second)
-        {
-            continue;
-        }
-
-        watch = p.first;
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
-
-        if (fd < 0)
-        {
-            continue;
-        }
-
-        if (flags & DBUS_WATCH_READABLE)
-        {
-            FD_SET(fd, &aReadFdSet);
-        }
-
-        if ((flags & DBUS_WATCH_WRITABLE) && dbus_connection_has_messages_to_send(mConnection.get()))
-        {
-            FD_SET(fd, &aWriteFdSet);
-        }
-
-        FD_SET(fd, &aErrorFdSet);
-
-        if (fd > aMaxFd)
-        {
-            aMaxFd = fd;
-        }
+        LowerTimeout(aTimeOut, delay);
     }
 }
 
-void DBusAgent::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+void DBusAgent::ProcessDeferred(void)
 {
-    DBusWatch *  watch = NULL;
-    unsigned int flags;
-    int          fd;
-
-    for (const auto &p : mWatches)
-    {
-        if (!p.second)
-        {
-            continue;
-        }
-
-        watch = p.first;
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
-
-        if (fd < 0)
-        {
-            continue;
-        }
-
-        if ((flags & DBUS_WATCH_READABLE) && !FD_ISSET(fd, &aReadFdSet))
-        {
-            flags &= static_cast<unsigned int>(~DBUS_WATCH_READABLE);
-        }
-
-        if ((flags & DBUS_WATCH_WRITABLE) && !FD_ISSET(fd, &aWriteFdSet))
-        {
-            flags &= static_cast<unsigned int>(~DBUS_WATCH_WRITABLE);
-        }
-
-        if (FD_ISSET(fd, &aErrorFdSet))
-        {
-            flags |= DBUS_WATCH_ERROR;
-        }
-
-        dbus_watch_handle(watch, flags);
-    }
-
-    while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_get_dispatch_status(mConnection.get()) &&
-           dbus_connection_read_write_dispatch(mConnection.get(), 0))
-        ;
+    DBusAgentBase::ProcessDeferred();
+    mThreadObject->SendCountersDeltas();
 }
 
 } // namespace DBus
@@ -35,6 +35,7 @@
 
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
+#include "dbus/server/dbus_agent_base.hpp"
 #include "dbus/server/dbus_object.hpp"
 #include "dbus/server/dbus_thread_object.hpp"
 
@@ -43,7 +44,7 @@
 namespace otbr {
 namespace DBus {
 
-class DBusAgent
+class DBusAgent : public DBusAgentBase
 {
 public:
     /**
@@ -63,51 +64,16 @@ public:
      */
     otbrError Init(void);
 
-    /**
-     * This method performs the dbus select update.
-     *
-     * @param[out]      aReadFdSet   The read file descriptors.
-     * @param[out]      aWriteFdSet  The write file descriptors.
-     * @param[out]      aErorFdSet   The error file descriptors.
-     * @param[inout]    aMaxFd       The max file descriptor.
-     * @param[inout]    aTimeOut     The select timeout.
-     *
-     */
-    void UpdateFdSet(fd_set &        aReadFdSet,
-                     fd_set &        aWriteFdSet,
-                     fd_set &        aErrorFdSet,
-                     int &           aMaxFd,
-                     struct timeval &aTimeOut);
-
-    /**
-     * This method processes the dbus I/O.
-     *
-     * @param[in]       aReadFdSet   The read file descriptors.
-     * @param[in]       aWriteFdSet  The write file descriptors.
-     * @param[in]       aErorFdSet   The error file descriptors.
-     *
-     */
-    void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet);
+protected:
+    void UpdateTimeout(struct timeval &aTimeOut) override;
+    void ProcessDeferred(void) override;
 
 private:
-    static dbus_bool_t AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
-    static void        RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
-    static void        ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext);
-
     static const struct timeval kPollTimeout;
 
     std::string                       mInterfaceName;
     std::unique_ptr<DBusThreadObject> mThreadObject;
-    using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
-    UniqueDBusConnection             mConnection;
-    otbr::Ncp::ControllerOpenThread *mNcp;
-
-    /**
-     * This map is used to track DBusWatch-es.
-     *
-     */
-    using WatchMap = std::map<DBusWatch *, bool>;
-    WatchMap mWatches;
+    otbr::Ncp::ControllerOpenThread * mNcp;
 };
 
 } // namespace DBus
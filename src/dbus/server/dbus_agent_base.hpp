@@ -0,0 +1,167 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the base of the d-bus agents.
+ */
+
+#ifndef OTBR_DBUS_AGENT_BASE_HPP_
+#define OTBR_DBUS_AGENT_BASE_HPP_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <sys/select.h>
+
+#include <dbus/dbus.h>
+
+#include "common/types.hpp"
+#include "dbus/server/dbus_object.hpp"
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class owns a system bus connection, and drives its I/O and the deferred work of its object from the mainloop.
+ *
+ */
+class DBusAgentBase
+{
+public:
+    /**
+     * The destructor of the d-bus agent base.
+     *
+     */
+    virtual ~DBusAgentBase(void) {}
+
+    /**
+     * This method performs the dbus select update.
+     *
+     * @param[out]      aReadFdSet   The read file descriptors.
+     * @param[out]      aWriteFdSet  The write file descriptors.
+     * @param[out]      aErorFdSet   The error file descriptors.
+     * @param[inout]    aMaxFd       The max file descriptor.
+     * @param[inout]    aTimeOut     The select timeout.
+     *
+     */
+    void UpdateFdSet(fd_set &        aReadFdSet,
+                     fd_set &        aWriteFdSet,
+                     fd_set &        aErrorFdSet,
+                     int &           aMaxFd,
+                     struct timeval &aTimeOut);
+
+    /**
+     * This method processes the dbus I/O.
+     *
+     * @param[in]       aReadFdSet   The read file descriptors.
+     * @param[in]       aWriteFdSet  The write file descriptors.
+     * @param[in]       aErorFdSet   The error file descriptors.
+     *
+     */
+    void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet);
+
+protected:
+    /**
+     * The constructor of the d-bus agent base.
+     *
+     */
+    DBusAgentBase(void);
+
+    /**
+     * This method connects to the system bus and requests a name on it.
+     *
+     * @param[in]   aServerName     The bus name.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully connected and owned the name.
+     * @retval OTBR_ERROR_DBUS  Failed to connect or to own the name.
+     *
+     */
+    otbrError Connect(const std::string &aServerName);
+
+    /**
+     * This method returns the system bus connection.
+     *
+     * @returns The connection, nullptr before Connect().
+     *
+     */
+    DBusConnection *GetConnection(void) const { return mConnection.get(); }
+
+    /**
+     * This method sets the object whose changed properties and calls in flight are handled by the agent.
+     *
+     * @param[in]   aObject     A pointer to the object.
+     *
+     */
+    void SetObject(DBusObject *aObject) { mObject = aObject; }
+
+    /**
+     * This method lowers the select timeout to when the deferred work of the agent is due.
+     *
+     * @param[inout]    aTimeOut     The select timeout.
+     *
+     */
+    virtual void UpdateTimeout(struct timeval &aTimeOut);
+
+    /**
+     * This method performs the deferred work of the agent which is due.
+     *
+     */
+    virtual void ProcessDeferred(void);
+
+    /**
+     * This method lowers the select timeout to a delay.
+     *
+     * @param[inout]    aTimeOut     The select timeout.
+     * @param[in]       aDelay       The delay in milliseconds.
+     *
+     */
+    static void LowerTimeout(struct timeval &aTimeOut, unsigned long aDelay);
+
+private:
+    static dbus_bool_t AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    static void        RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    static void        ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext);
+
+    using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
+    UniqueDBusConnection mConnection;
+    DBusObject *         mObject;
+
+    /**
+     * This map is used to track DBusWatch-es.
+     *
+     */
+    using WatchMap = std::map<DBusWatch *, bool>;
+    WatchMap mWatches;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_AGENT_BASE_HPP_
@@ -0,0 +1,264 @@
+/*
+ *    Copyright (c) 2019, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_DBUS
+
+#include <algorithm>
+
+#include <limits.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/time.hpp"
+#include "dbus/common/constants.hpp"
+#include "dbus/server/dbus_counters_publisher.hpp"
+
+static std::string GetNameOwnerChangedRule(const std::string &aName)
+{
+    return "type='signal',sender='" DBUS_SERVICE_DBUS "',interface='" DBUS_INTERFACE_DBUS
+           "',member='NameOwnerChanged',arg0='" +
+           aName + "'";
+}
+
+namespace otbr {
+namespace DBus {
+
+DBusCountersPublisher::DBusCountersPublisher(DBusObject &         aObject,
+                                             DBusConnection *     aConnection,
+                                             const std::string &  aInterfaceName,
+                                             const CounterFinder &aFinder,
+                                             const CounterReader &aReader)
+    : mObject(aObject)
+    , mConnection(aConnection)
+    , mInterfaceName(aInterfaceName)
+    , mFinder(aFinder)
+    , mReader(aReader)
+    , mFilterAdded(false)
+{
+}
+
+DBusCountersPublisher::~DBusCountersPublisher(void)
+{
+    while (!mSubscriptions.empty())
+    {
+        RemoveSubscription(mSubscriptions.back().mSubscriber);
+    }
+
+    if (mFilterAdded)
+    {
+        dbus_connection_remove_filter(mConnection, sNameOwnerChangedFilter, this);
+    }
+}
+
+otbrError DBusCountersPublisher::Init(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // Subscriptions are removed when their subscribers leave the bus.
+    VerifyOrExit(dbus_connection_add_filter(mConnection, sNameOwnerChangedFilter, this, nullptr),
+                 error = OTBR_ERROR_DBUS);
+    mFilterAdded = true;
+
+exit:
+    return error;
+}
+
+void DBusCountersPublisher::SubscribeHandler(DBusRequest &aRequest)
+{
+    const char *             subscriber = dbus_message_get_sender(aRequest.GetMessage());
+    std::vector<std::string> counters;
+    uint32_t                 period;
+    auto                     args = std::tie(counters, period);
+    Subscription             subscription;
+    otError                  error = OT_ERROR_NONE;
+
+    VerifyOrExit(subscriber != nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(!counters.empty() && period >= kMinPeriod, error = OT_ERROR_INVALID_ARGS);
+
+    subscription.mSubscriber = subscriber;
+    subscription.mPeriod     = period;
+    subscription.mLastSent   = GetNow();
+    for (const auto &name : counters)
+    {
+        uint8_t index;
+
+        VerifyOrExit(mFinder(name, index), error = OT_ERROR_INVALID_ARGS);
+        subscription.mCounters.push_back(index);
+        subscription.mValues.push_back(mReader(index));
+    }
+
+    SuccessOrExit(error = AddSubscription(std::move(subscription)));
+    otbrLog(OTBR_LOG_INFO, "%s subscribed to %zu counters every %u ms", subscriber, counters.size(), period);
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusCountersPublisher::UnsubscribeHandler(DBusRequest &aRequest)
+{
+    const char *subscriber = dbus_message_get_sender(aRequest.GetMessage());
+    otError     error      = OT_ERROR_NONE;
+
+    VerifyOrExit(subscriber != nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(RemoveSubscription(subscriber), error = OT_ERROR_NOT_FOUND);
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+otError DBusCountersPublisher::AddSubscription(Subscription &&aSubscription)
+{
+    std::string rule  = GetNameOwnerChangedRule(aSubscription.mSubscriber);
+    otError     error = OT_ERROR_NONE;
+
+    for (auto &subscription : mSubscriptions)
+    {
+        if (subscription.mSubscriber == aSubscription.mSubscriber)
+        {
+            subscription = std::move(aSubscription);
+            ExitNow();
+        }
+    }
+
+    VerifyOrExit(mSubscriptions.size() < kMaxSubscriptions, error = OT_ERROR_NO_BUFS);
+
+    // Only the owner changes of the subscribers are routed to the agent. The subscriber may have left before the
+    // match was added, and the bus handles the calls of a connection in order, so its owner is checked afterwards.
+    dbus_bus_add_match(mConnection, rule.c_str(), nullptr);
+    if (!dbus_bus_name_has_owner(mConnection, aSubscription.mSubscriber.c_str(), nullptr))
+    {
+        dbus_bus_remove_match(mConnection, rule.c_str(), nullptr);
+        ExitNow(error = OT_ERROR_INVALID_STATE);
+    }
+
+    mSubscriptions.push_back(std::move(aSubscription));
+
+exit:
+    return error;
+}
+
+bool DBusCountersPublisher::RemoveSubscription(const std::string &aSubscriber)
+{
+    bool removed = false;
+
+    for (auto it = mSubscriptions.begin(); it != mSubscriptions.end(); ++it)
+    {
+        if (it->mSubscriber == aSubscriber)
+        {
+            dbus_bus_remove_match(mConnection, GetNameOwnerChangedRule(aSubscriber).c_str(), nullptr);
+            mSubscriptions.erase(it);
+            removed = true;
+            break;
+        }
+    }
+
+    return removed;
+}
+
+DBusHandlerResult DBusCountersPublisher::sNameOwnerChangedFilter(DBusConnection *aConnection,
+                                                                 DBusMessage *   aMessage,
+                                                                 void *          aData)
+{
+    (void)aConnection;
+
+    return static_cast<DBusCountersPublisher *>(aData)->NameOwnerChangedFilter(aMessage);
+}
+
+DBusHandlerResult DBusCountersPublisher::NameOwnerChangedFilter(DBusMessage *aMessage)
+{
+    std::string name, oldOwner, newOwner;
+    auto        args = std::tie(name, oldOwner, newOwner);
+
+    VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_DBUS, "NameOwnerChanged"));
+    VerifyOrExit(DBusMessageToTuple(*aMessage, args) == OTBR_ERROR_NONE);
+    VerifyOrExit(newOwner.empty());
+
+    if (RemoveSubscription(name))
+    {
+        otbrLog(OTBR_LOG_INFO, "%s left, counters subscription removed", name.c_str());
+    }
+
+exit:
+    // Other filters may be interested in the signal as well.
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
+bool DBusCountersPublisher::GetDeltaDelay(unsigned long &aDelay) const
+{
+    unsigned long now = GetNow();
+
+    aDelay = ULONG_MAX;
+    for (const auto &subscription : mSubscriptions)
+    {
+        unsigned long elapsed = now - subscription.mLastSent;
+
+        aDelay = std::min(aDelay, elapsed >= subscription.mPeriod ? 0 : subscription.mPeriod - elapsed);
+    }
+
+    return !mSubscriptions.empty();
+}
+
+void DBusCountersPublisher::SendDeltas(void)
+{
+    unsigned long         now = GetNow();
+    std::vector<uint32_t> deltas;
+
+    for (auto &subscription : mSubscriptions)
+    {
+        uint32_t  elapsed = static_cast<uint32_t>(now - subscription.mLastSent);
+        otbrError error;
+
+        if (elapsed < subscription.mPeriod)
+        {
+            continue;
+        }
+
+        deltas.clear();
+        for (size_t i = 0; i < subscription.mCounters.size(); i++)
+        {
+            uint32_t value = mReader(subscription.mCounters[i]);
+
+            // Counters restart from zero when their source is reset.
+            deltas.push_back(value >= subscription.mValues[i] ? value - subscription.mValues[i] : value);
+            subscription.mValues[i] = value;
+        }
+        subscription.mLastSent = now;
+
+        error = mObject.Signal(mInterfaceName, OTBR_DBUS_COUNTERS_DELTA_SIGNAL, std::tie(elapsed, deltas),
+                               subscription.mSubscriber.c_str());
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to send counters delta to %s: %s", subscription.mSubscriber.c_str(),
+                    otbrErrorString(error));
+        }
+    }
+}
+
+} // namespace DBus
+} // namespace otbr
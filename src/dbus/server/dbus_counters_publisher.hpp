@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2019, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the publisher of counters deltas to the d-bus clients subscribed to them.
+ */
+
+#ifndef OTBR_DBUS_COUNTERS_PUBLISHER_HPP_
+#define OTBR_DBUS_COUNTERS_PUBLISHER_HPP_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <dbus/dbus.h>
+
+#include "dbus/server/dbus_object.hpp"
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class sends the deltas of counters to the d-bus clients subscribed to them.
+ *
+ * Each client has at most one subscription, which a new subscription replaces. A subscription is removed when its
+ * client unsubscribes or leaves the bus.
+ *
+ */
+class DBusCountersPublisher
+{
+public:
+    using CounterFinder = std::function<bool(const std::string &aName, uint8_t &aIndex)>;
+
+    using CounterReader = std::function<uint32_t(uint8_t aIndex)>;
+
+    /**
+     * The constructor of a counters publisher.
+     *
+     * @param[in]   aObject         The d-bus object sending the deltas.
+     * @param[in]   aConnection     The dbus-connection of the object.
+     * @param[in]   aInterfaceName  The interface name of the deltas signal.
+     * @param[in]   aFinder         The function looking up the index of a counter by its name.
+     * @param[in]   aReader         The function reading the value of a counter by its index.
+     *
+     */
+    DBusCountersPublisher(DBusObject &         aObject,
+                          DBusConnection *     aConnection,
+                          const std::string &  aInterfaceName,
+                          const CounterFinder &aFinder,
+                          const CounterReader &aReader);
+
+    /**
+     * The destructor of a counters publisher.
+     *
+     */
+    ~DBusCountersPublisher(void);
+
+    /**
+     * This method initializes the counters publisher.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully initialized.
+     * @retval  OTBR_ERROR_DBUS   Failed to watch the subscribers leaving the bus.
+     *
+     */
+    otbrError Init(void);
+
+    /**
+     * This method handles a call subscribing its sender to counters.
+     *
+     * @param[in]   aRequest    The call, with the names of the counters and the period in milliseconds.
+     *
+     */
+    void SubscribeHandler(DBusRequest &aRequest);
+
+    /**
+     * This method handles a call removing the subscription of its sender.
+     *
+     * @param[in]   aRequest    The call.
+     *
+     */
+    void UnsubscribeHandler(DBusRequest &aRequest);
+
+    /**
+     * This method returns the number of clients subscribed to counters.
+     *
+     */
+    size_t GetSubscriptionCount(void) const { return mSubscriptions.size(); }
+
+    /**
+     * This method returns when the next counters delta is due to be sent.
+     *
+     * @param[out]  aDelay  Milliseconds before the next counters delta is due.
+     *
+     * @returns Whether any client subscribed to counters.
+     *
+     */
+    bool GetDeltaDelay(unsigned long &aDelay) const;
+
+    /**
+     * This method sends the counters deltas which are due to their subscribers.
+     *
+     */
+    void SendDeltas(void);
+
+private:
+    enum
+    {
+        kMinPeriod        = 100, ///< Min milliseconds between two counters deltas.
+        kMaxSubscriptions = 16,  ///< Max number of clients subscribed to counters.
+    };
+
+    struct Subscription
+    {
+        std::string           mSubscriber; ///< The unique bus name of the subscriber.
+        std::vector<uint8_t>  mCounters;   ///< The indexes of the subscribed counters.
+        std::vector<uint32_t> mValues;     ///< The values of the counters when the last delta was sent.
+        unsigned long         mPeriod;     ///< Milliseconds between two deltas.
+        unsigned long         mLastSent;   ///< When the last delta was sent, in milliseconds.
+    };
+
+    otError                  AddSubscription(Subscription &&aSubscription);
+    bool                     RemoveSubscription(const std::string &aSubscriber);
+    static DBusHandlerResult sNameOwnerChangedFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
+    DBusHandlerResult        NameOwnerChangedFilter(DBusMessage *aMessage);
+
+    DBusObject &              mObject;
+    DBusConnection *          mConnection;
+    std::string               mInterfaceName;
+    CounterFinder             mFinder;
+    CounterReader             mReader;
+    std::vector<Subscription> mSubscriptions;
+    bool                      mFilterAdded;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_COUNTERS_PUBLISHER_HPP_
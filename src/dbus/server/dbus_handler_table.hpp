@@ -0,0 +1,198 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions of the table of d-bus handlers.
+ */
+
+#ifndef OTBR_DBUS_DBUS_HANDLER_TABLE_HPP_
+#define OTBR_DBUS_DBUS_HANDLER_TABLE_HPP_
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <string.h>
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class implements a table of handlers, keyed by an interface and a member name.
+ *
+ * Each interface name is stored once, with the members of the interface sorted when they are added. A lookup finds the
+ * interface, then the member by binary search, comparing the C strings taken from a message without allocating.
+ *
+ */
+template <typename HandlerType> class DBusHandlerTable
+{
+public:
+    /**
+     * This structure represents a member of an interface.
+     *
+     */
+    struct Entry
+    {
+        std::string mMember;  ///< The member name.
+        HandlerType mHandler; ///< The handler.
+    };
+
+    /**
+     * This structure represents an interface.
+     *
+     */
+    struct Interface
+    {
+        std::string        mName;    ///< The interface name.
+        std::vector<Entry> mMembers; ///< The members, sorted by name.
+    };
+
+    using Iterator          = typename std::vector<Entry>::iterator;
+    using InterfaceIterator = typename std::vector<Interface>::iterator;
+
+    /**
+     * This method adds a handler.
+     *
+     * @param[in]   aInterface  The interface name.
+     * @param[in]   aMember     The member name.
+     * @param[in]   aHandler    The handler.
+     *
+     * @returns Whether the handler is added, it is not if the member is already in the table.
+     *
+     */
+    bool Add(const std::string &aInterface, const std::string &aMember, HandlerType aHandler)
+    {
+        std::vector<Entry> *members = FindMembers(aInterface.c_str());
+        Iterator            iter;
+        bool                added = false;
+
+        if (members == nullptr)
+        {
+            mInterfaces.push_back(Interface{aInterface, std::vector<Entry>()});
+            members = &mInterfaces.back().mMembers;
+        }
+
+        iter = LowerBound(*members, aMember.c_str());
+        if (iter == members->end() || strcmp(iter->mMember.c_str(), aMember.c_str()) != 0)
+        {
+            members->insert(iter, Entry{aMember, std::move(aHandler)});
+            added = true;
+        }
+
+        return added;
+    }
+
+    /**
+     * This method finds the handler of a member.
+     *
+     * @param[in]   aInterface  The interface name.
+     * @param[in]   aMember     The member name.
+     *
+     * @returns The handler, or nullptr if the member is not in the table.
+     *
+     */
+    HandlerType *Find(const char *aInterface, const char *aMember)
+    {
+        std::vector<Entry> *members = FindMembers(aInterface);
+        HandlerType *       handler = nullptr;
+
+        if (members != nullptr)
+        {
+            Iterator iter = LowerBound(*members, aMember);
+
+            if (iter != members->end() && strcmp(iter->mMember.c_str(), aMember) == 0)
+            {
+                handler = &iter->mHandler;
+            }
+        }
+
+        return handler;
+    }
+
+    /**
+     * This method finds the members of an interface.
+     *
+     * @param[in]   aInterface  The interface name.
+     *
+     * @returns The range of the members, which is empty if the interface is not in the table.
+     *
+     */
+    std::pair<Iterator, Iterator> FindInterface(const char *aInterface)
+    {
+        std::vector<Entry> *members = FindMembers(aInterface);
+
+        return members != nullptr ? std::make_pair(members->begin(), members->end())
+                                  : std::make_pair(Iterator(), Iterator());
+    }
+
+    /**
+     * This method returns the first interface.
+     *
+     */
+    InterfaceIterator begin(void) { return mInterfaces.begin(); }
+
+    /**
+     * This method returns the end of the interfaces.
+     *
+     */
+    InterfaceIterator end(void) { return mInterfaces.end(); }
+
+private:
+    // An object only has a few interfaces.
+    std::vector<Entry> *FindMembers(const char *aInterface)
+    {
+        std::vector<Entry> *members = nullptr;
+
+        for (Interface &interface : mInterfaces)
+        {
+            if (strcmp(interface.mName.c_str(), aInterface) == 0)
+            {
+                members = &interface.mMembers;
+                break;
+            }
+        }
+
+        return members;
+    }
+
+    static Iterator LowerBound(std::vector<Entry> &aMembers, const char *aMember)
+    {
+        return std::lower_bound(aMembers.begin(), aMembers.end(), aMember, [](const Entry &aEntry, const char *aKey) {
+            return strcmp(aEntry.mMember.c_str(), aKey) < 0;
+        });
+    }
+
+    std::vector<Interface> mInterfaces;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_DBUS_HANDLER_TABLE_HPP_
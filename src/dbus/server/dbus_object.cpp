@@ -26,12 +26,19 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_DBUS
+
+#include <algorithm>
+
 #include <assert.h>
+#include <limits.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <dbus/dbus.h>
 
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "dbus/server/dbus_object.hpp"
 
 using std::placeholders::_1;
@@ -40,7 +47,14 @@ namespace otbr {
 namespace DBus {
 
 DBusObject::DBusObject(DBusConnection *aConnection, const std::string &aObjectPath)
-    : mConnection(aConnection)
+    : mPropertySnapshotInterval(OTBR_DBUS_PROPERTY_SNAPSHOT_INTERVAL)
+    , mPropertySnapshotGeneration(0)
+    , mChangedProperties(0)
+    , mPropertiesChangedInterval(0)
+    , mLastPropertiesChanged(0)
+    , mMaxRequestsInFlight(OTBR_DBUS_MAX_REQUESTS_IN_FLIGHT)
+    , mNextRequestId(0)
+    , mConnection(aConnection)
     , mObjectPath(aObjectPath)
 {
 }
@@ -70,27 +84,346 @@ void DBusObject::RegisterMethod(const std::string &      aInterfaceName,
                                 const std::string &      aMethodName,
                                 const MethodHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aMethodName;
+    bool added = mMethodHandlers.Add(aInterfaceName, aMethodName, aHandler);
+
+    assert(added);
+    (void)added;
+}
+
+void DBusObject::RegisterAsyncMethod(const std::string &      aInterfaceName,
+                                     const std::string &      aMethodName,
+                                     const MethodHandlerType &aHandler,
+                                     unsigned long            aTimeout,
+                                     unsigned int             aMaxInFlight)
+{
+    AsyncMethod *method = new AsyncMethod();
+
+    method->mHandler     = aHandler;
+    method->mTimeout     = aTimeout;
+    method->mMaxInFlight = aMaxInFlight;
+    method->mInFlight    = 0;
+    mAsyncMethods.emplace_back(method);
+
+    RegisterMethod(aInterfaceName, aMethodName,
+                   std::bind(&DBusObject::AsyncMethodHandler, this, std::ref(*method), std::placeholders::_1));
+}
+
+void DBusObject::SetMaxRequestsInFlight(unsigned int aMaxInFlight)
+{
+    mMaxRequestsInFlight = aMaxInFlight;
+}
+
+void DBusObject::AsyncMethodHandler(AsyncMethod &aMethod, DBusRequest &aRequest)
+{
+    unsigned long id;
+
+    if (aMethod.mInFlight >= aMethod.mMaxInFlight || mPendingRequests.size() >= mMaxRequestsInFlight)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Too many calls of %s in flight", dbus_message_get_member(aRequest.GetMessage()));
+        aRequest.ReplyOtResult(OT_ERROR_BUSY);
+        ExitNow();
+    }
+
+    id = mNextRequestId++;
+    ++aMethod.mInFlight;
+    aRequest.SetReplyCallback(std::bind(&DBusObject::CompleteRequest, this, id));
+    mPendingRequests.push_back({aRequest, &aMethod, GetNow(), id, false});
+
+    aMethod.mHandler(aRequest);
+
+exit:
+    return;
+}
 
-    assert(mMethodHandlers.find(fullPath) == mMethodHandlers.end());
-    mMethodHandlers.emplace(fullPath, aHandler);
+void DBusObject::CompleteRequest(unsigned long aId)
+{
+    for (auto it = mPendingRequests.begin(); it != mPendingRequests.end(); ++it)
+    {
+        if (it->mId == aId)
+        {
+            --it->mMethod->mInFlight;
+            mPendingRequests.erase(it);
+            break;
+        }
+    }
 }
 
 void DBusObject::RegisterGetPropertyHandler(const std::string &        aInterfaceName,
                                             const std::string &        aPropertyName,
                                             const PropertyHandlerType &aHandler)
 {
-    mGetPropertyHandlers[aInterfaceName].emplace(aPropertyName, aHandler);
+    GetPropertyHandler handler{aHandler, PropertySnapshot(), false, 0, 0};
+
+    mGetPropertyHandlers.Add(aInterfaceName, aPropertyName, std::move(handler));
+    mAllPropertiesSnapshots.Add(aInterfaceName, DBUS_PROPERTY_GET_ALL_METHOD, PropertySnapshot());
 }
 
 void DBusObject::RegisterSetPropertyHandler(const std::string &        aInterfaceName,
                                             const std::string &        aPropertyName,
                                             const PropertyHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aPropertyName;
+    bool added = mSetPropertyHandlers.Add(aInterfaceName, aPropertyName, aHandler);
+
+    assert(added);
+    (void)added;
+}
+
+void DBusObject::SetPropertySnapshotInterval(unsigned long aInterval)
+{
+    mPropertySnapshotInterval = aInterval;
+    InvalidatePropertySnapshots();
+}
+
+void DBusObject::InvalidatePropertySnapshots(void)
+{
+    mPropertySnapshotGeneration++;
+}
+
+DBusMessage *DBusObject::FindPropertySnapshot(const PropertySnapshot &aSnapshot) const
+{
+    DBusMessage *snapshot = nullptr;
+
+    VerifyOrExit(aSnapshot.mMessage != nullptr && aSnapshot.mGeneration == mPropertySnapshotGeneration);
+    VerifyOrExit(GetNow() - aSnapshot.mTimestamp < mPropertySnapshotInterval);
+    snapshot = aSnapshot.mMessage.get();
+
+exit:
+    return snapshot;
+}
+
+DBusMessage *DBusObject::SavePropertySnapshot(PropertySnapshot &aSnapshot, UniqueDBusMessage aMessage)
+{
+    aSnapshot.mMessage    = std::move(aMessage);
+    aSnapshot.mTimestamp  = GetNow();
+    aSnapshot.mGeneration = mPropertySnapshotGeneration;
+
+    return aSnapshot.mMessage.get();
+}
+
+/** Milliseconds left of @p aInterval started at @p aStart */
+static unsigned long GetRemaining(unsigned long aStart, unsigned long aInterval, unsigned long aNow)
+{
+    unsigned long elapsed = aNow - aStart;
+
+    return elapsed >= aInterval ? 0 : aInterval - elapsed;
+}
+
+bool DBusObject::IsPropertyChangeDue(const GetPropertyHandler &aHandler, unsigned long aNow)
+{
+    return aHandler.mChanged && GetRemaining(aHandler.mLastSent, aHandler.mMinInterval, aNow) == 0;
+}
+
+void DBusObject::MarkPropertyChanged(const std::string &aInterfaceName, const std::string &aPropertyName)
+{
+    GetPropertyHandler *handler = mGetPropertyHandlers.Find(aInterfaceName.c_str(), aPropertyName.c_str());
+
+    assert(handler != nullptr);
+    if (!handler->mChanged)
+    {
+        handler->mChanged = true;
+        mChangedProperties++;
+    }
+}
+
+void DBusObject::SetPropertiesChangedInterval(unsigned long aInterval)
+{
+    mPropertiesChangedInterval = aInterval;
+}
+
+void DBusObject::SetPropertyMinInterval(const std::string &aInterfaceName,
+                                        const std::string &aPropertyName,
+                                        unsigned long      aInterval)
+{
+    GetPropertyHandler *handler = mGetPropertyHandlers.Find(aInterfaceName.c_str(), aPropertyName.c_str());
+
+    assert(handler != nullptr);
+    handler->mMinInterval = aInterval;
+}
+
+bool DBusObject::GetPropertiesChangedDelay(unsigned long &aDelay)
+{
+    unsigned long now = GetNow();
+
+    VerifyOrExit(mChangedProperties > 0);
+
+    aDelay = ULONG_MAX;
+    for (auto &interface : mGetPropertyHandlers)
+    {
+        for (auto &entry : interface.mMembers)
+        {
+            if (entry.mHandler.mChanged)
+            {
+                aDelay = std::min(aDelay, GetRemaining(entry.mHandler.mLastSent, entry.mHandler.mMinInterval, now));
+            }
+        }
+    }
+    aDelay = std::max(aDelay, GetRemaining(mLastPropertiesChanged, mPropertiesChangedInterval, now));
+
+exit:
+    return mChangedProperties > 0;
+}
+
+void DBusObject::FlushPropertiesChanged(void)
+{
+    unsigned long now = GetNow();
+
+    VerifyOrExit(mChangedProperties > 0);
+    VerifyOrExit(GetRemaining(mLastPropertiesChanged, mPropertiesChangedInterval, now) == 0);
+
+    for (auto &interface : mGetPropertyHandlers)
+    {
+        otbrError error = SignalChangedProperties(interface, now);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to signal changed properties of %s: %s", interface.mName.c_str(),
+                    otbrErrorString(error));
+        }
+    }
+    mLastPropertiesChanged = now;
+
+exit:
+    return;
+}
+
+bool DBusObject::GetRequestsTimeoutDelay(unsigned long &aDelay)
+{
+    unsigned long now   = GetNow();
+    bool          found = false;
+
+    aDelay = ULONG_MAX;
+    for (const auto &pending : mPendingRequests)
+    {
+        if (pending.mMethod->mTimeout != 0 && !pending.mExpired)
+        {
+            aDelay = std::min(aDelay, GetRemaining(pending.mStart, pending.mMethod->mTimeout, now));
+            found  = true;
+        }
+    }
+
+    return found;
+}
+
+void DBusObject::ExpireRequests(void)
+{
+    unsigned long now = GetNow();
+    size_t        i   = 0;
+
+    while (i < mPendingRequests.size())
+    {
+        PendingRequest &pending = mPendingRequests[i];
+
+        if (pending.mRequest.IsOrphaned())
+        {
+            // Replying completes the request, which removes it from the list.
+            DBusRequest request = pending.mRequest;
+
+            otbrLog(OTBR_LOG_WARNING, "Call of %s dropped", dbus_message_get_member(request.GetMessage()));
+            request.ReplyOtResult(OT_ERROR_ABORT);
+            continue;
+        }
+
+        if (pending.mMethod->mTimeout != 0 && !pending.mExpired &&
+            GetRemaining(pending.mStart, pending.mMethod->mTimeout, now) == 0)
+        {
+            // The call stays in flight until its handler replies, as the operation it started is still running.
+            otbrLog(OTBR_LOG_WARNING, "Call of %s timed out", dbus_message_get_member(pending.mRequest.GetMessage()));
+            pending.mExpired = true;
+            pending.mRequest.PreemptReply(OT_ERROR_RESPONSE_TIMEOUT);
+        }
+
+        ++i;
+    }
+}
+
+otbrError DBusObject::SignalChangedProperties(DBusHandlerTable<GetPropertyHandler>::Interface &aInterface,
+                                              unsigned long                                    aNow)
+{
+    otbrError           error;
+    GetPropertyHandler *failed;
+
+    // A property whose value cannot be read is dropped, and the signal is encoded again without it.
+    do
+    {
+        failed = nullptr;
+        error  = SendChangedProperties(aInterface, aNow, failed);
+
+        if (failed != nullptr)
+        {
+            failed->mChanged = false;
+            mChangedProperties--;
+        }
+    } while (failed != nullptr);
+
+    return error;
+}
+
+otbrError DBusObject::SendChangedProperties(DBusHandlerTable<GetPropertyHandler>::Interface &aInterface,
+                                            unsigned long                                    aNow,
+                                            GetPropertyHandler *&                            aFailed)
+{
+    UniqueDBusMessage signalMsg{
+        dbus_message_new_signal(mObjectPath.c_str(), DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL)};
+    DBusMessageIter iter, subIter, dictEntryIter;
+    bool            changed = false;
+    otbrError       error   = OTBR_ERROR_NONE;
+
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+    // interface_name
+    SuccessOrExit(error = DBusMessageEncode(&iter, aInterface.mName));
+
+    // changed_properties
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    for (auto &entry : aInterface.mMembers)
+    {
+        GetPropertyHandler &handler = entry.mHandler;
+
+        if (!IsPropertyChangeDue(handler, aNow))
+        {
+            continue;
+        }
 
-    assert(mSetPropertyHandlers.find(fullPath) == mSetPropertyHandlers.end());
-    mSetPropertyHandlers.emplace(fullPath, aHandler);
+        changed = true;
+
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, entry.mMember));
+        VerifyOrExit(handler.mHandler(dictEntryIter) == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD,
+                     aFailed = &handler,
+                     otbrLog(OTBR_LOG_WARNING, "Failed to get property %s.%s", aInterface.mName.c_str(),
+                             entry.mMember.c_str()));
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+
+    // invalidated_properties
+    SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+    VerifyOrExit(changed);
+    VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+    // The changes are only cleared once the signal is queued, they are retried otherwise.
+    for (auto &entry : aInterface.mMembers)
+    {
+        GetPropertyHandler &handler = entry.mHandler;
+
+        if (IsPropertyChangeDue(handler, aNow))
+        {
+            handler.mChanged  = false;
+            handler.mLastSent = aNow;
+            mChangedProperties--;
+        }
+    }
+
+exit:
+    return error;
 }
 
 DBusHandlerResult DBusObject::sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData)
@@ -102,56 +435,64 @@ DBusHandlerResult DBusObject::sMessageHandler(DBusConnection *aConnection, DBusM
 
 DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage)
 {
-    DBusHandlerResult handled = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
-    DBusRequest       request(aConnection, aMessage);
-    std::string       interface  = dbus_message_get_interface(aMessage);
-    std::string       memberName = interface + "." + dbus_message_get_member(aMessage);
-    auto              iter       = mMethodHandlers.find(memberName);
-
-    if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL && iter != mMethodHandlers.end())
+    DBusHandlerResult  handled   = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    const char *       interface = dbus_message_get_interface(aMessage);
+    const char *       member    = dbus_message_get_member(aMessage);
+    MethodHandlerType *handler;
+
+    VerifyOrExit(dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL);
+    VerifyOrExit(interface != nullptr && member != nullptr);
+    VerifyOrExit((handler = mMethodHandlers.Find(interface, member)) != nullptr);
     {
-        otbrLog(OTBR_LOG_INFO, "Handling method %s", memberName.c_str());
-        (iter->second)(request);
+        DBusRequest request(aConnection, aMessage);
+
+        otbrLog(OTBR_LOG_INFO, "Handling method %s.%s", interface, member);
+        (*handler)(request);
         handled = DBUS_HANDLER_RESULT_HANDLED;
     }
 
+    // Methods may change properties before the change is notified.
+    if (strcmp(interface, DBUS_INTERFACE_PROPERTIES) != 0)
+    {
+        InvalidatePropertySnapshots();
+    }
+
+exit:
     return handled;
 }
 
 void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
 {
-    UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
-
-    DBusMessageIter iter;
-    std::string     interfaceName;
-    std::string     propertyName;
-    otError         error = OT_ERROR_NONE;
+    DBusMessageIter     iter;
+    const char *        interfaceName;
+    const char *        propertyName;
+    GetPropertyHandler *handler;
+    DBusMessage *       snapshot;
+    otError             error = OT_ERROR_NONE;
 
-    VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
-    {
-        auto propertyIter = mGetPropertyHandlers.find(interfaceName);
 
-        otbrLog(OTBR_LOG_INFO, "GetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
-        VerifyOrExit(propertyIter != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        {
-            DBusMessageIter replyIter;
-            auto &          interfaceHandlers = propertyIter->second;
-            auto            interfaceIter     = interfaceHandlers.find(propertyName);
+    otbrLog(OTBR_LOG_INFO, "GetProperty %s.%s", interfaceName, propertyName);
+    handler = mGetPropertyHandlers.Find(interfaceName, propertyName);
+    VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
 
-            VerifyOrExit(interfaceIter != interfaceHandlers.end(), error = OT_ERROR_NOT_FOUND);
-            dbus_message_iter_init_append(reply.get(), &replyIter);
-            SuccessOrExit(error = interfaceIter->second(replyIter));
-        }
-    }
-exit:
-    if (error == OT_ERROR_NONE)
+    snapshot = FindPropertySnapshot(handler->mSnapshot);
+    if (snapshot == nullptr)
     {
-        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+        UniqueDBusMessage value{dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN)};
+        DBusMessageIter   valueIter;
+
+        VerifyOrExit(value != nullptr, error = OT_ERROR_NO_BUFS);
+        dbus_message_iter_init_append(value.get(), &valueIter);
+        SuccessOrExit(error = handler->mHandler(valueIter));
+        snapshot = SavePropertySnapshot(handler->mSnapshot, std::move(value));
     }
-    else
+    aRequest.ReplyCopy(*snapshot);
+
+exit:
+    if (error != OT_ERROR_NONE)
     {
         aRequest.ReplyOtResult(error);
     }
@@ -159,39 +500,48 @@ exit:
 
 void DBusObject::GetAllPropertiesMethodHandler(DBusRequest &aRequest)
 {
-    UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
-    DBusMessageIter   iter, subIter, dictEntryIter;
-    std::string       interfaceName;
-    auto              args  = std::tie(interfaceName);
+    const char *      interfaceName;
+    auto              args = std::tie(interfaceName);
+    PropertySnapshot *allProperties;
+    DBusMessage *     snapshot;
     otError           error = OT_ERROR_NONE;
 
-    VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
-    VerifyOrExit(mGetPropertyHandlers.find(interfaceName) != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-    dbus_message_iter_init_append(reply.get(), &iter);
+    allProperties = mAllPropertiesSnapshots.Find(interfaceName, DBUS_PROPERTY_GET_ALL_METHOD);
+    VerifyOrExit(allProperties != nullptr, error = OT_ERROR_NOT_FOUND);
 
-    for (auto &p : mGetPropertyHandlers.at(interfaceName))
+    snapshot = FindPropertySnapshot(*allProperties);
+    if (snapshot == nullptr)
     {
+        UniqueDBusMessage values{dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN)};
+        auto              handlers = mGetPropertyHandlers.FindInterface(interfaceName);
+        DBusMessageIter   iter, subIter, dictEntryIter;
+
+        VerifyOrExit(values != nullptr, error = OT_ERROR_NO_BUFS);
+        dbus_message_iter_init_append(values.get(), &iter);
         VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
                                                       "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
                                                       &subIter),
                      error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OT_ERROR_FAILED);
-        VerifyOrExit(DBusMessageEncode(&dictEntryIter, p.first) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
 
-        SuccessOrExit(error = p.second(dictEntryIter));
+        for (auto p = handlers.first; p != handlers.second; ++p)
+        {
+            VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                         error = OT_ERROR_FAILED);
+            VerifyOrExit(DBusMessageEncode(&dictEntryIter, p->mMember) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
+
+            SuccessOrExit(error = p->mHandler.mHandler(dictEntryIter));
+
+            VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OT_ERROR_FAILED);
+        }
 
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter));
+        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OT_ERROR_FAILED);
+        snapshot = SavePropertySnapshot(*allProperties, std::move(values));
     }
+    aRequest.ReplyCopy(*snapshot);
 
 exit:
-    if (error == OT_ERROR_NONE)
-    {
-        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
-    }
-    else
+    if (error != OT_ERROR_NONE)
     {
         aRequest.ReplyOtResult(error);
     }
@@ -199,24 +549,21 @@ exit:
 
 void DBusObject::SetPropertyMethodHandler(DBusRequest &aRequest)
 {
-    DBusMessageIter iter;
-    std::string     interfaceName;
-    std::string     propertyName;
-    std::string     propertyFullPath;
-    otError         error = OT_ERROR_NONE;
+    DBusMessageIter      iter;
+    const char *         interfaceName;
+    const char *         propertyName;
+    PropertyHandlerType *handler;
+    otError              error = OT_ERROR_NONE;
 
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
 
-    propertyFullPath = interfaceName + "." + propertyName;
-    otbrLog(OTBR_LOG_INFO, "SetProperty %s", propertyFullPath.c_str());
-    {
-        auto handlerIter = mSetPropertyHandlers.find(propertyFullPath);
-
-        VerifyOrExit(handlerIter != mSetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        error = handlerIter->second(iter);
-    }
+    otbrLog(OTBR_LOG_INFO, "SetProperty %s.%s", interfaceName, propertyName);
+    handler = mSetPropertyHandlers.Find(interfaceName, propertyName);
+    VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
+    error = (*handler)(iter);
+    InvalidatePropertySnapshots();
 
 exit:
     aRequest.ReplyOtResult(error);
@@ -225,6 +572,11 @@ exit:
 
 DBusObject::~DBusObject(void)
 {
+    // Requests still held by the handlers must not complete into a destroyed object.
+    for (auto &pending : mPendingRequests)
+    {
+        pending.mRequest.SetReplyCallback(nullptr);
+    }
 }
 
 } // namespace DBus
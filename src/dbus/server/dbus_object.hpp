@@ -32,7 +32,6 @@
 #include <functional>
 #include <memory>
 #include <string>
-#include <unordered_map>
 
 #include <dbus/dbus.h>
 
@@ -41,8 +40,23 @@
 #include "dbus/common/constants.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
+#include "dbus/server/dbus_handler_table.hpp"
 #include "dbus/server/dbus_request.hpp"
 
+/**
+ * Milliseconds the values of properties are served from their snapshots by default
+ */
+#ifndef OTBR_DBUS_PROPERTY_SNAPSHOT_INTERVAL
+#define OTBR_DBUS_PROPERTY_SNAPSHOT_INTERVAL 1000
+#endif
+
+/**
+ * Max number of calls of asynchronous methods in flight on an object by default
+ */
+#ifndef OTBR_DBUS_MAX_REQUESTS_IN_FLIGHT
+#define OTBR_DBUS_MAX_REQUESTS_IN_FLIGHT 16
+#endif
+
 namespace otbr {
 namespace DBus {
 
@@ -89,6 +103,51 @@ public:
                         const std::string &      aMethodName,
                         const MethodHandlerType &aHandler);
 
+    /**
+     * This method registers the handler of a method replying asynchronously.
+     *
+     * The handler keeps a copy of the request and replies to it from any later callback. Calls beyond
+     * @p aMaxInFlight for the method, or beyond the limit of the object, are replied with OT_ERROR_BUSY at once.
+     * Calls not replied within @p aTimeout are replied with OT_ERROR_RESPONSE_TIMEOUT. The late reply of the handler
+     * is dropped, and the call counts as in flight until then, or until the handler drops all its copies of the call.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aMethodName       The method name.
+     * @param[in]   aHandler          The method handler.
+     * @param[in]   aTimeout          Milliseconds before a call times out, 0 for no timeout.
+     * @param[in]   aMaxInFlight      The max number of calls of the method in flight.
+     *
+     */
+    void RegisterAsyncMethod(const std::string &      aInterfaceName,
+                             const std::string &      aMethodName,
+                             const MethodHandlerType &aHandler,
+                             unsigned long            aTimeout,
+                             unsigned int             aMaxInFlight);
+
+    /**
+     * This method sets the max number of calls of asynchronous methods in flight on the object.
+     *
+     * @param[in]   aMaxInFlight    The max number of calls in flight.
+     *
+     */
+    void SetMaxRequestsInFlight(unsigned int aMaxInFlight);
+
+    /**
+     * This method returns when the first call in flight times out.
+     *
+     * @param[out]  aDelay  Milliseconds before the first call in flight times out.
+     *
+     * @returns Whether any call in flight can time out.
+     *
+     */
+    bool GetRequestsTimeoutDelay(unsigned long &aDelay);
+
+    /**
+     * This method replies to the calls in flight which timed out, and completes those dropped by their handlers.
+     *
+     */
+    void ExpireRequests(void);
+
     /**
      * This method registers the get handler for a property.
      *
@@ -113,12 +172,80 @@ public:
                                     const std::string &        aPropertyName,
                                     const PropertyHandlerType &aHandler);
 
+    /**
+     * This method sets how long the values of properties are served from their snapshots.
+     *
+     * The values returned by the get handlers are encoded once into snapshots, which serve all the readers until they
+     * are invalidated or older than @p aInterval.
+     *
+     * @param[in]   aInterval   The max age of snapshots in milliseconds, 0 to disable snapshots.
+     *
+     */
+    void SetPropertySnapshotInterval(unsigned long aInterval);
+
+    /**
+     * This method invalidates the snapshots of all the properties.
+     *
+     */
+    void InvalidatePropertySnapshots(void);
+
+    /**
+     * This method marks a property as changed.
+     *
+     * The changed properties of an interface are sent together in one PropertiesChanged signal by
+     * FlushPropertiesChanged(), with their values read by their get handlers.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aPropertyName     The property name.
+     *
+     */
+    void MarkPropertyChanged(const std::string &aInterfaceName, const std::string &aPropertyName);
+
+    /**
+     * This method sets the min interval between two PropertiesChanged signals of the object.
+     *
+     * @param[in]   aInterval   The interval in milliseconds, 0 to send the changes at each mainloop iteration.
+     *
+     */
+    void SetPropertiesChangedInterval(unsigned long aInterval);
+
+    /**
+     * This method sets the min interval between two changes sent for a property.
+     *
+     * A property changed within the interval is sent once the interval has passed, with its latest value.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aPropertyName     The property name.
+     * @param[in]   aInterval         The interval in milliseconds.
+     *
+     */
+    void SetPropertyMinInterval(const std::string &aInterfaceName,
+                                const std::string &aPropertyName,
+                                unsigned long      aInterval);
+
+    /**
+     * This method returns when the changed properties are due to be sent.
+     *
+     * @param[out]  aDelay  Milliseconds before the changed properties are due.
+     *
+     * @returns Whether any property is changed.
+     *
+     */
+    bool GetPropertiesChangedDelay(unsigned long &aDelay);
+
+    /**
+     * This method sends the changed properties which are due, in one PropertiesChanged signal per interface.
+     *
+     */
+    void FlushPropertiesChanged(void);
+
     /**
      * This method sends a signal.
      *
      * @param[in]   aInterfaceName    The interface name.
      * @param[in]   aSignalName       The signal name.
      * @param[in]   aArgs             The tuple to be encoded into the signal.
+     * @param[in]   aDestination      The bus name the signal is sent to, nullptr to broadcast the signal.
      *
      * @retval OTBR_ERROR_NONE  Signal successfully sent.
      * @retval OTBR_ERROR_DBUS  Failed to send the signal.
@@ -127,14 +254,17 @@ public:
     template <typename... FieldTypes>
     otbrError Signal(const std::string &              aInterfaceName,
                      const std::string &              aSignalName,
-                     const std::tuple<FieldTypes...> &aArgs)
+                     const std::tuple<FieldTypes...> &aArgs,
+                     const char *                     aDestination = nullptr)
     {
         UniqueDBusMessage signalMsg{
             dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str())};
         otbrError error = OTBR_ERROR_NONE;
 
         VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        VerifyOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
+        VerifyOrExit(aDestination == nullptr || dbus_message_set_destination(signalMsg.get(), aDestination),
+                     error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
 
         VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
 
@@ -198,7 +328,60 @@ public:
      */
     virtual ~DBusObject(void);
 
+protected:
+    /**
+     * This method returns the d-bus connection of the object.
+     *
+     */
+    DBusConnection *GetConnection(void) { return mConnection; }
+
 private:
+    struct PropertySnapshot
+    {
+        UniqueDBusMessage mMessage;    ///< The method return holding the encoded values.
+        unsigned long     mTimestamp;  ///< When the values were encoded, in milliseconds.
+        unsigned int      mGeneration; ///< The generation of snapshots the values belong to.
+    };
+
+    struct GetPropertyHandler
+    {
+        PropertyHandlerType mHandler;
+        PropertySnapshot    mSnapshot;
+        bool                mChanged;     ///< Whether the property is to be sent in a PropertiesChanged signal.
+        unsigned long       mMinInterval; ///< Min milliseconds between two changes sent.
+        unsigned long       mLastSent;    ///< When the last change was sent, in milliseconds.
+    };
+
+    struct AsyncMethod
+    {
+        MethodHandlerType mHandler;
+        unsigned long     mTimeout;     ///< Milliseconds before a call times out, 0 for no timeout.
+        unsigned int      mMaxInFlight; ///< Max number of calls in flight.
+        unsigned int      mInFlight;    ///< Number of calls in flight.
+    };
+
+    struct PendingRequest
+    {
+        DBusRequest   mRequest;
+        AsyncMethod * mMethod;
+        unsigned long mStart;   ///< When the call was received, in milliseconds.
+        unsigned long mId;
+        bool          mExpired; ///< Whether the call was replied with a timeout.
+    };
+
+    void AsyncMethodHandler(AsyncMethod &aMethod, DBusRequest &aRequest);
+    void CompleteRequest(unsigned long aId);
+
+    static bool IsPropertyChangeDue(const GetPropertyHandler &aHandler, unsigned long aNow);
+
+    otbrError SignalChangedProperties(DBusHandlerTable<GetPropertyHandler>::Interface &aInterface, unsigned long aNow);
+    otbrError SendChangedProperties(DBusHandlerTable<GetPropertyHandler>::Interface &aInterface,
+                                    unsigned long                                    aNow,
+                                    GetPropertyHandler *&                            aFailed);
+
+    DBusMessage *FindPropertySnapshot(const PropertySnapshot &aSnapshot) const;
+    DBusMessage *SavePropertySnapshot(PropertySnapshot &aSnapshot, UniqueDBusMessage aMessage);
+
     void GetAllPropertiesMethodHandler(DBusRequest &aRequest);
 
     void GetPropertyMethodHandler(DBusRequest &aRequest);
@@ -208,11 +391,21 @@ private:
     static DBusHandlerResult sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage);
 
-    std::unordered_map<std::string, MethodHandlerType>                                    mMethodHandlers;
-    std::unordered_map<std::string, std::unordered_map<std::string, PropertyHandlerType>> mGetPropertyHandlers;
-    std::unordered_map<std::string, PropertyHandlerType>                                  mSetPropertyHandlers;
-    DBusConnection *                                                                      mConnection;
-    std::string                                                                           mObjectPath;
+    DBusHandlerTable<MethodHandlerType>       mMethodHandlers;
+    DBusHandlerTable<GetPropertyHandler>      mGetPropertyHandlers;
+    DBusHandlerTable<PropertyHandlerType>     mSetPropertyHandlers;
+    DBusHandlerTable<PropertySnapshot>        mAllPropertiesSnapshots;
+    unsigned long                             mPropertySnapshotInterval;
+    unsigned int                              mPropertySnapshotGeneration;
+    unsigned int                              mChangedProperties;
+    unsigned long                             mPropertiesChangedInterval;
+    unsigned long                             mLastPropertiesChanged;
+    std::vector<std::unique_ptr<AsyncMethod>> mAsyncMethods;
+    std::vector<PendingRequest>               mPendingRequests;
+    unsigned int                              mMaxRequestsInFlight;
+    unsigned long                             mNextRequestId;
+    DBusConnection *                          mConnection;
+    std::string                               mObjectPath;
 };
 
 } // namespace DBus
@@ -26,6 +26,9 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <functional>
+#include <memory>
+
 #include "common/logging.hpp"
 
 #include "dbus/common/dbus_message_helper.hpp"
@@ -98,6 +101,35 @@ public:
      */
     DBusConnection *GetConnection(void) { return mConnection; }
 
+    /**
+     * This method sets the function called by the first reply of the handler to the request.
+     *
+     * The copies of the request made afterwards share the callback, and once any of them replied, the replies of the
+     * others are dropped.
+     *
+     * @param[in] aCallback   The function to be called, nullptr to remove the function.
+     *
+     */
+    void SetReplyCallback(const std::function<void(void)> &aCallback)
+    {
+        if (mReplyState == nullptr)
+        {
+            mReplyState = std::make_shared<ReplyState>();
+        }
+        mReplyState->mCallback = aCallback;
+    }
+
+    /**
+     * This method returns whether the request is the last copy of a call its handler did not reply.
+     *
+     * @returns Whether the handler dropped the call without replying.
+     *
+     */
+    bool IsOrphaned(void) const
+    {
+        return mReplyState != nullptr && mReplyState.use_count() == 1 && !mReplyState->mReplied;
+    }
+
     /**
      * This method replies to the d-bus method call.
      *
@@ -108,6 +140,7 @@ public:
     {
         UniqueDBusMessage reply{dbus_message_new_method_return(mMessage)};
 
+        VerifyOrExit(BeginReply());
         VerifyOrExit(reply != nullptr);
         VerifyOrExit(otbr::DBus::TupleToDBusMessage(*reply, aReply) == OTBR_ERROR_NONE);
 
@@ -117,6 +150,29 @@ public:
         return;
     }
 
+    /**
+     * This method replies to the d-bus method call with a copy of a method return encoded beforehand.
+     *
+     * @param[in] aReply  The method return, which is not bound to any call.
+     *
+     */
+    void ReplyCopy(const DBusMessage &aReply)
+    {
+        UniqueDBusMessage reply{dbus_message_copy(&aReply)};
+        const char *      sender = dbus_message_get_sender(mMessage);
+
+        VerifyOrExit(BeginReply());
+        VerifyOrExit(reply != nullptr);
+        VerifyOrExit(dbus_message_set_reply_serial(reply.get(), dbus_message_get_serial(mMessage)));
+        VerifyOrExit(sender == nullptr || dbus_message_set_destination(reply.get(), sender));
+        dbus_message_set_no_reply(reply.get(), TRUE);
+
+        dbus_connection_send(mConnection, reply.get(), nullptr);
+
+    exit:
+        return;
+    }
+
     /**
      * This method replies an otError to the d-bus method call.
      *
@@ -125,21 +181,32 @@ public:
      */
     void ReplyOtResult(otError aError)
     {
-        UniqueDBusMessage reply{nullptr};
-        auto              logLevel = (aError == OT_ERROR_NONE) ? OTBR_LOG_INFO : OTBR_LOG_ERR;
+        VerifyOrExit(BeginReply());
+        SendOtResult(aError);
 
-        otbrLog(logLevel, "Replied with result %s", ConvertToDBusErrorName(aError));
-        if (aError == OT_ERROR_NONE)
-        {
-            reply = UniqueDBusMessage(dbus_message_new_method_return(mMessage));
-        }
-        else
+    exit:
+        return;
+    }
+
+    /**
+     * This method replies an otError to the d-bus method call on behalf of its handler.
+     *
+     * The replies of the handler made afterwards are dropped, but the first of them still calls the reply callback.
+     *
+     * @param[in] aError  The error to be sent.
+     *
+     */
+    void PreemptReply(otError aError)
+    {
+        VerifyOrExit(mReplyState == nullptr || !mReplyState->mReplied);
+
+        if (mReplyState == nullptr)
         {
-            reply = UniqueDBusMessage(dbus_message_new_error(mMessage, ConvertToDBusErrorName(aError), nullptr));
+            mReplyState = std::make_shared<ReplyState>();
         }
-
-        VerifyOrExit(reply != nullptr);
-        dbus_connection_send(mConnection, reply.get(), nullptr);
+        VerifyOrExit(!mReplyState->mPreempted);
+        mReplyState->mPreempted = true;
+        SendOtResult(aError);
 
     exit:
         return;
@@ -162,6 +229,62 @@ public:
     }
 
 private:
+    struct ReplyState
+    {
+        ReplyState(void)
+            : mReplied(false)
+            , mPreempted(false)
+        {
+        }
+
+        bool                      mReplied;   ///< Whether the handler replied.
+        bool                      mPreempted; ///< Whether the call was replied on behalf of the handler.
+        std::function<void(void)> mCallback;
+    };
+
+    bool BeginReply(void)
+    {
+        bool first = true;
+
+        if (mReplyState != nullptr)
+        {
+            first                 = !mReplyState->mReplied;
+            mReplyState->mReplied = true;
+
+            if (first && mReplyState->mCallback != nullptr)
+            {
+                // The callback may drop the copy owning it.
+                std::function<void(void)> callback = std::move(mReplyState->mCallback);
+
+                callback();
+            }
+        }
+
+        return first && (mReplyState == nullptr || !mReplyState->mPreempted);
+    }
+
+    void SendOtResult(otError aError)
+    {
+        UniqueDBusMessage reply{nullptr};
+        auto              logLevel = (aError == OT_ERROR_NONE) ? OTBR_LOG_INFO : OTBR_LOG_ERR;
+
+        otbrLog(logLevel, "Replied with result %s", ConvertToDBusErrorName(aError));
+        if (aError == OT_ERROR_NONE)
+        {
+            reply = UniqueDBusMessage(dbus_message_new_method_return(mMessage));
+        }
+        else
+        {
+            reply = UniqueDBusMessage(dbus_message_new_error(mMessage, ConvertToDBusErrorName(aError), nullptr));
+        }
+
+        VerifyOrExit(reply != nullptr);
+        dbus_connection_send(mConnection, reply.get(), nullptr);
+
+    exit:
+        return;
+    }
+
     void CopyFrom(const DBusRequest &aOther)
     {
         if (mMessage)
@@ -174,12 +297,14 @@ private:
         }
         mConnection = aOther.mConnection;
         mMessage    = aOther.mMessage;
+        mReplyState = aOther.mReplyState;
         dbus_message_ref(mMessage);
         dbus_connection_ref(mConnection);
     }
 
-    DBusConnection *mConnection;
-    DBusMessage *   mMessage;
+    DBusConnection *            mConnection;
+    DBusMessage *               mMessage;
+    std::shared_ptr<ReplyState> mReplyState;
 };
 
 } // namespace DBus
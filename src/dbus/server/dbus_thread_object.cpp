@@ -26,6 +26,8 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_DBUS
+
 #include <assert.h>
 #include <byteswap.h>
 #include <string.h>
@@ -40,6 +42,7 @@
 #include <openthread/thread_ftd.h>
 #include <openthread/platform/radio.h>
 
+#include "common/logging.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object.hpp"
@@ -85,6 +88,74 @@ static uint64_t ConvertOpenThreadUint64(const uint8_t *aValue, size_t aSize)
     return val;
 }
 
+#define OTBR_LINK_COUNTER(aName) {OTBR_DBUS_PROPERTY_LINK_COUNTERS "." #aName, &otMacCounters::m##aName, nullptr}
+#define OTBR_IP6_COUNTER(aName) {OTBR_DBUS_PROPERTY_IP6_COUNTERS "." #aName, nullptr, &otIpCounters::m##aName}
+
+/**
+ * The counters which can be subscribed, named after their property and field.
+ *
+ */
+static const struct
+{
+    const char *mName;
+    uint32_t otMacCounters::*mLinkCounter;
+    uint32_t otIpCounters::*mIp6Counter;
+} kCounters[] = {
+    OTBR_LINK_COUNTER(TxTotal),
+    OTBR_LINK_COUNTER(TxUnicast),
+    OTBR_LINK_COUNTER(TxBroadcast),
+    OTBR_LINK_COUNTER(TxAckRequested),
+    OTBR_LINK_COUNTER(TxAcked),
+    OTBR_LINK_COUNTER(TxNoAckRequested),
+    OTBR_LINK_COUNTER(TxData),
+    OTBR_LINK_COUNTER(TxDataPoll),
+    OTBR_LINK_COUNTER(TxBeacon),
+    OTBR_LINK_COUNTER(TxBeaconRequest),
+    OTBR_LINK_COUNTER(TxOther),
+    OTBR_LINK_COUNTER(TxRetry),
+    OTBR_LINK_COUNTER(TxErrCca),
+    OTBR_LINK_COUNTER(TxErrAbort),
+    OTBR_LINK_COUNTER(TxErrBusyChannel),
+    OTBR_LINK_COUNTER(RxTotal),
+    OTBR_LINK_COUNTER(RxUnicast),
+    OTBR_LINK_COUNTER(RxBroadcast),
+    OTBR_LINK_COUNTER(RxData),
+    OTBR_LINK_COUNTER(RxDataPoll),
+    OTBR_LINK_COUNTER(RxBeacon),
+    OTBR_LINK_COUNTER(RxBeaconRequest),
+    OTBR_LINK_COUNTER(RxOther),
+    OTBR_LINK_COUNTER(RxAddressFiltered),
+    OTBR_LINK_COUNTER(RxDestAddrFiltered),
+    OTBR_LINK_COUNTER(RxDuplicated),
+    OTBR_LINK_COUNTER(RxErrNoFrame),
+    OTBR_LINK_COUNTER(RxErrUnknownNeighbor),
+    OTBR_LINK_COUNTER(RxErrInvalidSrcAddr),
+    OTBR_LINK_COUNTER(RxErrSec),
+    OTBR_LINK_COUNTER(RxErrFcs),
+    OTBR_LINK_COUNTER(RxErrOther),
+    OTBR_IP6_COUNTER(TxSuccess),
+    OTBR_IP6_COUNTER(TxFailure),
+    OTBR_IP6_COUNTER(RxSuccess),
+    OTBR_IP6_COUNTER(RxFailure),
+};
+
+static bool FindCounter(const std::string &aName, uint8_t &aIndex)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < sizeof(kCounters) / sizeof(kCounters[0]); i++)
+    {
+        if (aName == kCounters[i].mName)
+        {
+            aIndex = i;
+            found  = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
 namespace otbr {
 namespace DBus {
 
@@ -93,6 +164,11 @@ DBusThreadObject::DBusThreadObject(DBusConnection *                 aConnection,
                                    otbr::Ncp::ControllerOpenThread *aNcp)
     : DBusObject(aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mNcp(aNcp)
+    , mCountersPublisher(*this,
+                         aConnection,
+                         OTBR_DBUS_THREAD_INTERFACE,
+                         FindCounter,
+                         std::bind(&DBusThreadObject::ReadCounter, this, _1))
 {
 }
 
@@ -101,18 +177,18 @@ otbrError DBusThreadObject::Init(void)
     otbrError error        = DBusObject::Init();
     auto      threadHelper = mNcp->GetThreadHelper();
 
-    threadHelper->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
+    threadHelper->AddStateChangedHandler(std::bind(&DBusThreadObject::StateChangedHandler, this, _1));
 
-    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
-                   std::bind(&DBusThreadObject::ScanHandler, this, _1));
-    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_METHOD,
-                   std::bind(&DBusThreadObject::AttachHandler, this, _1));
+    RegisterAsyncMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
+                        std::bind(&DBusThreadObject::ScanHandler, this, _1), kScanTimeout, 1);
+    RegisterAsyncMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_METHOD,
+                        std::bind(&DBusThreadObject::AttachHandler, this, _1), kAttachTimeout, 1);
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_FACTORY_RESET_METHOD,
                    std::bind(&DBusThreadObject::FactoryResetHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_RESET_METHOD,
                    std::bind(&DBusThreadObject::ResetHandler, this, _1));
-    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_START_METHOD,
-                   std::bind(&DBusThreadObject::JoinerStartHandler, this, _1));
+    RegisterAsyncMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_START_METHOD,
+                        std::bind(&DBusThreadObject::JoinerStartHandler, this, _1), kJoinerStartTimeout, 1);
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_STOP_METHOD,
                    std::bind(&DBusThreadObject::JoinerStopHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD,
@@ -125,6 +201,14 @@ otbrError DBusThreadObject::Init(void)
                    std::bind(&DBusThreadObject::AddExternalRouteHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD,
                    std::bind(&DBusThreadObject::RemoveExternalRouteHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SET_LOG_LEVELS_METHOD,
+                   std::bind(&DBusThreadObject::SetLogLevelsHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SUBSCRIBE_COUNTERS_METHOD,
+                   std::bind(&DBusCountersPublisher::SubscribeHandler, &mCountersPublisher, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_UNSUBSCRIBE_COUNTERS_METHOD,
+                   std::bind(&DBusCountersPublisher::UnsubscribeHandler, &mCountersPublisher, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TELEMETRY_METHOD,
+                   std::bind(&DBusThreadObject::GetTelemetryHandler, this, _1));
 
     RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX,
                                std::bind(&DBusThreadObject::SetMeshLocalPrefixHandler, this, _1));
@@ -186,12 +270,51 @@ otbrError DBusThreadObject::Init(void)
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES,
                                std::bind(&DBusThreadObject::GetExternalRoutesHandler, this, _1));
 
+    // Children and network data change in bursts while the topology settles.
+    SetPropertyMinInterval(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE, kTableChangedMinInterval);
+    SetPropertyMinInterval(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY,
+                           kTableChangedMinInterval);
+    SetPropertyMinInterval(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY,
+                           kTableChangedMinInterval);
+
+    SuccessOrExit(error);
+    error = mCountersPublisher.Init();
+
+exit:
     return error;
 }
 
-void DBusThreadObject::DeviceRoleHandler(otDeviceRole aDeviceRole)
+void DBusThreadObject::StateChangedHandler(otChangedFlags aFlags)
 {
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE, GetDeviceRoleName(aDeviceRole));
+    static const struct
+    {
+        otChangedFlags mFlags;
+        const char *   mPropertyName;
+    } kChangedProperties[] = {
+        {OT_CHANGED_THREAD_ROLE, OTBR_DBUS_PROPERTY_DEVICE_ROLE},
+        {OT_CHANGED_THREAD_NETWORK_NAME, OTBR_DBUS_PROPERTY_NETWORK_NAME},
+        {OT_CHANGED_THREAD_PANID, OTBR_DBUS_PROPERTY_PANID},
+        {OT_CHANGED_THREAD_EXT_PANID, OTBR_DBUS_PROPERTY_EXTPANID},
+        {OT_CHANGED_THREAD_CHANNEL, OTBR_DBUS_PROPERTY_CHANNEL},
+        {OT_CHANGED_THREAD_PARTITION_ID, OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY},
+        {OT_CHANGED_THREAD_NETDATA, OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY},
+        {OT_CHANGED_THREAD_NETDATA, OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY},
+        {OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED, OTBR_DBUS_PROPERTY_CHILD_TABLE},
+    };
+
+    // Properties not covered by the flags, such as counters, are refreshed by the snapshot interval.
+    if (aFlags != 0)
+    {
+        InvalidatePropertySnapshots();
+    }
+
+    for (const auto &changed : kChangedProperties)
+    {
+        if (aFlags & changed.mFlags)
+        {
+            MarkPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, changed.mPropertyName);
+        }
+    }
 }
 
 void DBusThreadObject::ScanHandler(DBusRequest &aRequest)
@@ -265,17 +388,15 @@ void DBusThreadObject::FactoryResetHandler(DBusRequest &aRequest)
     aRequest.ReplyOtResult(OT_ERROR_NONE);
     otInstanceFactoryReset(mNcp->GetThreadHelper()->GetInstance());
     mNcp->Reset();
-    mNcp->GetThreadHelper()->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
-                          GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
+    mNcp->GetThreadHelper()->AddStateChangedHandler(std::bind(&DBusThreadObject::StateChangedHandler, this, _1));
+    MarkPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE);
 }
 
 void DBusThreadObject::ResetHandler(DBusRequest &aRequest)
 {
     mNcp->Reset();
-    mNcp->GetThreadHelper()->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
-                          GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
+    mNcp->GetThreadHelper()->AddStateChangedHandler(std::bind(&DBusThreadObject::StateChangedHandler, this, _1));
+    MarkPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE);
 
     aRequest.ReplyOtResult(OT_ERROR_NONE);
 }
@@ -419,6 +540,29 @@ exit:
     aRequest.ReplyOtResult(error);
 }
 
+void DBusThreadObject::SetLogLevelsHandler(DBusRequest &aRequest)
+{
+    std::string levels;
+    auto        args  = std::tie(levels);
+    otError     error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(otbrLogSetModuleLevels(levels.c_str()) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otbrLog(OTBR_LOG_INFO, "Log levels changed: %s", levels.c_str());
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+uint32_t DBusThreadObject::ReadCounter(uint8_t aIndex)
+{
+    auto threadHelper = mNcp->GetThreadHelper();
+
+    return kCounters[aIndex].mLinkCounter != nullptr
+               ? otLinkGetCounters(threadHelper->GetInstance())->*kCounters[aIndex].mLinkCounter
+               : otThreadGetIp6Counters(threadHelper->GetInstance())->*kCounters[aIndex].mIp6Counter;
+}
+
 otError DBusThreadObject::SetMeshLocalPrefixHandler(DBusMessageIter &aIter)
 {
     auto                                      threadHelper = mNcp->GetThreadHelper();
@@ -574,44 +718,10 @@ exit:
 
 otError DBusThreadObject::GetLinkCountersHandler(DBusMessageIter &aIter)
 {
-    auto                 threadHelper = mNcp->GetThreadHelper();
-    const otMacCounters *otCounters   = otLinkGetCounters(threadHelper->GetInstance());
-    MacCounters          counters;
-    otError              error = OT_ERROR_NONE;
-
-    counters.mTxTotal              = otCounters->mTxTotal;
-    counters.mTxUnicast            = otCounters->mTxUnicast;
-    counters.mTxBroadcast          = otCounters->mTxBroadcast;
-    counters.mTxAckRequested       = otCounters->mTxAckRequested;
-    counters.mTxAcked              = otCounters->mTxAcked;
-    counters.mTxNoAckRequested     = otCounters->mTxNoAckRequested;
-    counters.mTxData               = otCounters->mTxData;
-    counters.mTxDataPoll           = otCounters->mTxDataPoll;
-    counters.mTxBeacon             = otCounters->mTxBeacon;
-    counters.mTxBeaconRequest      = otCounters->mTxBeaconRequest;
-    counters.mTxOther              = otCounters->mTxOther;
-    counters.mTxRetry              = otCounters->mTxRetry;
-    counters.mTxErrCca             = otCounters->mTxErrCca;
-    counters.mTxErrAbort           = otCounters->mTxErrAbort;
-    counters.mTxErrBusyChannel     = otCounters->mTxErrBusyChannel;
-    counters.mRxTotal              = otCounters->mRxTotal;
-    counters.mRxUnicast            = otCounters->mTxUnicast;
-    counters.mRxBroadcast          = otCounters->mRxBroadcast;
-    counters.mRxData               = otCounters->mRxData;
-    counters.mRxDataPoll           = otCounters->mTxDataPoll;
-    counters.mRxBeacon             = otCounters->mRxBeacon;
-    counters.mRxBeaconRequest      = otCounters->mRxBeaconRequest;
-    counters.mRxOther              = otCounters->mRxOther;
-    counters.mRxAddressFiltered    = otCounters->mRxAddressFiltered;
-    counters.mRxDestAddrFiltered   = otCounters->mRxDestAddrFiltered;
-    counters.mRxDuplicated         = otCounters->mRxDuplicated;
-    counters.mRxErrNoFrame         = otCounters->mRxErrNoFrame;
-    counters.mRxErrUnknownNeighbor = otCounters->mRxErrUnknownNeighbor;
-    counters.mRxErrInvalidSrcAddr  = otCounters->mRxErrInvalidSrcAddr;
-    counters.mRxErrSec             = otCounters->mRxErrSec;
-    counters.mRxErrFcs             = otCounters->mRxErrFcs;
-    counters.mRxErrOther           = otCounters->mRxErrOther;
+    MacCounters counters;
+    otError     error = OT_ERROR_NONE;
 
+    ReadLinkCounters(counters);
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
 exit:
@@ -620,16 +730,10 @@ exit:
 
 otError DBusThreadObject::GetIp6CountersHandler(DBusMessageIter &aIter)
 {
-    auto                threadHelper = mNcp->GetThreadHelper();
-    const otIpCounters *otCounters   = otThreadGetIp6Counters(threadHelper->GetInstance());
-    IpCounters          counters;
-    otError             error = OT_ERROR_NONE;
-
-    counters.mTxSuccess = otCounters->mTxSuccess;
-    counters.mTxFailure = otCounters->mTxFailure;
-    counters.mRxSuccess = otCounters->mRxSuccess;
-    counters.mRxFailure = otCounters->mRxFailure;
+    IpCounters counters;
+    otError    error = OT_ERROR_NONE;
 
+    ReadIp6Counters(counters);
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
 exit:
@@ -690,17 +794,10 @@ exit:
 
 otError DBusThreadObject::GetLeaderDataHandler(DBusMessageIter &aIter)
 {
-    auto                threadHelper = mNcp->GetThreadHelper();
-    otError             error        = OT_ERROR_NONE;
-    struct otLeaderData data;
-    LeaderData          leaderData;
+    otError    error = OT_ERROR_NONE;
+    LeaderData leaderData;
 
-    SuccessOrExit(error = otThreadGetLeaderData(threadHelper->GetInstance(), &data));
-    leaderData.mPartitionId       = data.mPartitionId;
-    leaderData.mWeighting         = data.mWeighting;
-    leaderData.mDataVersion       = data.mDataVersion;
-    leaderData.mStableDataVersion = data.mStableDataVersion;
-    leaderData.mLeaderRouterId    = data.mLeaderRouterId;
+    SuccessOrExit(error = ReadLeaderData(leaderData));
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, leaderData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
 exit:
@@ -709,15 +806,10 @@ exit:
 
 otError DBusThreadObject::GetNetworkDataHandler(DBusMessageIter &aIter)
 {
-    static constexpr size_t kNetworkDataMaxSize = 255;
-    auto                    threadHelper        = mNcp->GetThreadHelper();
-    otError                 error               = OT_ERROR_NONE;
-    uint8_t                 data[kNetworkDataMaxSize];
-    uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
+    otError              error = OT_ERROR_NONE;
+    std::vector<uint8_t> networkData;
 
-    otNetDataGet(threadHelper->GetInstance(), /*stable=*/false, data, &len);
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
+    ReadNetworkData(/*stable=*/false, networkData);
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
 exit:
@@ -726,15 +818,10 @@ exit:
 
 otError DBusThreadObject::GetStableNetworkDataHandler(DBusMessageIter &aIter)
 {
-    static constexpr size_t kNetworkDataMaxSize = 255;
-    auto                    threadHelper        = mNcp->GetThreadHelper();
-    otError                 error               = OT_ERROR_NONE;
-    uint8_t                 data[kNetworkDataMaxSize];
-    uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
+    otError              error = OT_ERROR_NONE;
+    std::vector<uint8_t> networkData;
 
-    otNetDataGet(threadHelper->GetInstance(), /*stable=*/true, data, &len);
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
+    ReadNetworkData(/*stable=*/true, networkData);
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
 exit:
@@ -771,63 +858,22 @@ exit:
 
 otError DBusThreadObject::GetChannelMonitorAllChannelQualities(DBusMessageIter &aIter)
 {
-#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
-    auto                        threadHelper = mNcp->GetThreadHelper();
-    otError                     error        = OT_ERROR_NONE;
-    uint32_t                    channelMask  = otLinkGetSupportedChannelMask(threadHelper->GetInstance());
-    constexpr uint8_t           kNumChannels = sizeof(channelMask) * 8; // 8 bit per byte
+    otError                     error = OT_ERROR_NONE;
     std::vector<ChannelQuality> quality;
 
-    for (uint8_t i = 0; i < kNumChannels; i++)
-    {
-        if (channelMask & (1U << i))
-        {
-            uint16_t occupancy = otChannelMonitorGetChannelOccupancy(threadHelper->GetInstance(), i);
-
-            quality.emplace_back(ChannelQuality{i, occupancy});
-        }
-    }
-
+    SuccessOrExit(error = ReadChannelQualities(quality));
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, quality) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
-#else  // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
-    return OT_ERROR_NOT_IMPLEMENTED;
-#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
 }
 
 otError DBusThreadObject::GetChildTableHandler(DBusMessageIter &aIter)
 {
-    auto                   threadHelper = mNcp->GetThreadHelper();
-    otError                error        = OT_ERROR_NONE;
-    uint16_t               childIndex   = 0;
-    otChildInfo            childInfo;
+    otError                error = OT_ERROR_NONE;
     std::vector<ChildInfo> childTable;
 
-    while (otThreadGetChildInfoByIndex(threadHelper->GetInstance(), childIndex, &childInfo) == OT_ERROR_NONE)
-    {
-        ChildInfo info;
-
-        info.mExtAddress         = ConvertOpenThreadUint64(childInfo.mExtAddress.m8, sizeof(childInfo.mExtAddress.m8));
-        info.mTimeout            = childInfo.mTimeout;
-        info.mAge                = childInfo.mAge;
-        info.mChildId            = childInfo.mChildId;
-        info.mNetworkDataVersion = childInfo.mNetworkDataVersion;
-        info.mLinkQualityIn      = childInfo.mLinkQualityIn;
-        info.mAverageRssi        = childInfo.mAverageRssi;
-        info.mLastRssi           = childInfo.mLastRssi;
-        info.mFrameErrorRate     = childInfo.mFrameErrorRate;
-        info.mMessageErrorRate   = childInfo.mMessageErrorRate;
-        info.mRxOnWhenIdle       = childInfo.mRxOnWhenIdle;
-        info.mSecureDataRequest  = childInfo.mSecureDataRequest;
-        info.mFullThreadDevice   = childInfo.mFullThreadDevice;
-        info.mFullNetworkData    = childInfo.mFullNetworkData;
-        info.mIsStateRestoring   = childInfo.mIsStateRestoring;
-        childTable.push_back(info);
-        childIndex++;
-    }
-
+    ReadChildTable(childTable);
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, childTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
 exit:
@@ -836,34 +882,10 @@ exit:
 
 otError DBusThreadObject::GetNeighborTableHandler(DBusMessageIter &aIter)
 {
-    auto                      threadHelper = mNcp->GetThreadHelper();
-    otError                   error        = OT_ERROR_NONE;
-    otNeighborInfoIterator    iter         = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-    otNeighborInfo            neighborInfo;
+    otError                   error = OT_ERROR_NONE;
     std::vector<NeighborInfo> neighborTable;
 
-    while (otThreadGetNextNeighborInfo(threadHelper->GetInstance(), &iter, &neighborInfo) == OT_ERROR_NONE)
-    {
-        NeighborInfo info;
-
-        info.mExtAddress = ConvertOpenThreadUint64(neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8));
-        info.mAge        = neighborInfo.mAge;
-        info.mRloc16     = neighborInfo.mRloc16;
-        info.mLinkFrameCounter  = neighborInfo.mLinkFrameCounter;
-        info.mMleFrameCounter   = neighborInfo.mMleFrameCounter;
-        info.mLinkQualityIn     = neighborInfo.mLinkQualityIn;
-        info.mAverageRssi       = neighborInfo.mAverageRssi;
-        info.mLastRssi          = neighborInfo.mLastRssi;
-        info.mFrameErrorRate    = neighborInfo.mFrameErrorRate;
-        info.mMessageErrorRate  = neighborInfo.mMessageErrorRate;
-        info.mRxOnWhenIdle      = neighborInfo.mRxOnWhenIdle;
-        info.mSecureDataRequest = neighborInfo.mSecureDataRequest;
-        info.mFullThreadDevice  = neighborInfo.mFullThreadDevice;
-        info.mFullNetworkData   = neighborInfo.mFullNetworkData;
-        info.mIsChild           = neighborInfo.mIsChild;
-        neighborTable.push_back(info);
-    }
-
+    ReadNeighborTable(neighborTable);
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, neighborTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
 exit:
@@ -937,5 +959,252 @@ exit:
     return error;
 }
 
+void DBusThreadObject::GetTelemetryHandler(DBusRequest &aRequest)
+{
+    uint32_t fields;
+    auto     args  = std::tie(fields);
+    otError  error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    // Everything is read within this handler, so no state change of OpenThread can come in between.
+    ReadTelemetry(fields, mTelemetry);
+    aRequest.Reply(std::tie(mTelemetry));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
+void DBusThreadObject::ReadTelemetry(uint32_t aFields, Telemetry &aTelemetry)
+{
+    auto threadHelper = mNcp->GetThreadHelper();
+    auto instance     = threadHelper->GetInstance();
+
+    // The tables are cleared rather than reallocated, so their capacity is reused by the next telemetry.
+    aTelemetry.mVersion     = OTBR_DBUS_TELEMETRY_VERSION;
+    aTelemetry.mFields      = aFields & OTBR_TELEMETRY_ALL;
+    aTelemetry.mPartitionId = 0;
+    aTelemetry.mRloc16      = 0;
+    aTelemetry.mDeviceRole.clear();
+    aTelemetry.mLeaderData = LeaderData();
+    aTelemetry.mChildTable.clear();
+    aTelemetry.mNeighborTable.clear();
+    aTelemetry.mNetworkData.clear();
+    aTelemetry.mStableNetworkData.clear();
+    aTelemetry.mLinkCounters              = MacCounters();
+    aTelemetry.mIp6Counters               = IpCounters();
+    aTelemetry.mChannelMonitorSampleCount = 0;
+    aTelemetry.mChannelQualities.clear();
+
+    if (aTelemetry.mFields & OTBR_TELEMETRY_STATE)
+    {
+        aTelemetry.mDeviceRole  = GetDeviceRoleName(otThreadGetDeviceRole(instance));
+        aTelemetry.mPartitionId = otThreadGetPartitionId(instance);
+        aTelemetry.mRloc16      = otThreadGetRloc16(instance);
+    }
+
+    if ((aTelemetry.mFields & OTBR_TELEMETRY_LEADER_DATA) && ReadLeaderData(aTelemetry.mLeaderData) != OT_ERROR_NONE)
+    {
+        aTelemetry.mFields &= ~static_cast<uint32_t>(OTBR_TELEMETRY_LEADER_DATA);
+    }
+
+    if (aTelemetry.mFields & OTBR_TELEMETRY_CHILD_TABLE)
+    {
+        ReadChildTable(aTelemetry.mChildTable);
+    }
+
+    if (aTelemetry.mFields & OTBR_TELEMETRY_NEIGHBOR_TABLE)
+    {
+        ReadNeighborTable(aTelemetry.mNeighborTable);
+    }
+
+    if (aTelemetry.mFields & OTBR_TELEMETRY_NETWORK_DATA)
+    {
+        ReadNetworkData(/*stable=*/false, aTelemetry.mNetworkData);
+        ReadNetworkData(/*stable=*/true, aTelemetry.mStableNetworkData);
+    }
+
+    if (aTelemetry.mFields & OTBR_TELEMETRY_COUNTERS)
+    {
+        ReadLinkCounters(aTelemetry.mLinkCounters);
+        ReadIp6Counters(aTelemetry.mIp6Counters);
+    }
+
+    if (aTelemetry.mFields & OTBR_TELEMETRY_CHANNEL_MONITOR)
+    {
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+        aTelemetry.mChannelMonitorSampleCount = otChannelMonitorGetSampleCount(instance);
+#endif
+        if (ReadChannelQualities(aTelemetry.mChannelQualities) != OT_ERROR_NONE)
+        {
+            aTelemetry.mFields &= ~static_cast<uint32_t>(OTBR_TELEMETRY_CHANNEL_MONITOR);
+        }
+    }
+}
+
+void DBusThreadObject::ReadLinkCounters(MacCounters &aCounters)
+{
+    auto                 threadHelper = mNcp->GetThreadHelper();
+    const otMacCounters *otCounters   = otLinkGetCounters(threadHelper->GetInstance());
+
+    aCounters.mTxTotal              = otCounters->mTxTotal;
+    aCounters.mTxUnicast            = otCounters->mTxUnicast;
+    aCounters.mTxBroadcast          = otCounters->mTxBroadcast;
+    aCounters.mTxAckRequested       = otCounters->mTxAckRequested;
+    aCounters.mTxAcked              = otCounters->mTxAcked;
+    aCounters.mTxNoAckRequested     = otCounters->mTxNoAckRequested;
+    aCounters.mTxData               = otCounters->mTxData;
+    aCounters.mTxDataPoll           = otCounters->mTxDataPoll;
+    aCounters.mTxBeacon             = otCounters->mTxBeacon;
+    aCounters.mTxBeaconRequest      = otCounters->mTxBeaconRequest;
+    aCounters.mTxOther              = otCounters->mTxOther;
+    aCounters.mTxRetry              = otCounters->mTxRetry;
+    aCounters.mTxErrCca             = otCounters->mTxErrCca;
+    aCounters.mTxErrAbort           = otCounters->mTxErrAbort;
+    aCounters.mTxErrBusyChannel     = otCounters->mTxErrBusyChannel;
+    aCounters.mRxTotal              = otCounters->mRxTotal;
+    aCounters.mRxUnicast            = otCounters->mRxUnicast;
+    aCounters.mRxBroadcast          = otCounters->mRxBroadcast;
+    aCounters.mRxData               = otCounters->mRxData;
+    aCounters.mRxDataPoll           = otCounters->mRxDataPoll;
+    aCounters.mRxBeacon             = otCounters->mRxBeacon;
+    aCounters.mRxBeaconRequest      = otCounters->mRxBeaconRequest;
+    aCounters.mRxOther              = otCounters->mRxOther;
+    aCounters.mRxAddressFiltered    = otCounters->mRxAddressFiltered;
+    aCounters.mRxDestAddrFiltered   = otCounters->mRxDestAddrFiltered;
+    aCounters.mRxDuplicated         = otCounters->mRxDuplicated;
+    aCounters.mRxErrNoFrame         = otCounters->mRxErrNoFrame;
+    aCounters.mRxErrUnknownNeighbor = otCounters->mRxErrUnknownNeighbor;
+    aCounters.mRxErrInvalidSrcAddr  = otCounters->mRxErrInvalidSrcAddr;
+    aCounters.mRxErrSec             = otCounters->mRxErrSec;
+    aCounters.mRxErrFcs             = otCounters->mRxErrFcs;
+    aCounters.mRxErrOther           = otCounters->mRxErrOther;
+}
+
+void DBusThreadObject::ReadIp6Counters(IpCounters &aCounters)
+{
+    auto                threadHelper = mNcp->GetThreadHelper();
+    const otIpCounters *otCounters   = otThreadGetIp6Counters(threadHelper->GetInstance());
+
+    aCounters.mTxSuccess = otCounters->mTxSuccess;
+    aCounters.mTxFailure = otCounters->mTxFailure;
+    aCounters.mRxSuccess = otCounters->mRxSuccess;
+    aCounters.mRxFailure = otCounters->mRxFailure;
+}
+
+otError DBusThreadObject::ReadLeaderData(LeaderData &aLeaderData)
+{
+    auto                threadHelper = mNcp->GetThreadHelper();
+    otError             error        = OT_ERROR_NONE;
+    struct otLeaderData data;
+
+    SuccessOrExit(error = otThreadGetLeaderData(threadHelper->GetInstance(), &data));
+    aLeaderData.mPartitionId       = data.mPartitionId;
+    aLeaderData.mWeighting         = data.mWeighting;
+    aLeaderData.mDataVersion       = data.mDataVersion;
+    aLeaderData.mStableDataVersion = data.mStableDataVersion;
+    aLeaderData.mLeaderRouterId    = data.mLeaderRouterId;
+
+exit:
+    return error;
+}
+
+void DBusThreadObject::ReadNetworkData(bool aStable, std::vector<uint8_t> &aNetworkData)
+{
+    static constexpr size_t kNetworkDataMaxSize = 255;
+    auto                    threadHelper        = mNcp->GetThreadHelper();
+    uint8_t                 data[kNetworkDataMaxSize];
+    uint8_t                 len = sizeof(data);
+
+    otNetDataGet(threadHelper->GetInstance(), aStable, data, &len);
+    aNetworkData.assign(&data[0], &data[len]);
+}
+
+void DBusThreadObject::ReadChildTable(std::vector<ChildInfo> &aChildTable)
+{
+    auto        threadHelper = mNcp->GetThreadHelper();
+    uint16_t    childIndex   = 0;
+    otChildInfo childInfo;
+
+    while (otThreadGetChildInfoByIndex(threadHelper->GetInstance(), childIndex, &childInfo) == OT_ERROR_NONE)
+    {
+        ChildInfo info;
+
+        info.mExtAddress         = ConvertOpenThreadUint64(childInfo.mExtAddress.m8, sizeof(childInfo.mExtAddress.m8));
+        info.mTimeout            = childInfo.mTimeout;
+        info.mAge                = childInfo.mAge;
+        info.mChildId            = childInfo.mChildId;
+        info.mNetworkDataVersion = childInfo.mNetworkDataVersion;
+        info.mLinkQualityIn      = childInfo.mLinkQualityIn;
+        info.mAverageRssi        = childInfo.mAverageRssi;
+        info.mLastRssi           = childInfo.mLastRssi;
+        info.mFrameErrorRate     = childInfo.mFrameErrorRate;
+        info.mMessageErrorRate   = childInfo.mMessageErrorRate;
+        info.mRxOnWhenIdle       = childInfo.mRxOnWhenIdle;
+        info.mSecureDataRequest  = childInfo.mSecureDataRequest;
+        info.mFullThreadDevice   = childInfo.mFullThreadDevice;
+        info.mFullNetworkData    = childInfo.mFullNetworkData;
+        info.mIsStateRestoring   = childInfo.mIsStateRestoring;
+        aChildTable.push_back(info);
+        childIndex++;
+    }
+}
+
+void DBusThreadObject::ReadNeighborTable(std::vector<NeighborInfo> &aNeighborTable)
+{
+    auto                   threadHelper = mNcp->GetThreadHelper();
+    otNeighborInfoIterator iter         = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighborInfo;
+
+    while (otThreadGetNextNeighborInfo(threadHelper->GetInstance(), &iter, &neighborInfo) == OT_ERROR_NONE)
+    {
+        NeighborInfo info;
+
+        info.mExtAddress = ConvertOpenThreadUint64(neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8));
+        info.mAge        = neighborInfo.mAge;
+        info.mRloc16     = neighborInfo.mRloc16;
+        info.mLinkFrameCounter  = neighborInfo.mLinkFrameCounter;
+        info.mMleFrameCounter   = neighborInfo.mMleFrameCounter;
+        info.mLinkQualityIn     = neighborInfo.mLinkQualityIn;
+        info.mAverageRssi       = neighborInfo.mAverageRssi;
+        info.mLastRssi          = neighborInfo.mLastRssi;
+        info.mFrameErrorRate    = neighborInfo.mFrameErrorRate;
+        info.mMessageErrorRate  = neighborInfo.mMessageErrorRate;
+        info.mRxOnWhenIdle      = neighborInfo.mRxOnWhenIdle;
+        info.mSecureDataRequest = neighborInfo.mSecureDataRequest;
+        info.mFullThreadDevice  = neighborInfo.mFullThreadDevice;
+        info.mFullNetworkData   = neighborInfo.mFullNetworkData;
+        info.mIsChild           = neighborInfo.mIsChild;
+        aNeighborTable.push_back(info);
+    }
+}
+
+otError DBusThreadObject::ReadChannelQualities(std::vector<ChannelQuality> &aQualities)
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    auto              threadHelper = mNcp->GetThreadHelper();
+    uint32_t          channelMask  = otLinkGetSupportedChannelMask(threadHelper->GetInstance());
+    constexpr uint8_t kNumChannels = sizeof(channelMask) * 8; // 8 bit per byte
+
+    for (uint8_t i = 0; i < kNumChannels; i++)
+    {
+        if (channelMask & (1U << i))
+        {
+            uint16_t occupancy = otChannelMonitorGetChannelOccupancy(threadHelper->GetInstance(), i);
+
+            aQualities.emplace_back(ChannelQuality{i, occupancy});
+        }
+    }
+
+    return OT_ERROR_NONE;
+#else  // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    (void)aQualities;
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+}
+
 } // namespace DBus
 } // namespace otbr
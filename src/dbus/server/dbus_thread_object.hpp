@@ -30,10 +30,13 @@
 #define OTBR_DBUS_THREAD_OBJECT_HPP_
 
 #include <string>
+#include <vector>
 
 #include <openthread/link.h>
 
 #include "agent/ncp_openthread.hpp"
+#include "dbus/common/types.hpp"
+#include "dbus/server/dbus_counters_publisher.hpp"
 #include "dbus/server/dbus_object.hpp"
 
 namespace otbr {
@@ -64,8 +67,32 @@ public:
      */
     otbrError Init(void) override;
 
+    /**
+     * This method returns when the next counters delta is due to be sent.
+     *
+     * @param[out]  aDelay  Milliseconds before the next counters delta is due.
+     *
+     * @returns Whether any client subscribed to counters.
+     *
+     */
+    bool GetCountersDeltaDelay(unsigned long &aDelay) const { return mCountersPublisher.GetDeltaDelay(aDelay); }
+
+    /**
+     * This method sends the counters deltas which are due to their subscribers.
+     *
+     */
+    void SendCountersDeltas(void) { mCountersPublisher.SendDeltas(); }
+
 private:
-    void DeviceRoleHandler(otDeviceRole aDeviceRole);
+    enum
+    {
+        kTableChangedMinInterval = 1000,   ///< Min milliseconds between two changes sent of the tables.
+        kScanTimeout             = 30000,  ///< Milliseconds before a call of Scan times out.
+        kAttachTimeout           = 120000, ///< Milliseconds before a call of Attach times out.
+        kJoinerStartTimeout      = 120000, ///< Milliseconds before a call of JoinerStart times out.
+    };
+
+    void StateChangedHandler(otChangedFlags aFlags);
 
     void ScanHandler(DBusRequest &aRequest);
     void AttachHandler(DBusRequest &aRequest);
@@ -79,6 +106,8 @@ private:
     void RemoveOnMeshPrefixHandler(DBusRequest &aRequest);
     void AddExternalRouteHandler(DBusRequest &aRequest);
     void RemoveExternalRouteHandler(DBusRequest &aRequest);
+    void SetLogLevelsHandler(DBusRequest &aRequest);
+    void GetTelemetryHandler(DBusRequest &aRequest);
 
     otError SetMeshLocalPrefixHandler(DBusMessageIter &aIter);
     otError SetLegacyUlaPrefixHandler(DBusMessageIter &aIter);
@@ -111,9 +140,21 @@ private:
     otError GetRadioTxPowerHandler(DBusMessageIter &aIter);
     otError GetExternalRoutesHandler(DBusMessageIter &aIter);
 
+    uint32_t ReadCounter(uint8_t aIndex);
+    void     ReadTelemetry(uint32_t aFields, Telemetry &aTelemetry);
+    void     ReadLinkCounters(MacCounters &aCounters);
+    void     ReadIp6Counters(IpCounters &aCounters);
+    otError  ReadLeaderData(LeaderData &aLeaderData);
+    void     ReadNetworkData(bool aStable, std::vector<uint8_t> &aNetworkData);
+    void     ReadChildTable(std::vector<ChildInfo> &aChildTable);
+    void     ReadNeighborTable(std::vector<NeighborInfo> &aNeighborTable);
+    otError  ReadChannelQualities(std::vector<ChannelQuality> &aQualities);
+
     void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
 
     otbr::Ncp::ControllerOpenThread *mNcp;
+    DBusCountersPublisher            mCountersPublisher;
+    Telemetry                        mTelemetry;
 };
 
 } // namespace DBus
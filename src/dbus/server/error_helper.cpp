@@ -26,6 +26,8 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_DBUS
+
 #include "dbus/server/error_helper.hpp"
 #include "common/code_utils.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
@@ -35,30 +35,85 @@
 
 namespace otbr {
 
+/**
+ * This structure holds the lookup tables of both polynomials, generated once.
+ *
+ */
+struct Crc16::TableSet
+{
+    TableSet(void)
+    {
+        Generate(kCcitt, mCcitt);
+        Generate(kAnsi, mAnsi);
+    }
+
+    static void Generate(uint16_t aPolynomial, Tables &aTables)
+    {
+        for (int byte = 0; byte < 256; byte++)
+        {
+            uint16_t crc = static_cast<uint16_t>(byte << 8);
+
+            for (int i = 0; i < 8; i++)
+            {
+                crc = (crc & 0x8000) ? static_cast<uint16_t>(static_cast<uint16_t>(crc << 1) ^ aPolynomial)
+                                     : static_cast<uint16_t>(crc << 1);
+            }
+
+            aTables[0][byte] = crc;
+        }
+
+        // Table N gives the CRC of a byte followed by N zero bytes.
+        for (int slice = 1; slice < kNumSlices; slice++)
+        {
+            for (int byte = 0; byte < 256; byte++)
+            {
+                uint16_t crc = aTables[slice - 1][byte];
+
+                aTables[slice][byte] = static_cast<uint16_t>(crc << 8) ^ aTables[0][crc >> 8];
+            }
+        }
+    }
+
+    Tables mCcitt;
+    Tables mAnsi;
+};
+
 Crc16::Crc16(Polynomial aPolynomial)
+    : mTables(GetTables(aPolynomial))
 {
-    mPolynomial = static_cast<uint16_t>(aPolynomial);
     Init();
 }
 
-void Crc16::Update(uint8_t aByte)
+const Crc16::Tables &Crc16::GetTables(Polynomial aPolynomial)
 {
-    uint8_t i;
+    static const TableSet sTableSet;
 
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+    return aPolynomial == kCcitt ? sTableSet.mCcitt : sTableSet.mAnsi;
+}
 
-    do
+void Crc16::Update(const uint8_t *aBuffer, size_t aLength)
+{
+    uint16_t crc = mCrc;
+
+    // The CRC register is xor-ed into the first two bytes, then each of the eight bytes contributes the CRC of
+    // itself followed by the bytes after it, as both are linear.
+    while (aLength >= kNumSlices)
     {
-        if (mCrc & 0x8000)
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
-        }
-        else
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
-        }
-    } while (--i);
+        uint16_t first = crc ^ static_cast<uint16_t>((aBuffer[0] << 8) | aBuffer[1]);
+
+        crc = mTables[7][first >> 8] ^ mTables[6][first & 0xff] ^ mTables[5][aBuffer[2]] ^ mTables[4][aBuffer[3]] ^
+              mTables[3][aBuffer[4]] ^ mTables[2][aBuffer[5]] ^ mTables[1][aBuffer[6]] ^ mTables[0][aBuffer[7]];
+
+        aBuffer += kNumSlices;
+        aLength -= kNumSlices;
+    }
+
+    while (aLength--)
+    {
+        crc = static_cast<uint16_t>(crc << 8) ^ mTables[0][(crc >> 8) ^ *aBuffer++];
+    }
+
+    mCrc = crc;
 }
 
 } // namespace otbr
@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace otbr {
@@ -43,6 +44,8 @@ namespace otbr {
 /**
  * This class implements CRC16 computations.
  *
+ * Bytes are processed through lookup tables, eight at a time when a buffer is fed (slice-by-8).
+ *
  */
 class Crc16
 {
@@ -67,13 +70,22 @@ public:
      */
     void Init(void) { mCrc = 0; }
 
-    /*c*
+    /**
      * This method feeds a byte value into the CRC16 computation.
      *
      * @param[in]  aByte  The byte value.
      *
      */
-    void Update(uint8_t aByte);
+    void Update(uint8_t aByte) { mCrc = static_cast<uint16_t>(mCrc << 8) ^ mTables[0][(mCrc >> 8) ^ aByte]; }
+
+    /**
+     * This method feeds bytes into the CRC16 computation.
+     *
+     * @param[in]  aBuffer  A pointer to the bytes.
+     * @param[in]  aLength  Number of bytes.
+     *
+     */
+    void Update(const uint8_t *aBuffer, size_t aLength);
 
     /**
      * This method gets the current CRC16 value.
@@ -84,8 +96,19 @@ public:
     uint16_t Get(void) const { return mCrc; }
 
 private:
-    uint16_t mPolynomial;
-    uint16_t mCrc;
+    enum
+    {
+        kNumSlices = 8, ///< Bytes processed at once by the slice-by-8 update.
+    };
+
+    typedef uint16_t Tables[kNumSlices][256];
+
+    struct TableSet;
+
+    static const Tables &GetTables(Polynomial aPolynomial);
+
+    const Tables &mTables;
+    uint16_t      mCrc;
 };
 
 } // namespace otbr
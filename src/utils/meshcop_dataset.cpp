@@ -0,0 +1,454 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/meshcop_dataset.hpp"
+
+#include <assert.h>
+#include <errno.h>
+
+#include "common/code_utils.hpp"
+#include "common/tlv.hpp"
+#include "utils/strcpy_utils.hpp"
+
+namespace otbr {
+
+enum
+{
+    kSizeTimestamp      = 8, ///< Size of the Active/Pending Timestamp value.
+    kSizeChannel        = 3, ///< Size of the Channel value, channel page and channel.
+    kSizeSecurityPolicy = 3, ///< Size of the Security Policy value, rotation time and flags.
+    kChannelPage0       = 0, ///< Channel page of 2.4GHz O-QPSK.
+};
+
+static void WriteUint32(uint32_t aValue, uint8_t *aBuffer)
+{
+    aBuffer[0] = static_cast<uint8_t>(aValue >> 24);
+    aBuffer[1] = static_cast<uint8_t>(aValue >> 16);
+    aBuffer[2] = static_cast<uint8_t>(aValue >> 8);
+    aBuffer[3] = static_cast<uint8_t>(aValue);
+}
+
+static uint32_t ReadUint32(const uint8_t *aBuffer)
+{
+    return static_cast<uint32_t>(aBuffer[0]) << 24 | static_cast<uint32_t>(aBuffer[1]) << 16 |
+           static_cast<uint32_t>(aBuffer[2]) << 8 | aBuffer[3];
+}
+
+/**
+ * Channel masks are transmitted with channel 0 at the most significant bit of the first byte.
+ *
+ */
+static uint32_t Reverse32(uint32_t aValue)
+{
+    uint32_t result = 0;
+
+    for (int i = 0; i < 32; i++)
+    {
+        result = (result << 1) | ((aValue >> i) & 1);
+    }
+
+    return result;
+}
+
+static void WriteTimestamp(uint64_t aSeconds, uint8_t *aBuffer)
+{
+    // 48 bits seconds, 15 bits ticks and 1 bit authoritative, ticks and authoritative are always zero.
+    WriteUint32(static_cast<uint32_t>(aSeconds >> 16), aBuffer);
+    aBuffer[4] = static_cast<uint8_t>(aSeconds >> 8);
+    aBuffer[5] = static_cast<uint8_t>(aSeconds);
+    aBuffer[6] = 0;
+    aBuffer[7] = 0;
+}
+
+static uint64_t ReadTimestamp(const uint8_t *aBuffer)
+{
+    return static_cast<uint64_t>(ReadUint32(aBuffer)) << 16 | static_cast<uint64_t>(aBuffer[4]) << 8 | aBuffer[5];
+}
+
+void MeshcopDataset::WriteChannelMask(uint32_t aChannelMask, uint8_t *aBuffer)
+{
+    aBuffer[0] = kChannelPage0;
+    aBuffer[1] = sizeof(uint32_t);
+    WriteUint32(Reverse32(aChannelMask), aBuffer + 2);
+}
+
+bool MeshcopDataset::ReadChannelMask(const uint8_t *aEntry, uint32_t &aChannelMask)
+{
+    bool isPage0 = (aEntry[0] == kChannelPage0 && aEntry[1] == sizeof(uint32_t));
+
+    if (isPage0)
+    {
+        aChannelMask = Reverse32(ReadUint32(aEntry + 2));
+    }
+
+    return isPage0;
+}
+
+void MeshcopDataset::Clear(void)
+{
+    mComponents          = 0;
+    mActiveTimestamp     = 0;
+    mPendingTimestamp    = 0;
+    mDelayTimer          = 0;
+    mChannel             = 0;
+    mChannelMask         = 0;
+    mPanId               = 0;
+    mRotationTime        = 0;
+    mSecurityPolicyFlags = 0;
+    memset(mExtPanId, 0, sizeof(mExtPanId));
+    memset(mNetworkName, 0, sizeof(mNetworkName));
+    memset(mPskc, 0, sizeof(mPskc));
+    memset(mMasterKey, 0, sizeof(mMasterKey));
+    memset(mMeshLocalPrefix, 0, sizeof(mMeshLocalPrefix));
+
+    mTlvsLength = 0;
+    mTlvsValid  = true;
+}
+
+void MeshcopDataset::Remove(Component aComponent)
+{
+    VerifyOrExit(IsPresent(aComponent));
+
+    mComponents &= static_cast<uint16_t>(~aComponent);
+    mTlvsValid = false;
+
+exit:
+    return;
+}
+
+void MeshcopDataset::SetActiveTimestamp(uint64_t aSeconds)
+{
+    mActiveTimestamp = aSeconds & 0xffffffffffffULL;
+    SetPresent(kComponentActiveTimestamp);
+}
+
+void MeshcopDataset::SetPendingTimestamp(uint64_t aSeconds)
+{
+    mPendingTimestamp = aSeconds & 0xffffffffffffULL;
+    SetPresent(kComponentPendingTimestamp);
+}
+
+void MeshcopDataset::SetDelayTimer(uint32_t aDelay)
+{
+    mDelayTimer = aDelay;
+    SetPresent(kComponentDelayTimer);
+}
+
+void MeshcopDataset::SetChannel(uint16_t aChannel)
+{
+    mChannel = aChannel;
+    SetPresent(kComponentChannel);
+}
+
+void MeshcopDataset::SetChannelMask(uint32_t aChannelMask)
+{
+    mChannelMask = aChannelMask;
+    SetPresent(kComponentChannelMask);
+}
+
+void MeshcopDataset::SetPanId(uint16_t aPanId)
+{
+    mPanId = aPanId;
+    SetPresent(kComponentPanId);
+}
+
+void MeshcopDataset::SetExtPanId(const uint8_t *aExtPanId)
+{
+    memcpy(mExtPanId, aExtPanId, sizeof(mExtPanId));
+    SetPresent(kComponentExtPanId);
+}
+
+otbrError MeshcopDataset::SetNetworkName(const char *aNetworkName)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(strcpy_safe(mNetworkName, sizeof(mNetworkName), aNetworkName) == 0, error = OTBR_ERROR_ERRNO,
+                 errno = EINVAL);
+    SetPresent(kComponentNetworkName);
+
+exit:
+    return error;
+}
+
+void MeshcopDataset::SetPskc(const uint8_t *aPskc)
+{
+    memcpy(mPskc, aPskc, sizeof(mPskc));
+    SetPresent(kComponentPskc);
+}
+
+void MeshcopDataset::SetMasterKey(const uint8_t *aMasterKey)
+{
+    memcpy(mMasterKey, aMasterKey, sizeof(mMasterKey));
+    SetPresent(kComponentMasterKey);
+}
+
+void MeshcopDataset::SetMeshLocalPrefix(const uint8_t *aPrefix)
+{
+    memcpy(mMeshLocalPrefix, aPrefix, sizeof(mMeshLocalPrefix));
+    SetPresent(kComponentMeshLocalPrefix);
+}
+
+void MeshcopDataset::SetSecurityPolicy(uint16_t aRotationTime, uint8_t aFlags)
+{
+    mRotationTime        = aRotationTime;
+    mSecurityPolicyFlags = aFlags;
+    SetPresent(kComponentSecurityPolicy);
+}
+
+otbrError MeshcopDataset::Decode(const uint8_t *aTlvs, uint16_t aLength)
+{
+    otbrError      error = OTBR_ERROR_ERRNO;
+    const uint8_t *end   = aTlvs + aLength;
+    const Tlv *    tlv   = reinterpret_cast<const Tlv *>(aTlvs);
+
+    Clear();
+
+    VerifyOrExit(aLength <= kMaxSize, errno = EMSGSIZE);
+
+    while (reinterpret_cast<const uint8_t *>(tlv) < end)
+    {
+        const uint8_t *value;
+        uint16_t       length;
+
+        // Type and length must be readable before the value is located.
+        VerifyOrExit(reinterpret_cast<const uint8_t *>(tlv) + 2 <= end, errno = EINVAL);
+        value = static_cast<const uint8_t *>(tlv->GetValue());
+        VerifyOrExit(value <= end, errno = EINVAL);
+        length = tlv->GetLength();
+        VerifyOrExit(length <= end - value, errno = EINVAL);
+
+        switch (tlv->GetType())
+        {
+        case Meshcop::kChannel:
+            VerifyOrExit(length >= kSizeChannel, errno = EINVAL);
+            SetChannel(static_cast<uint16_t>(value[1] << 8 | value[2]));
+            break;
+
+        case Meshcop::kPanId:
+            VerifyOrExit(length >= sizeof(uint16_t), errno = EINVAL);
+            SetPanId(tlv->GetValueUInt16());
+            break;
+
+        case Meshcop::kExtendedPanId:
+            VerifyOrExit(length >= sizeof(mExtPanId), errno = EINVAL);
+            SetExtPanId(value);
+            break;
+
+        case Meshcop::kNetworkName:
+            VerifyOrExit(length <= kSizeNetworkName, errno = EINVAL);
+            memcpy(mNetworkName, value, length);
+            mNetworkName[length] = '\0';
+            SetPresent(kComponentNetworkName);
+            break;
+
+        case Meshcop::kPskc:
+            VerifyOrExit(length >= sizeof(mPskc), errno = EINVAL);
+            SetPskc(value);
+            break;
+
+        case Meshcop::kMasterKey:
+            VerifyOrExit(length >= sizeof(mMasterKey), errno = EINVAL);
+            SetMasterKey(value);
+            break;
+
+        case Meshcop::kMeshLocalPrefix:
+            VerifyOrExit(length >= sizeof(mMeshLocalPrefix), errno = EINVAL);
+            SetMeshLocalPrefix(value);
+            break;
+
+        case Meshcop::kSecurityPolicy:
+            VerifyOrExit(length >= kSizeSecurityPolicy, errno = EINVAL);
+            SetSecurityPolicy(tlv->GetValueUInt16(), value[2]);
+            break;
+
+        case Meshcop::kActiveTimestamp:
+            VerifyOrExit(length >= kSizeTimestamp, errno = EINVAL);
+            SetActiveTimestamp(ReadTimestamp(value));
+            break;
+
+        case Meshcop::kPendingTimestamp:
+            VerifyOrExit(length >= kSizeTimestamp, errno = EINVAL);
+            SetPendingTimestamp(ReadTimestamp(value));
+            break;
+
+        case Meshcop::kDelayTimer:
+            VerifyOrExit(length >= sizeof(uint32_t), errno = EINVAL);
+            SetDelayTimer(ReadUint32(value));
+            break;
+
+        case Meshcop::kChannelMask:
+            for (const uint8_t *entry = value; entry + 2 <= value + length; entry += 2 + entry[1])
+            {
+                uint32_t channelMask;
+
+                VerifyOrExit(entry + 2 + entry[1] <= value + length, errno = EINVAL);
+
+                if (ReadChannelMask(entry, channelMask))
+                {
+                    SetChannelMask(channelMask);
+                }
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        tlv = tlv->GetNext();
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Clear();
+    }
+
+    return error;
+}
+
+const uint8_t *MeshcopDataset::GetTlvs(uint16_t &aLength) const
+{
+    if (!mTlvsValid)
+    {
+        Encode();
+    }
+
+    aLength = mTlvsLength;
+
+    return mTlvs;
+}
+
+void MeshcopDataset::Encode(void) const
+{
+    uint8_t buffer[kSizeTimestamp];
+    Tlv *   tlv = reinterpret_cast<Tlv *>(mTlvs);
+
+    // TLVs are encoded in ascending order of type.
+    if (IsPresent(kComponentChannel))
+    {
+        buffer[0] = kChannelPage0;
+        buffer[1] = static_cast<uint8_t>(mChannel >> 8);
+        buffer[2] = static_cast<uint8_t>(mChannel & 0xff);
+        tlv->SetType(Meshcop::kChannel);
+        tlv->SetValue(buffer, kSizeChannel);
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentPanId))
+    {
+        tlv->SetType(Meshcop::kPanId);
+        tlv->SetValue(mPanId);
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentExtPanId))
+    {
+        tlv->SetType(Meshcop::kExtendedPanId);
+        tlv->SetValue(mExtPanId, sizeof(mExtPanId));
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentNetworkName))
+    {
+        tlv->SetType(Meshcop::kNetworkName);
+        tlv->SetValue(mNetworkName, static_cast<uint16_t>(strlen(mNetworkName)));
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentPskc))
+    {
+        tlv->SetType(Meshcop::kPskc);
+        tlv->SetValue(mPskc, sizeof(mPskc));
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentMasterKey))
+    {
+        tlv->SetType(Meshcop::kMasterKey);
+        tlv->SetValue(mMasterKey, sizeof(mMasterKey));
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentMeshLocalPrefix))
+    {
+        tlv->SetType(Meshcop::kMeshLocalPrefix);
+        tlv->SetValue(mMeshLocalPrefix, sizeof(mMeshLocalPrefix));
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentSecurityPolicy))
+    {
+        buffer[0] = static_cast<uint8_t>(mRotationTime >> 8);
+        buffer[1] = static_cast<uint8_t>(mRotationTime & 0xff);
+        buffer[2] = mSecurityPolicyFlags;
+        tlv->SetType(Meshcop::kSecurityPolicy);
+        tlv->SetValue(buffer, kSizeSecurityPolicy);
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentActiveTimestamp))
+    {
+        WriteTimestamp(mActiveTimestamp, buffer);
+        tlv->SetType(Meshcop::kActiveTimestamp);
+        tlv->SetValue(buffer, kSizeTimestamp);
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentPendingTimestamp))
+    {
+        WriteTimestamp(mPendingTimestamp, buffer);
+        tlv->SetType(Meshcop::kPendingTimestamp);
+        tlv->SetValue(buffer, kSizeTimestamp);
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentDelayTimer))
+    {
+        WriteUint32(mDelayTimer, buffer);
+        tlv->SetType(Meshcop::kDelayTimer);
+        tlv->SetValue(buffer, sizeof(uint32_t));
+        tlv = tlv->GetNext();
+    }
+
+    if (IsPresent(kComponentChannelMask))
+    {
+        WriteChannelMask(mChannelMask, buffer);
+        tlv->SetType(Meshcop::kChannelMask);
+        tlv->SetValue(buffer, kSizeChannelMask);
+        tlv = tlv->GetNext();
+    }
+
+    mTlvsLength = static_cast<uint16_t>(reinterpret_cast<uint8_t *>(tlv) - mTlvs);
+    mTlvsValid  = true;
+
+    assert(mTlvsLength <= sizeof(mTlvs));
+}
+
+} // namespace otbr
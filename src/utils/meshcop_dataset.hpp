@@ -0,0 +1,364 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file provides the MeshCoP operational dataset codec.
+ */
+
+#ifndef OTBR_UTILS_MESHCOP_DATASET_HPP_
+#define OTBR_UTILS_MESHCOP_DATASET_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class represents a MeshCoP active or pending operational dataset.
+ *
+ * The serialized TLVs are cached and only re-encoded after the dataset has been modified.
+ *
+ */
+class MeshcopDataset
+{
+public:
+    enum
+    {
+        kMaxSize         = 254, ///< Max size of the serialized dataset in bytes.
+        kSizeChannelMask = 6,   ///< Size of one Channel Mask entry of page 0, page, length and mask.
+    };
+
+    /**
+     * This enumeration represents the components of a dataset.
+     *
+     */
+    enum Component
+    {
+        kComponentActiveTimestamp  = 1 << 0,  ///< Active Timestamp.
+        kComponentPendingTimestamp = 1 << 1,  ///< Pending Timestamp.
+        kComponentDelayTimer       = 1 << 2,  ///< Delay Timer.
+        kComponentChannel          = 1 << 3,  ///< Channel.
+        kComponentChannelMask      = 1 << 4,  ///< Channel Mask of page 0.
+        kComponentPanId            = 1 << 5,  ///< PAN ID.
+        kComponentExtPanId         = 1 << 6,  ///< Extended PAN ID.
+        kComponentNetworkName      = 1 << 7,  ///< Network Name.
+        kComponentPskc             = 1 << 8,  ///< PSKc.
+        kComponentMasterKey        = 1 << 9,  ///< Master Key.
+        kComponentMeshLocalPrefix  = 1 << 10, ///< Mesh Local Prefix.
+        kComponentSecurityPolicy   = 1 << 11, ///< Security Policy.
+    };
+
+    /**
+     * This function writes a Channel Mask entry of page 0.
+     *
+     * @param[in]   aChannelMask    The channel mask, bit N stands for channel N.
+     * @param[out]  aBuffer         A pointer to at least kSizeChannelMask bytes.
+     *
+     */
+    static void WriteChannelMask(uint32_t aChannelMask, uint8_t *aBuffer);
+
+    /**
+     * This function reads a Channel Mask entry.
+     *
+     * @param[in]   aEntry          A pointer to the entry, the caller has checked the entry length.
+     * @param[out]  aChannelMask    The channel mask, bit N stands for channel N.
+     *
+     * @returns Whether @p aEntry is an entry of page 0.
+     *
+     */
+    static bool ReadChannelMask(const uint8_t *aEntry, uint32_t &aChannelMask);
+
+    /**
+     * The constructor initializes an empty dataset.
+     *
+     */
+    MeshcopDataset(void) { Clear(); }
+
+    /**
+     * This method removes all components of the dataset.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns whether a component is present.
+     *
+     * @param[in]   aComponent      The component.
+     *
+     * @returns Whether @p aComponent is present.
+     *
+     */
+    bool IsPresent(Component aComponent) const { return (mComponents & aComponent) != 0; }
+
+    /**
+     * This method removes a component.
+     *
+     * @param[in]   aComponent      The component.
+     *
+     */
+    void Remove(Component aComponent);
+
+    /**
+     * This method returns the seconds of the Active Timestamp.
+     *
+     */
+    uint64_t GetActiveTimestamp(void) const { return mActiveTimestamp; }
+
+    /**
+     * This method sets the Active Timestamp.
+     *
+     * @param[in]   aSeconds        The seconds of the timestamp, only the lower 48 bits are used.
+     *
+     */
+    void SetActiveTimestamp(uint64_t aSeconds);
+
+    /**
+     * This method returns the seconds of the Pending Timestamp.
+     *
+     */
+    uint64_t GetPendingTimestamp(void) const { return mPendingTimestamp; }
+
+    /**
+     * This method sets the Pending Timestamp.
+     *
+     * @param[in]   aSeconds        The seconds of the timestamp, only the lower 48 bits are used.
+     *
+     */
+    void SetPendingTimestamp(uint64_t aSeconds);
+
+    /**
+     * This method returns the Delay Timer in milliseconds.
+     *
+     */
+    uint32_t GetDelayTimer(void) const { return mDelayTimer; }
+
+    /**
+     * This method sets the Delay Timer.
+     *
+     * @param[in]   aDelay          The delay in milliseconds.
+     *
+     */
+    void SetDelayTimer(uint32_t aDelay);
+
+    /**
+     * This method returns the channel on page 0.
+     *
+     */
+    uint16_t GetChannel(void) const { return mChannel; }
+
+    /**
+     * This method sets the channel on page 0.
+     *
+     * @param[in]   aChannel        The channel.
+     *
+     */
+    void SetChannel(uint16_t aChannel);
+
+    /**
+     * This method returns the channel mask of page 0, bit N stands for channel N.
+     *
+     */
+    uint32_t GetChannelMask(void) const { return mChannelMask; }
+
+    /**
+     * This method sets the channel mask of page 0.
+     *
+     * @param[in]   aChannelMask    The channel mask, bit N stands for channel N.
+     *
+     */
+    void SetChannelMask(uint32_t aChannelMask);
+
+    /**
+     * This method returns the PAN ID.
+     *
+     */
+    uint16_t GetPanId(void) const { return mPanId; }
+
+    /**
+     * This method sets the PAN ID.
+     *
+     * @param[in]   aPanId          The PAN ID.
+     *
+     */
+    void SetPanId(uint16_t aPanId);
+
+    /**
+     * This method returns a pointer to the Extended PAN ID.
+     *
+     */
+    const uint8_t *GetExtPanId(void) const { return mExtPanId; }
+
+    /**
+     * This method sets the Extended PAN ID.
+     *
+     * @param[in]   aExtPanId       A pointer to the Extended PAN ID of kSizeExtPanId bytes.
+     *
+     */
+    void SetExtPanId(const uint8_t *aExtPanId);
+
+    /**
+     * This method returns the Network Name.
+     *
+     */
+    const char *GetNetworkName(void) const { return mNetworkName; }
+
+    /**
+     * This method sets the Network Name.
+     *
+     * @param[in]   aNetworkName    The Network Name.
+     *
+     * @retval OTBR_ERROR_NONE      Successfully set the Network Name.
+     * @retval OTBR_ERROR_ERRNO     The Network Name is longer than kSizeNetworkName.
+     *
+     */
+    otbrError SetNetworkName(const char *aNetworkName);
+
+    /**
+     * This method returns a pointer to the PSKc.
+     *
+     */
+    const uint8_t *GetPskc(void) const { return mPskc; }
+
+    /**
+     * This method sets the PSKc.
+     *
+     * @param[in]   aPskc           A pointer to the PSKc of OTBR_PSKC_SIZE bytes.
+     *
+     */
+    void SetPskc(const uint8_t *aPskc);
+
+    /**
+     * This method returns a pointer to the Master Key.
+     *
+     */
+    const uint8_t *GetMasterKey(void) const { return mMasterKey; }
+
+    /**
+     * This method sets the Master Key.
+     *
+     * @param[in]   aMasterKey      A pointer to the Master Key of OTBR_MASTER_KEY_SIZE bytes.
+     *
+     */
+    void SetMasterKey(const uint8_t *aMasterKey);
+
+    /**
+     * This method returns a pointer to the Mesh Local Prefix.
+     *
+     */
+    const uint8_t *GetMeshLocalPrefix(void) const { return mMeshLocalPrefix; }
+
+    /**
+     * This method sets the Mesh Local Prefix.
+     *
+     * @param[in]   aPrefix         A pointer to the Mesh Local Prefix of OTBR_IP6_PREFIX_SIZE bytes.
+     *
+     */
+    void SetMeshLocalPrefix(const uint8_t *aPrefix);
+
+    /**
+     * This method returns the key rotation time of the Security Policy in hours.
+     *
+     */
+    uint16_t GetRotationTime(void) const { return mRotationTime; }
+
+    /**
+     * This method returns the flags of the Security Policy.
+     *
+     */
+    uint8_t GetSecurityPolicyFlags(void) const { return mSecurityPolicyFlags; }
+
+    /**
+     * This method sets the Security Policy.
+     *
+     * @param[in]   aRotationTime   The key rotation time in hours.
+     * @param[in]   aFlags          The security policy flags.
+     *
+     */
+    void SetSecurityPolicy(uint16_t aRotationTime, uint8_t aFlags);
+
+    /**
+     * This method decodes the dataset from MeshCoP TLVs, unknown TLVs are ignored.
+     *
+     * @param[in]   aTlvs           A pointer to the TLVs.
+     * @param[in]   aLength         Length of the TLVs in bytes.
+     *
+     * @retval OTBR_ERROR_NONE      Successfully decoded the dataset.
+     * @retval OTBR_ERROR_ERRNO     The TLVs are malformed, the dataset is cleared.
+     *
+     */
+    otbrError Decode(const uint8_t *aTlvs, uint16_t aLength);
+
+    /**
+     * This method returns the dataset encoded as MeshCoP TLVs.
+     *
+     * The encoded form is cached until the next modification.
+     *
+     * @param[out]  aLength         Length of the TLVs in bytes.
+     *
+     * @returns A pointer to the TLVs, valid until the next modification of this dataset.
+     *
+     */
+    const uint8_t *GetTlvs(uint16_t &aLength) const;
+
+private:
+    void SetPresent(Component aComponent)
+    {
+        mComponents |= static_cast<uint16_t>(aComponent);
+        mTlvsValid = false;
+    }
+
+    void Encode(void) const;
+
+    uint16_t mComponents;
+    uint64_t mActiveTimestamp;
+    uint64_t mPendingTimestamp;
+    uint32_t mDelayTimer;
+    uint16_t mChannel;
+    uint32_t mChannelMask;
+    uint16_t mPanId;
+    uint8_t  mExtPanId[kSizeExtPanId];
+    char     mNetworkName[kSizeNetworkName + 1];
+    uint8_t  mPskc[OTBR_PSKC_SIZE];
+    uint8_t  mMasterKey[OTBR_MASTER_KEY_SIZE];
+    uint8_t  mMeshLocalPrefix[OTBR_IP6_PREFIX_SIZE];
+    uint16_t mRotationTime;
+    uint8_t  mSecurityPolicyFlags;
+
+    mutable uint8_t  mTlvs[kMaxSize];
+    mutable uint16_t mTlvsLength;
+    mutable bool     mTlvsValid;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_MESHCOP_DATASET_HPP_
@@ -29,92 +29,542 @@
 /**
  * @file
  *   This file implements the generating pskc function.
+ *
+ *   The PSKc is PBKDF2 with AES-CMAC-PRF-128, which takes 16384 AES-CMAC computations under the same key. The key
+ *   is derived and expanded once, and since every iteration after the first one processes a single complete block,
+ *   U_i reduces to AES_K(U_{i-1} ^ K1) and runs in a tight loop on AES instructions when the CPU has them.
  */
 
 #include "utils/pskc.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <mbedtls/aes.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define OTBR_PSKC_AES_NI 1
+#include <cpuid.h>
+#include <wmmintrin.h>
+#else
+#define OTBR_PSKC_AES_NI 0
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+#define OTBR_PSKC_ARM_CRYPTO 1
+#include <arm_neon.h>
+#else
+#define OTBR_PSKC_ARM_CRYPTO 0
+#endif
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
 namespace otbr {
 namespace Psk {
 
-void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
+namespace {
+
+enum
 {
-    const char *saltPrefix = "Thread";
-    int         cur        = 0;
-    int         ret        = kPskcStatus_Ok;
+    kAesBlockSize      = 16,
+    kAesRounds         = 10,
+    kNetworkNameMaxLen = 16,
+};
 
-    memset(mSalt, 0, sizeof(mSalt));
-    memcpy(mSalt, saltPrefix, strlen(saltPrefix));
-    cur += strlen(saltPrefix);
+const char kSaltPrefix[] = "Thread";
 
-    memcpy(mSalt + cur, aExtPanId, OT_EXTENDED_PAN_ID_LENGTH);
-    cur += OT_EXTENDED_PAN_ID_LENGTH;
+const uint8_t kSbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
 
-    VerifyOrExit(strlen(aNetworkName) > 0, ret = kPskcStatus_InvalidArgument);
-    memcpy(mSalt + cur, aNetworkName, strlen(aNetworkName));
-    cur += strlen(aNetworkName);
+const uint8_t kRcon[kAesRounds] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36};
 
-    mSaltLen = static_cast<uint16_t>(cur);
+typedef uint8_t RoundKeys[kAesRounds + 1][kAesBlockSize];
 
-exit:
-    if (ret != kPskcStatus_Ok)
+void ExpandKey(const uint8_t *aKey, RoundKeys &aRoundKeys)
+{
+    memcpy(aRoundKeys[0], aKey, kAesBlockSize);
+
+    for (int round = 1; round <= kAesRounds; round++)
     {
-        otbrLog(OTBR_LOG_ERR, "ExtPanId or NetworkName is NULL");
+        const uint8_t *prev = aRoundKeys[round - 1];
+        uint8_t *      next = aRoundKeys[round];
+
+        next[0] = prev[0] ^ kSbox[prev[13]] ^ kRcon[round - 1];
+        next[1] = prev[1] ^ kSbox[prev[14]];
+        next[2] = prev[2] ^ kSbox[prev[15]];
+        next[3] = prev[3] ^ kSbox[prev[12]];
+
+        for (int i = 4; i < kAesBlockSize; i++)
+        {
+            next[i] = prev[i] ^ next[i - 4];
+        }
     }
-    return;
 }
 
-const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
+void XorBlock(uint8_t *aBlock, const uint8_t *aOther)
+{
+    for (int i = 0; i < kAesBlockSize; i++)
+    {
+        aBlock[i] ^= aOther[i];
+    }
+}
+
+/**
+ * This function doubles a block in GF(2^128), as done to derive the CMAC subkeys.
+ *
+ */
+void DoubleBlock(const uint8_t *aIn, uint8_t *aOut)
+{
+    uint8_t carry = 0;
+
+    for (int i = kAesBlockSize - 1; i >= 0; i--)
+    {
+        uint8_t msb = aIn[i] >> 7;
+
+        aOut[i] = static_cast<uint8_t>((aIn[i] << 1) | carry);
+        carry   = msb;
+    }
+
+    if (carry)
+    {
+        aOut[kAesBlockSize - 1] ^= 0x87;
+    }
+}
+
+#if OTBR_PSKC_AES_NI
+
+bool HasAesNi(void)
 {
-    uint32_t blockCounter = 0;
-    uint16_t useLen       = 0;
-    uint16_t prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
-    uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint16_t keyLen = OT_PSKC_LENGTH;
-    uint8_t *pskc   = mPskc;
+    unsigned int eax, ebx, ecx, edx;
 
-    SetSalt(aExtPanId, aNetworkName);
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_AES);
+}
 
-    while (keyLen)
+__attribute__((target("aes,sse2"))) void AesNiEncrypt(const RoundKeys &aRoundKeys, const uint8_t *aIn, uint8_t *aOut)
+{
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aIn));
+
+    block = _mm_xor_si128(block, _mm_loadu_si128(reinterpret_cast<const __m128i *>(aRoundKeys[0])));
+    for (int round = 1; round < kAesRounds; round++)
     {
-        memcpy(prfInput, mSalt, mSaltLen);
+        block = _mm_aesenc_si128(block, _mm_loadu_si128(reinterpret_cast<const __m128i *>(aRoundKeys[round])));
+    }
+    block = _mm_aesenclast_si128(block, _mm_loadu_si128(reinterpret_cast<const __m128i *>(aRoundKeys[kAesRounds])));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aOut), block);
+}
 
-        blockCounter++;
-        prfInput[mSaltLen + 0] = (uint8_t)(blockCounter >> 24);
-        prfInput[mSaltLen + 1] = (uint8_t)(blockCounter >> 16);
-        prfInput[mSaltLen + 2] = (uint8_t)(blockCounter >> 8);
-        prfInput[mSaltLen + 3] = (uint8_t)(blockCounter);
-        // Calculate U_1
-        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                 mSaltLen + 4, prfOutput);
-        memcpy(keyBlock, prfOutput, prfBlockLen);
+__attribute__((target("aes,sse2"))) void AesNiIterate(const RoundKeys &aRoundKeys,
+                                                      const uint8_t *  aK1,
+                                                      uint8_t *        aBlock,
+                                                      uint8_t *        aSum,
+                                                      uint32_t         aCount)
+{
+    __m128i key[kAesRounds + 1];
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBlock));
+    __m128i sum   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aSum));
+    __m128i whitening;
 
-        for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
+    for (int round = 0; round <= kAesRounds; round++)
+    {
+        key[round] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aRoundKeys[round]));
+    }
+
+    // K1 is folded into the first round key as both are xor-ed into the block.
+    whitening = _mm_xor_si128(key[0], _mm_loadu_si128(reinterpret_cast<const __m128i *>(aK1)));
+
+    while (aCount--)
+    {
+        block = _mm_xor_si128(block, whitening);
+        block = _mm_aesenc_si128(block, key[1]);
+        block = _mm_aesenc_si128(block, key[2]);
+        block = _mm_aesenc_si128(block, key[3]);
+        block = _mm_aesenc_si128(block, key[4]);
+        block = _mm_aesenc_si128(block, key[5]);
+        block = _mm_aesenc_si128(block, key[6]);
+        block = _mm_aesenc_si128(block, key[7]);
+        block = _mm_aesenc_si128(block, key[8]);
+        block = _mm_aesenc_si128(block, key[9]);
+        block = _mm_aesenclast_si128(block, key[10]);
+        sum   = _mm_xor_si128(sum, block);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aBlock), block);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aSum), sum);
+}
+
+#endif // OTBR_PSKC_AES_NI
+
+#if OTBR_PSKC_ARM_CRYPTO
+
+void ArmEncrypt(const RoundKeys &aRoundKeys, const uint8_t *aIn, uint8_t *aOut)
+{
+    uint8x16_t block = vld1q_u8(aIn);
+
+    for (int round = 0; round < kAesRounds - 1; round++)
+    {
+        block = vaesmcq_u8(vaeseq_u8(block, vld1q_u8(aRoundKeys[round])));
+    }
+    block = veorq_u8(vaeseq_u8(block, vld1q_u8(aRoundKeys[kAesRounds - 1])), vld1q_u8(aRoundKeys[kAesRounds]));
+
+    vst1q_u8(aOut, block);
+}
+
+void ArmIterate(const RoundKeys &aRoundKeys, const uint8_t *aK1, uint8_t *aBlock, uint8_t *aSum, uint32_t aCount)
+{
+    uint8x16_t key[kAesRounds + 1];
+    uint8x16_t block = vld1q_u8(aBlock);
+    uint8x16_t sum   = vld1q_u8(aSum);
+    uint8x16_t whitening;
+
+    for (int round = 0; round <= kAesRounds; round++)
+    {
+        key[round] = vld1q_u8(aRoundKeys[round]);
+    }
+
+    // K1 is folded into the first round key as AESE xors the key into the block first.
+    whitening = veorq_u8(key[0], vld1q_u8(aK1));
+
+    while (aCount--)
+    {
+        block = vaesmcq_u8(vaeseq_u8(block, whitening));
+        block = vaesmcq_u8(vaeseq_u8(block, key[1]));
+        block = vaesmcq_u8(vaeseq_u8(block, key[2]));
+        block = vaesmcq_u8(vaeseq_u8(block, key[3]));
+        block = vaesmcq_u8(vaeseq_u8(block, key[4]));
+        block = vaesmcq_u8(vaeseq_u8(block, key[5]));
+        block = vaesmcq_u8(vaeseq_u8(block, key[6]));
+        block = vaesmcq_u8(vaeseq_u8(block, key[7]));
+        block = vaesmcq_u8(vaeseq_u8(block, key[8]));
+        block = veorq_u8(vaeseq_u8(block, key[9]), key[10]);
+        sum   = veorq_u8(sum, block);
+    }
+
+    vst1q_u8(aBlock, block);
+    vst1q_u8(aSum, sum);
+}
+
+#endif // OTBR_PSKC_ARM_CRYPTO
+
+Pskc::Engine DetectEngine(void)
+{
+    Pskc::Engine engine = Pskc::kEngineSoftware;
+
+#if OTBR_PSKC_AES_NI
+    if (HasAesNi())
+    {
+        engine = Pskc::kEngineAesNi;
+    }
+#endif
+#if OTBR_PSKC_ARM_CRYPTO
+    engine = Pskc::kEngineArmCrypto;
+#endif
+
+    return engine;
+}
+
+Pskc::Engine sEngine = DetectEngine();
+
+/**
+ * This class implements an AES-128 key kept expanded, along with its CMAC subkeys.
+ *
+ */
+class AesKey
+{
+public:
+    explicit AesKey(Pskc::Engine aEngine)
+        : mEngine(aEngine)
+    {
+        mbedtls_aes_init(&mContext);
+    }
+
+    ~AesKey(void) { mbedtls_aes_free(&mContext); }
+
+    void SetKey(const uint8_t *aKey)
+    {
+        const uint8_t zero[kAesBlockSize] = {0};
+        uint8_t       l[kAesBlockSize];
+
+        if (mEngine == Pskc::kEngineSoftware)
         {
-            memcpy(prfInput, prfOutput, prfBlockLen);
+            mbedtls_aes_setkey_enc(&mContext, aKey, kAesBlockSize * 8);
+        }
+        else
+        {
+            ExpandKey(aKey, mRoundKeys);
+        }
 
-            // Calculate U_i
-            mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                     prfBlockLen, prfOutput);
+        Encrypt(zero, l);
+        DoubleBlock(l, mK1);
+        DoubleBlock(mK1, mK2);
+    }
+
+    void Encrypt(const uint8_t *aIn, uint8_t *aOut)
+    {
+        switch (mEngine)
+        {
+#if OTBR_PSKC_AES_NI
+        case Pskc::kEngineAesNi:
+            AesNiEncrypt(mRoundKeys, aIn, aOut);
+            break;
+#endif
+#if OTBR_PSKC_ARM_CRYPTO
+        case Pskc::kEngineArmCrypto:
+            ArmEncrypt(mRoundKeys, aIn, aOut);
+            break;
+#endif
+        default:
+            mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aIn, aOut);
+            break;
+        }
+    }
 
-            // xor
-            for (uint32_t j = 0; j < prfBlockLen; j++)
+    /**
+     * This method computes AES-CMAC of a message.
+     *
+     */
+    void Cmac(const uint8_t *aMessage, size_t aLength, uint8_t *aMac)
+    {
+        uint8_t block[kAesBlockSize] = {0};
+        size_t  lastLength;
+
+        while (aLength > kAesBlockSize)
+        {
+            XorBlock(block, aMessage);
+            Encrypt(block, block);
+            aMessage += kAesBlockSize;
+            aLength -= kAesBlockSize;
+        }
+
+        lastLength = aLength;
+        for (size_t i = 0; i < lastLength; i++)
+        {
+            block[i] ^= aMessage[i];
+        }
+
+        if (lastLength == kAesBlockSize)
+        {
+            XorBlock(block, mK1);
+        }
+        else
+        {
+            block[lastLength] ^= 0x80;
+            XorBlock(block, mK2);
+        }
+
+        Encrypt(block, aMac);
+    }
+
+    /**
+     * This method runs PBKDF2 iterations, each of them replacing @p aBlock with its CMAC and xor-ing it into @p aSum.
+     *
+     */
+    void Iterate(uint8_t *aBlock, uint8_t *aSum, uint32_t aCount)
+    {
+        switch (mEngine)
+        {
+#if OTBR_PSKC_AES_NI
+        case Pskc::kEngineAesNi:
+            AesNiIterate(mRoundKeys, mK1, aBlock, aSum, aCount);
+            break;
+#endif
+#if OTBR_PSKC_ARM_CRYPTO
+        case Pskc::kEngineArmCrypto:
+            ArmIterate(mRoundKeys, mK1, aBlock, aSum, aCount);
+            break;
+#endif
+        default:
+            while (aCount--)
             {
-                keyBlock[j] ^= prfOutput[j];
+                XorBlock(aBlock, mK1);
+                mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aBlock, aBlock);
+                XorBlock(aSum, aBlock);
             }
+            break;
         }
+    }
+
+private:
+    Pskc::Engine        mEngine;
+    RoundKeys           mRoundKeys;
+    mbedtls_aes_context mContext;
+    uint8_t             mK1[kAesBlockSize];
+    uint8_t             mK2[kAesBlockSize];
+};
 
-        useLen = (keyLen < prfBlockLen) ? keyLen : prfBlockLen;
-        memcpy(pskc, keyBlock, useLen);
-        pskc += useLen;
-        keyLen -= useLen;
+void BatchWorker(const PskcInput *aInputs, size_t aCount, uint8_t *aPskcs, std::atomic<size_t> *aNext)
+{
+    for (size_t i = (*aNext)++; i < aCount; i = (*aNext)++)
+    {
+        Pskc::ComputePskc(aInputs[i].mExtPanId, aInputs[i].mNetworkName, aInputs[i].mPassphrase,
+                          aPskcs + i * OT_PSKC_LENGTH);
     }
+}
+
+} // namespace
+
+const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
+{
+    ComputePskc(aExtPanId, aNetworkName, aPassphrase, mPskc);
     return mPskc;
 }
 
+void Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase, uint8_t *aPskc)
+{
+    uint8_t prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t block[kAesBlockSize];
+    size_t  saltLen        = 0;
+    size_t  networkNameLen = strlen(aNetworkName);
+    size_t  passphraseLen  = strlen(aPassphrase);
+    AesKey  key(sEngine);
+
+    if (networkNameLen == 0)
+    {
+        otbrLog(OTBR_LOG_ERR, "ExtPanId or NetworkName is NULL");
+    }
+    else if (networkNameLen > kNetworkNameMaxLen)
+    {
+        networkNameLen = kNetworkNameMaxLen;
+    }
+
+    // Salt is "Thread" | Extended PAN ID | Network Name, followed by the block counter 1.
+    memcpy(prfInput, kSaltPrefix, sizeof(kSaltPrefix) - 1);
+    saltLen += sizeof(kSaltPrefix) - 1;
+    memcpy(prfInput + saltLen, aExtPanId, OT_EXTENDED_PAN_ID_LENGTH);
+    saltLen += OT_EXTENDED_PAN_ID_LENGTH;
+    memcpy(prfInput + saltLen, aNetworkName, networkNameLen);
+    saltLen += networkNameLen;
+
+    prfInput[saltLen++] = 0;
+    prfInput[saltLen++] = 0;
+    prfInput[saltLen++] = 0;
+    prfInput[saltLen++] = 1;
+
+    // AES-CMAC-PRF-128 uses a passphrase of any other length than 16 bytes through its CMAC under a zero key.
+    if (passphraseLen == kAesBlockSize)
+    {
+        key.SetKey(reinterpret_cast<const uint8_t *>(aPassphrase));
+    }
+    else
+    {
+        const uint8_t zero[kAesBlockSize] = {0};
+
+        key.SetKey(zero);
+        key.Cmac(reinterpret_cast<const uint8_t *>(aPassphrase), passphraseLen, block);
+        key.SetKey(block);
+    }
+
+    // Calculate U_1, then U_2 to U_c xor-ed into the PSKc.
+    key.Cmac(prfInput, saltLen, block);
+    memcpy(aPskc, block, OT_PSKC_LENGTH);
+    key.Iterate(block, aPskc, OT_ITERATION_COUNTS - 1);
+}
+
+void Pskc::ComputePskcBatch(const PskcInput *aInputs, size_t aCount, uint8_t *aPskcs, unsigned int aNumThreads)
+{
+    std::atomic<size_t>      next(0);
+    std::vector<std::thread> workers;
+
+    if (aNumThreads == 0)
+    {
+        aNumThreads = std::thread::hardware_concurrency();
+    }
+
+    if (aNumThreads > aCount)
+    {
+        aNumThreads = static_cast<unsigned int>(aCount);
+    }
+
+    // The calling thread is one of the workers.
+    for (unsigned int i = 1; i < aNumThreads; i++)
+    {
+        workers.push_back(std::thread(BatchWorker, aInputs, aCount, aPskcs, &next));
+    }
+
+    BatchWorker(aInputs, aCount, aPskcs, &next);
+
+    for (size_t i = 0; i < workers.size(); i++)
+    {
+        workers[i].join();
+    }
+}
+
+Pskc::Engine Pskc::GetEngine(void)
+{
+    return sEngine;
+}
+
+bool Pskc::SetEngine(Engine aEngine)
+{
+    bool supported = IsEngineSupported(aEngine);
+
+    if (supported)
+    {
+        sEngine = aEngine;
+    }
+
+    return supported;
+}
+
+bool Pskc::IsEngineSupported(Engine aEngine)
+{
+    bool supported = false;
+
+    switch (aEngine)
+    {
+    case kEngineSoftware:
+        supported = true;
+        break;
+    case kEngineAesNi:
+#if OTBR_PSKC_AES_NI
+        supported = HasAesNi();
+#endif
+        break;
+    case kEngineArmCrypto:
+        supported = OTBR_PSKC_ARM_CRYPTO;
+        break;
+    }
+
+    return supported;
+}
+
+const char *Pskc::GetEngineName(Engine aEngine)
+{
+    const char *name = "unknown";
+
+    switch (aEngine)
+    {
+    case kEngineSoftware:
+        name = "software";
+        break;
+    case kEngineAesNi:
+        name = "aes-ni";
+        break;
+    case kEngineArmCrypto:
+        name = "armv8-crypto";
+        break;
+    }
+
+    return name;
+}
+
 } // namespace Psk
 } // namespace otbr
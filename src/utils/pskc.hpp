@@ -42,6 +42,7 @@
 #define OT_PBKDF2_SALT_MAX_LENGTH 30
 #define OT_PSKC_LENGTH 16
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -56,9 +57,31 @@ enum
     kPskcStatus_InvalidArgument = 1
 };
 
+/**
+ * This structure describes the inputs of one PSKc computation.
+ *
+ */
+struct PskcInput
+{
+    const uint8_t *mExtPanId;    ///< Extended PAN ID, OT_EXTENDED_PAN_ID_LENGTH bytes.
+    const char *   mNetworkName; ///< Network name.
+    const char *   mPassphrase;  ///< Commissioner passphrase.
+};
+
 class Pskc
 {
 public:
+    /**
+     * AES engines able to run the PBKDF2 iterations.
+     *
+     */
+    enum Engine
+    {
+        kEngineSoftware  = 0, ///< mbedtls AES, available on every platform.
+        kEngineAesNi     = 1, ///< x86 AES-NI instructions.
+        kEngineArmCrypto = 2, ///< ARMv8 Cryptography Extension instructions.
+    };
+
     /**
      * This method computes the PSKc.
      *
@@ -71,12 +94,79 @@ public:
      */
     const uint8_t *ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase);
 
-private:
-    void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
+    /**
+     * This method computes the PSKc into a caller provided buffer.
+     *
+     * It keeps no state and may be called from several threads at the same time.
+     *
+     * @param[in]   aExtPanId      A pointer to extended PAN ID.
+     * @param[in]   aNetworkName   A pointer to network name.
+     * @param[in]   aPassphrase    A pointer to passphrase.
+     * @param[out]  aPskc          A pointer to where to write the PSKc.
+     *
+     */
+    static void ComputePskc(const uint8_t *aExtPanId,
+                            const char *   aNetworkName,
+                            const char *   aPassphrase,
+                            uint8_t *      aPskc);
+
+    /**
+     * This method computes many PSKcs in parallel threads.
+     *
+     * @param[in]   aInputs        A pointer to the inputs.
+     * @param[in]   aCount         Number of inputs.
+     * @param[out]  aPskcs         A pointer to @p aCount * OT_PSKC_LENGTH bytes, receiving the PSKcs in input order.
+     * @param[in]   aNumThreads    Max number of threads, 0 to use one per hardware thread.
+     *
+     */
+    static void ComputePskcBatch(const PskcInput *aInputs,
+                                 size_t           aCount,
+                                 uint8_t *        aPskcs,
+                                 unsigned int     aNumThreads = 0);
+
+    /**
+     * This method returns the engine used to compute PSKcs.
+     *
+     * The fastest engine supported by the running CPU is selected by default.
+     *
+     * @returns The engine in use.
+     *
+     */
+    static Engine GetEngine(void);
+
+    /**
+     * This method selects the engine used to compute PSKcs.
+     *
+     * @param[in]  aEngine     The engine to use.
+     *
+     * @retval true   The engine is selected.
+     * @retval false  The engine is not supported by this build or this CPU.
+     *
+     */
+    static bool SetEngine(Engine aEngine);
 
-    char     mSalt[OT_PBKDF2_SALT_MAX_LENGTH];
-    uint16_t mSaltLen;
-    uint8_t  mPskc[OT_PSKC_LENGTH];
+    /**
+     * This method tells whether an engine is supported by this build and this CPU.
+     *
+     * @param[in]  aEngine     The engine.
+     *
+     * @returns Whether @p aEngine is supported.
+     *
+     */
+    static bool IsEngineSupported(Engine aEngine);
+
+    /**
+     * This method returns the name of an engine.
+     *
+     * @param[in]  aEngine     The engine.
+     *
+     * @returns The name of @p aEngine.
+     *
+     */
+    static const char *GetEngineName(Engine aEngine);
+
+private:
+    uint8_t mPskc[OT_PSKC_LENGTH];
 };
 
 } // namespace Psk
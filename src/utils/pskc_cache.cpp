@@ -0,0 +1,325 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a cache of computed PSKcs.
+ */
+
+#include "utils/pskc_cache.hpp"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <mbedtls/entropy.h>
+#include <mbedtls/md.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Psk {
+
+namespace {
+
+const char kFileMagic[] = "OTBRPKC2";
+
+} // namespace
+
+PskcCache::PskcCache(size_t aCapacity)
+    : mCapacity(aCapacity > 0 ? aCapacity : 1)
+    , mHitCount(0)
+    , mMissCount(0)
+{
+    GenerateSalt();
+}
+
+void PskcCache::GenerateSalt(void)
+{
+    mbedtls_entropy_context entropy;
+
+    mbedtls_entropy_init(&entropy);
+    if (mbedtls_entropy_func(&entropy, mSalt, sizeof(mSalt)) != 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to generate PSKc cache salt");
+        memset(mSalt, 0, sizeof(mSalt));
+    }
+    mbedtls_entropy_free(&entropy);
+}
+
+int PskcCache::ComputeKey(const uint8_t *aExtPanId,
+                          const char *   aNetworkName,
+                          const char *   aPassphrase,
+                          uint8_t *      aKey) const
+{
+    mbedtls_md_context_t hmac;
+    uint8_t              nameLength = static_cast<uint8_t>(strnlen(aNetworkName, UINT8_MAX));
+    int                  ret;
+
+    // The network name is length prefixed so that no two inputs are hashed alike.
+    mbedtls_md_init(&hmac);
+    SuccessOrExit(ret = mbedtls_md_setup(&hmac, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 1));
+    SuccessOrExit(ret = mbedtls_md_hmac_starts(&hmac, mSalt, sizeof(mSalt)));
+    SuccessOrExit(ret = mbedtls_md_hmac_update(&hmac, aExtPanId, OT_EXTENDED_PAN_ID_LENGTH));
+    SuccessOrExit(ret = mbedtls_md_hmac_update(&hmac, &nameLength, sizeof(nameLength)));
+    SuccessOrExit(ret = mbedtls_md_hmac_update(&hmac, reinterpret_cast<const uint8_t *>(aNetworkName), nameLength));
+    SuccessOrExit(ret = mbedtls_md_hmac_update(&hmac, reinterpret_cast<const uint8_t *>(aPassphrase),
+                                               strlen(aPassphrase)));
+    ret = mbedtls_md_hmac_finish(&hmac, aKey);
+
+exit:
+    mbedtls_md_free(&hmac);
+    return ret;
+}
+
+void PskcCache::ComputePskc(const uint8_t *aExtPanId,
+                            const char *   aNetworkName,
+                            const char *   aPassphrase,
+                            uint8_t *      aPskc)
+{
+    Entry entry;
+    bool  keyed;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // The key is computed locked, as Load() may replace the salt.
+        keyed = (ComputeKey(aExtPanId, aNetworkName, aPassphrase, entry.mKey) == 0);
+
+        if (keyed)
+        {
+            EntryMap::iterator it = mIndex.find(std::string(reinterpret_cast<char *>(entry.mKey), kSizeKey));
+
+            if (it != mIndex.end())
+            {
+                mEntries.splice(mEntries.begin(), mEntries, it->second);
+                memcpy(aPskc, it->second->mPskc, OT_PSKC_LENGTH);
+                ++mHitCount;
+                ExitNow();
+            }
+        }
+
+        ++mMissCount;
+    }
+
+    // The derivation runs unlocked so that other PSKcs can be looked up meanwhile.
+    Pskc::ComputePskc(aExtPanId, aNetworkName, aPassphrase, entry.mPskc);
+    memcpy(aPskc, entry.mPskc, OT_PSKC_LENGTH);
+
+    VerifyOrExit(keyed, otbrLog(OTBR_LOG_WARNING, "Failed to compute PSKc cache key"));
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        Insert(entry);
+        SaveLocked();
+    }
+
+exit:
+    return;
+}
+
+void PskcCache::Insert(const Entry &aEntry)
+{
+    std::string        key(reinterpret_cast<const char *>(aEntry.mKey), kSizeKey);
+    EntryMap::iterator it = mIndex.find(key);
+
+    if (it != mIndex.end())
+    {
+        mEntries.erase(it->second);
+        mIndex.erase(it);
+    }
+
+    mEntries.push_front(aEntry);
+    mIndex[key] = mEntries.begin();
+
+    while (mEntries.size() > mCapacity)
+    {
+        mIndex.erase(std::string(reinterpret_cast<const char *>(mEntries.back().mKey), kSizeKey));
+        mEntries.pop_back();
+    }
+}
+
+otbrError PskcCache::Load(const char *aPath)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    otbrError                   error = OTBR_ERROR_ERRNO;
+    FILE *                      file  = NULL;
+    char                        magic[sizeof(kFileMagic) - 1];
+    uint8_t                     salt[kSizeSalt];
+    Entry                       entry;
+    EntryList                   entries;
+    struct stat                 st;
+
+    mPath = aPath;
+
+    file = fopen(aPath, "rb");
+    if (file == NULL && errno == ENOENT)
+    {
+        ExitNow(error = OTBR_ERROR_NONE);
+    }
+    VerifyOrExit(file != NULL);
+
+    VerifyOrExit(fstat(fileno(file), &st) == 0);
+    VerifyOrExit(st.st_uid == geteuid() && (st.st_mode & (S_IRWXG | S_IRWXO)) == 0, errno = EPERM);
+
+    VerifyOrExit(fread(magic, sizeof(magic), 1, file) == 1 && memcmp(magic, kFileMagic, sizeof(magic)) == 0,
+                 errno = EINVAL);
+    VerifyOrExit(fread(salt, sizeof(salt), 1, file) == 1, errno = EINVAL);
+
+    while (fread(&entry, sizeof(entry), 1, file) == 1)
+    {
+        entries.push_back(entry);
+    }
+    VerifyOrExit(!ferror(file));
+    VerifyOrExit(ftell(file) == static_cast<long>(sizeof(magic) + sizeof(salt) + sizeof(entry) * entries.size()),
+                 errno = EINVAL);
+
+    // PSKcs cached so far are keyed with another salt, so the ones of the file replace them.
+    memcpy(mSalt, salt, sizeof(mSalt));
+    mEntries.clear();
+    mIndex.clear();
+
+    // Entries are saved most recently used first, so inserting them backwards restores the order.
+    for (EntryList::reverse_iterator it = entries.rbegin(); it != entries.rend(); ++it)
+    {
+        Insert(*it);
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        // A rejected file is never overwritten, as it may not be a PSKc cache at all.
+        otbrLog(OTBR_LOG_WARNING, "Failed to load PSKc cache %s: %s", aPath, strerror(errno));
+        mPath.clear();
+    }
+
+    return error;
+}
+
+otbrError PskcCache::Save(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return SaveLocked();
+}
+
+otbrError PskcCache::SaveLocked(void)
+{
+    otbrError   error = OTBR_ERROR_ERRNO;
+    std::string tmpPath;
+    int         fd = -1;
+    FILE *      file;
+
+    VerifyOrExit(!mPath.empty(), error = OTBR_ERROR_NONE);
+
+    // The file is written aside and renamed, so that a crash never leaves a truncated cache. The temporary file is
+    // created exclusively with a random name, only accessible by its owner, so that nothing planted can be followed.
+    tmpPath = mPath + ".XXXXXX";
+    fd      = mkstemp(&tmpPath[0]);
+    VerifyOrExit(fd != -1, tmpPath.clear());
+
+    file = fdopen(fd, "wb");
+    VerifyOrExit(file != NULL);
+    fd = -1;
+
+    fwrite(kFileMagic, sizeof(kFileMagic) - 1, 1, file);
+    fwrite(mSalt, sizeof(mSalt), 1, file);
+    for (EntryList::const_iterator it = mEntries.begin(); it != mEntries.end(); ++it)
+    {
+        fwrite(&*it, sizeof(*it), 1, file);
+    }
+
+    VerifyOrExit(fclose(file) == 0);
+    VerifyOrExit(rename(tmpPath.c_str(), mPath.c_str()) == 0);
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (fd != -1)
+    {
+        close(fd);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to save PSKc cache %s: %s", mPath.c_str(), strerror(errno));
+
+        if (!tmpPath.empty())
+        {
+            unlink(tmpPath.c_str());
+        }
+    }
+
+    return error;
+}
+
+void PskcCache::Clear(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mEntries.clear();
+    mIndex.clear();
+    mHitCount  = 0;
+    mMissCount = 0;
+}
+
+size_t PskcCache::GetSize(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mEntries.size();
+}
+
+unsigned long PskcCache::GetHitCount(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mHitCount;
+}
+
+unsigned long PskcCache::GetMissCount(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mMissCount;
+}
+
+} // namespace Psk
+} // namespace otbr
@@ -0,0 +1,173 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file provides a cache of computed PSKcs.
+ */
+
+#ifndef OTBR_UTILS_PSKC_CACHE_HPP_
+#define OTBR_UTILS_PSKC_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/types.hpp"
+#include "utils/pskc.hpp"
+
+namespace otbr {
+namespace Psk {
+
+/**
+ * This class implements a bounded LRU cache of PSKcs, optionally persisted to a file.
+ *
+ * Entries are keyed by an HMAC-SHA-256 of the passphrase, network name and extended PAN ID, so that none of them is
+ * kept in memory or on disk. The HMAC key is a random salt saved with the file, so that keys cannot be precomputed.
+ * The file is only readable by its owner, and is refused if anyone else can access it.
+ * All methods may be called from several threads at the same time.
+ *
+ */
+class PskcCache
+{
+public:
+    enum
+    {
+        kDefaultCapacity = 32, ///< Default max number of PSKcs.
+    };
+
+    /**
+     * The constructor of a PSKc cache.
+     *
+     * @param[in]  aCapacity   Max number of PSKcs kept, the least recently used one is dropped beyond.
+     *
+     */
+    explicit PskcCache(size_t aCapacity = kDefaultCapacity);
+
+    /**
+     * This method returns the PSKc, only computing it if it is not cached.
+     *
+     * A computed PSKc is saved to the file given to Load(), if any.
+     *
+     * @param[in]   aExtPanId      A pointer to extended PAN ID.
+     * @param[in]   aNetworkName   A pointer to network name.
+     * @param[in]   aPassphrase    A pointer to passphrase.
+     * @param[out]  aPskc          A pointer to where to write the PSKc.
+     *
+     */
+    void ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase, uint8_t *aPskc);
+
+    /**
+     * This method loads the PSKcs saved in a file, and saves computed PSKcs to this file from now on.
+     *
+     * A file that does not exist yet is not an error. PSKcs cached before are replaced by the ones of the file. A file
+     * that is refused is never overwritten, PSKcs are no longer saved then.
+     *
+     * @param[in]  aPath    Path of the file.
+     *
+     * @retval OTBR_ERROR_NONE      Successfully loaded the file.
+     * @retval OTBR_ERROR_ERRNO     Failed to read the file, its format is invalid or others can access it.
+     *
+     */
+    otbrError Load(const char *aPath);
+
+    /**
+     * This method saves the PSKcs to the file given to Load().
+     *
+     * @retval OTBR_ERROR_NONE      Successfully saved the file, or there is no file.
+     * @retval OTBR_ERROR_ERRNO     Failed to write the file.
+     *
+     */
+    otbrError Save(void);
+
+    /**
+     * This method drops all PSKcs and resets the counters.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of cached PSKcs.
+     *
+     */
+    size_t GetSize(void) const;
+
+    /**
+     * This method returns the number of PSKcs found in the cache.
+     *
+     */
+    unsigned long GetHitCount(void) const;
+
+    /**
+     * This method returns the number of PSKcs computed as they were not in the cache.
+     *
+     */
+    unsigned long GetMissCount(void) const;
+
+private:
+    enum
+    {
+        kSizeKey  = 32, ///< Size of the HMAC-SHA-256 key of an entry.
+        kSizeSalt = 16, ///< Size of the salt of the HMAC.
+    };
+
+    struct Entry
+    {
+        uint8_t mKey[kSizeKey];
+        uint8_t mPskc[OT_PSKC_LENGTH];
+    };
+
+    typedef std::list<Entry>                           EntryList;
+    typedef std::map<std::string, EntryList::iterator> EntryMap;
+
+    void GenerateSalt(void);
+    int  ComputeKey(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase, uint8_t *aKey) const;
+
+    void      Insert(const Entry &aEntry);
+    otbrError SaveLocked(void);
+
+    mutable std::mutex mMutex;
+    size_t             mCapacity;
+    uint8_t            mSalt[kSizeSalt];
+    EntryList          mEntries; ///< Most recently used first.
+    EntryMap           mIndex;
+    std::string        mPath;
+    unsigned long      mHitCount;
+    unsigned long      mMissCount;
+};
+
+} // namespace Psk
+} // namespace otbr
+
+#endif // OTBR_UTILS_PSKC_CACHE_HPP_
@@ -45,6 +45,11 @@ void SteeringData::Init(uint8_t aLength)
 }
 
 void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
+{
+    ComputeJoinerIds(aEui64, 1, aJoinerId);
+}
+
+void SteeringData::ComputeJoinerIds(const uint8_t *aEui64s, size_t aCount, uint8_t *aJoinerIds)
 {
     const size_t           kSizeHashSha256Output = 32;
     const size_t           kSizeEui64            = 8;
@@ -52,29 +57,79 @@ void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
     mbedtls_sha256_context sha256;
 
     mbedtls_sha256_init(&sha256);
-    mbedtls_sha256_starts(&sha256, 0);
-    mbedtls_sha256_update(&sha256, aEui64, kSizeEui64);
-    mbedtls_sha256_finish(&sha256, hash);
 
-    memcpy(aJoinerId, hash, kSizeJoinerId);
-    aJoinerId[0] |= 2;
+    for (size_t i = 0; i < aCount; i++)
+    {
+        mbedtls_sha256_starts(&sha256, 0);
+        mbedtls_sha256_update(&sha256, aEui64s + i * kSizeEui64, kSizeEui64);
+        mbedtls_sha256_finish(&sha256, hash);
+
+        memcpy(aJoinerIds + i * kSizeJoinerId, hash, kSizeJoinerId);
+        aJoinerIds[i * kSizeJoinerId] |= 2;
+    }
+
+    mbedtls_sha256_free(&sha256);
 }
 
-void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
+void SteeringData::ComputeBits(const uint8_t *aJoinerId, uint8_t &aCcittBit, uint8_t &aAnsiBit) const
 {
     Crc16          ccitt(Crc16::kCcitt);
     Crc16          ansi(Crc16::kAnsi);
     const uint16_t numBits = mLength * 8;
 
-    for (size_t i = 0; i < kSizeJoinerId; i++)
+    ccitt.Update(aJoinerId, kSizeJoinerId);
+    ansi.Update(aJoinerId, kSizeJoinerId);
+
+    aCcittBit = static_cast<uint8_t>(ccitt.Get() % numBits);
+    aAnsiBit  = static_cast<uint8_t>(ansi.Get() % numBits);
+}
+
+void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
+{
+    uint8_t ccittBit;
+    uint8_t ansiBit;
+
+    ComputeBits(aJoinerId, ccittBit, ansiBit);
+    SetBit(ccittBit);
+    SetBit(ansiBit);
+}
+
+void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerIds, size_t aCount)
+{
+    for (size_t i = 0; i < aCount; i++)
     {
-        uint8_t byte = aJoinerId[i];
-        ccitt.Update(byte);
-        ansi.Update(byte);
+        ComputeBloomFilter(aJoinerIds + i * kSizeJoinerId);
     }
+}
+
+void SteeringData::AddJoiner(const uint8_t *aJoinerId)
+{
+    uint8_t bits[2];
 
-    SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
-    SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
+    ComputeBits(aJoinerId, bits[0], bits[1]);
+
+    for (size_t i = 0; i < sizeof(bits); i++)
+    {
+        mBitCounts[bits[i]]++;
+        SetBit(bits[i]);
+    }
+}
+
+void SteeringData::RemoveJoiner(const uint8_t *aJoinerId)
+{
+    uint8_t bits[2];
+
+    ComputeBits(aJoinerId, bits[0], bits[1]);
+
+    for (size_t i = 0; i < sizeof(bits); i++)
+    {
+        assert(mBitCounts[bits[i]] > 0);
+
+        if (--mBitCounts[bits[i]] == 0)
+        {
+            ClearBit(bits[i]);
+        }
+    }
 }
 
 } // namespace otbr
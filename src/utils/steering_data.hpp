@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -63,10 +64,14 @@ public:
     void Init(uint8_t aLength);
 
     /**
-     * This method sets all bits in the bloom filter to zero.
+     * This method sets all bits in the bloom filter to zero, and forgets all joiners added by AddJoiner().
      *
      */
-    void Clear(void) { memset(mBloomFilter, 0, sizeof(mBloomFilter)); }
+    void Clear(void)
+    {
+        memset(mBloomFilter, 0, sizeof(mBloomFilter));
+        memset(mBitCounts, 0, sizeof(mBitCounts));
+    }
 
     /**
      * Ths method sets all bits in the bloom filter to one.
@@ -90,6 +95,15 @@ public:
      */
     void ComputeBloomFilter(const uint8_t *aJoinerId);
 
+    /**
+     * This method computes the Bloom Filter of many joiners.
+     *
+     * @param[in]  aJoinerIds  A pointer to @p aCount joiner ids, one after another.
+     * @param[in]  aCount      Number of joiner ids.
+     *
+     */
+    void ComputeBloomFilter(const uint8_t *aJoinerIds, size_t aCount);
+
     /**
      * This method computes joiner id from EUI64.
      *
@@ -99,6 +113,34 @@ public:
      */
     static void ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId);
 
+    /**
+     * This method computes joiner ids from many EUI64s, reusing one SHA-256 context.
+     *
+     * @param[in]   aEui64s      A pointer to @p aCount EUI64s, one after another.
+     * @param[in]   aCount       Number of EUI64s.
+     * @param[out]  aJoinerIds   A pointer to receive @p aCount joiner ids. This pointer can be the same as @p aEui64s.
+     *
+     */
+    static void ComputeJoinerIds(const uint8_t *aEui64s, size_t aCount, uint8_t *aJoinerIds);
+
+    /**
+     * This method adds a joiner to the bloom filter without rebuilding it.
+     *
+     * @param[in]  aJoinerId  The joiner id.
+     *
+     */
+    void AddJoiner(const uint8_t *aJoinerId);
+
+    /**
+     * This method removes a joiner previously added by AddJoiner() without rebuilding the bloom filter.
+     *
+     * Bits shared with other joiners stay set.
+     *
+     * @param[in]  aJoinerId  The joiner id.
+     *
+     */
+    void RemoveJoiner(const uint8_t *aJoinerId);
+
     /**
      * This method returns a pointer to the bloom filter.
      *
@@ -114,8 +156,12 @@ public:
     uint8_t GetLength(void) const { return mLength; }
 
 private:
-    uint8_t mBloomFilter[kMaxSizeOfBloomFilter];
-    uint8_t mLength;
+    void ComputeBits(const uint8_t *aJoinerId, uint8_t &aCcittBit, uint8_t &aAnsiBit) const;
+    void ClearBit(uint8_t aBit) { mBloomFilter[mLength - 1 - (aBit / 8)] &= static_cast<uint8_t>(~(1 << (aBit % 8))); }
+
+    uint8_t  mBloomFilter[kMaxSizeOfBloomFilter];
+    uint8_t  mLength;
+    uint16_t mBitCounts[kMaxSizeOfBloomFilter * 8]; ///< Number of joiners added on each bit.
 };
 
 } /* namespace otbr */
@@ -32,6 +32,8 @@
  */
 #define OT_HTTP_PORT 80
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "openthread-br/config.h"
 
 #include <errno.h>
@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "web/web-service/ot_client.hpp"
 
 #include <openthread/platform/toolchain.h>
@@ -31,6 +31,8 @@
  *   This file implements the web server of border router
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "web/web-service/web_server.hpp"
 
 #define BOOST_NO_CXX11_SCOPED_ENUMS
@@ -31,12 +31,15 @@
  *   This file implements the wpan controller service
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "web/web-service/wpan_service.hpp"
 
 #include <byteswap.h>
 #include <inttypes.h>
 
 #include "common/code_utils.hpp"
+#include "common/format.hpp"
 #include "web/web-service/ot_client.hpp"
 
 namespace otbr {
@@ -126,7 +129,7 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     Json::FastWriter jsonWriter;
     Json::Reader     reader;
     std::string      response;
-    otbr::Psk::Pskc  psk;
+    uint8_t          pskc[OT_PSKC_MAX_LENGTH];
     char             pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
     uint8_t          extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
     std::string      networkKey;
@@ -158,8 +161,8 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     defaultRoute = root["defaultRoute"].asBool();
 
     otbr::Utils::Hex2Bytes(extPanId.c_str(), extPanIdBytes, OT_EXTENDED_PANID_LENGTH);
-    otbr::Utils::Bytes2Hex(psk.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str()), OT_PSKC_MAX_LENGTH,
-                           pskcStr);
+    mPskcCache.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str(), pskc);
+    otbr::Utils::Bytes2Hex(pskc, OT_PSKC_MAX_LENGTH, pskcStr);
 
 #if OTBR_ENABLE_NCP_WPANTUND
     wpanController.SetInterfaceName(mIfName);
@@ -506,7 +509,9 @@ std::string WpanService::HandleAvailableNetworkRequest()
             hardwareAddress[OT_HARDWARE_ADDRESS_LENGTH * 2 + 1];
         otbr::Utils::Long2Hex(bswap_64(mNetworks[i].mExtPanId), extPanId);
         otbr::Utils::Bytes2Hex(mNetworks[i].mHardwareAddress, OT_HARDWARE_ADDRESS_LENGTH, hardwareAddress);
-        sprintf(panId, "0x%X", mNetworks[i].mPanId);
+        otbr::Format::StringBuilder(panId, sizeof(panId))
+            .Append("0x")
+            .AppendHex(mNetworks[i].mPanId, 0, otbr::Format::kUpperCase);
         networkInfo[i]["nn"] = mNetworks[i].mNetworkName;
         networkInfo[i]["xp"] = extPanId;
         networkInfo[i]["pi"] = panId;
@@ -640,12 +645,11 @@ std::string WpanService::CommissionDevice(const char *aPskd, const char *aNetwor
     args.mPSKd = aPskd;
 
     {
-        otbr::Psk::Pskc pskc;
-        uint8_t         extPanIdHex[kXPanIdLength];
+        uint8_t extPanIdHex[kXPanIdLength];
         VerifyOrExit(sizeof(extPanIdHex) == Utils::Hex2Bytes(extPanId.c_str(), extPanIdHex, sizeof(extPanIdHex)),
                      ret = Dbus::kWpantundStatus_Failure);
 
-        memcpy(args.mPSKc, pskc.ComputePskc(extPanIdHex, networkName.c_str(), aNetworkPassword), sizeof(args.mPSKc));
+        mPskcCache.ComputePskc(extPanIdHex, networkName.c_str(), aNetworkPassword, args.mPSKc);
     }
 
     // We allow all joiners for simplicity
@@ -655,8 +659,10 @@ std::string WpanService::CommissionDevice(const char *aPskd, const char *aNetwor
         args.mSteeringData.Set();
     }
 
-    args.mKeepAliveInterval = 15;
-    args.mDebugLevel        = OTBR_LOG_EMERG;
+    args.mKeepAliveInterval    = 15;
+    args.mMaxJoinerSessions    = kJoinerSessionMaxDefault;
+    args.mJoinerSessionTimeout = kJoinerSessionTimeoutDefault;
+    args.mDebugLevel           = OTBR_LOG_EMERG;
 
     args.mAgentHost = kBorderAgentHost;
     args.mAgentPort = kBorderAgentPort;
@@ -671,22 +677,12 @@ exit:
 
 int WpanService::RunCommission(CommissionerArgs aArgs)
 {
-    Commissioner commissioner(aArgs.mPSKc, aArgs.mKeepAliveInterval);
+    Commissioner commissioner(aArgs.mPSKc, aArgs.mKeepAliveInterval, aArgs.mMaxJoinerSessions,
+                              aArgs.mJoinerSessionTimeout);
     bool         joinerSetDone = false;
-    int          ret;
 
     commissioner.InitDtls(aArgs.mAgentHost, aArgs.mAgentPort);
 
-    do
-    {
-        ret = commissioner.TryDtlsHandshake();
-    } while (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE);
-
-    if (commissioner.IsValid())
-    {
-        commissioner.CommissionerPetition();
-    }
-
     while (commissioner.IsValid() && commissioner.GetNumFinalizedJoiners() == 0)
     {
         int            maxFd   = -1;
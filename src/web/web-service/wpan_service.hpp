@@ -49,6 +49,7 @@
 #include "common/logging.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
+#include "utils/pskc_cache.hpp"
 #include "utils/strcpy_utils.hpp"
 #include "web/wpan-controller/wpan_controller.hpp"
 
@@ -183,6 +184,7 @@ private:
     char                        mIfName[IFNAMSIZ];
     std::string                 mNetworkName;
     std::string                 mExtPanId;
+    otbr::Psk::PskcCache        mPskcCache; ///< Repeated requests of the same network skip the PSKc derivation.
     const char *                mResponseSuccess = "successful";
     const char *                mResponseFail    = "failed";
     const char *                mServiceUp       = "up";
@@ -31,6 +31,8 @@
  *   This file implements the function of "form" a new Thread Network.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "web/wpan-controller/dbus_form.hpp"
 
 #include "common/code_utils.hpp"
@@ -31,6 +31,8 @@
  *   This file implements the function of "configure gateway" function.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "web/wpan-controller/dbus_gateway.hpp"
 
 #include "common/code_utils.hpp"
@@ -31,14 +31,17 @@
  *   This file implements the function of "get property"
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "web/wpan-controller/dbus_get.hpp"
 #include "common/code_utils.hpp"
+#include "common/format.hpp"
 #include "utils/strcpy_utils.hpp"
 
 namespace otbr {
 namespace Dbus {
 
-static void DumpInfoFromIter(char *aOutput, DBusMessageIter *aIter, int aIndent, bool aBare)
+static void DumpInfoFromIter(Format::StringBuilder &aOutput, DBusMessageIter *aIter, int aIndent, bool aBare)
 {
     DBusMessageIter subIter;
 
@@ -55,12 +58,12 @@ static void DumpInfoFromIter(char *aOutput, DBusMessageIter *aIter, int aIndent,
         if (dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_BYTE ||
             dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_INVALID)
         {
-            strcat(aOutput, "[");
+            aOutput.AppendChar('[');
             aIndent = 0;
         }
         else
         {
-            strcat(aOutput, "[");
+            aOutput.AppendChar('[');
         }
 
         for (; dbus_message_iter_get_arg_type(&subIter) != DBUS_TYPE_INVALID; dbus_message_iter_next(&subIter))
@@ -70,9 +73,9 @@ static void DumpInfoFromIter(char *aOutput, DBusMessageIter *aIter, int aIndent,
         }
         for (int i = 0; i < aIndent; i++)
         {
-            strcat(aOutput, "\t");
+            aOutput.AppendChar('\t');
         }
-        strcat(aOutput, "]");
+        aOutput.AppendChar(']');
         break;
     case DBUS_TYPE_VARIANT:
         dbus_message_iter_recurse(aIter, &subIter);
@@ -82,79 +85,63 @@ static void DumpInfoFromIter(char *aOutput, DBusMessageIter *aIter, int aIndent,
     {
         const char *string;
         dbus_message_iter_get_basic(aIter, &string);
-        strcat(aOutput, string);
+        aOutput.Append(string);
         break;
     }
 
     case DBUS_TYPE_BYTE:
     {
         uint8_t v;
-        char    temp[3];
         dbus_message_iter_get_basic(aIter, &v);
-        snprintf(temp, 3, "%02X", v);
-        strcat(aOutput, temp);
+        aOutput.AppendHex(v, 2, Format::kUpperCase);
         break;
     }
     case DBUS_TYPE_UINT16:
     {
         uint16_t v;
-        char     temp[9];
         dbus_message_iter_get_basic(aIter, &v);
-        snprintf(temp, 9, "0x%04X", v);
-        strcat(aOutput, temp);
+        aOutput.Append("0x").AppendHex(v, 4, Format::kUpperCase);
         break;
     }
     case DBUS_TYPE_INT16:
     {
         int16_t v;
-        char    temp[7];
         dbus_message_iter_get_basic(aIter, &v);
-        snprintf(temp, sizeof(temp), "%d", v);
-        strcat(aOutput, temp);
+        aOutput.AppendSigned(v);
         break;
     }
     case DBUS_TYPE_UINT32:
     {
         uint32_t v;
-        char     temp[10];
         dbus_message_iter_get_basic(aIter, &v);
-        int vLen = floor(log10(v)) + 2;
-        snprintf(temp, vLen, "%d", v);
-        strcat(aOutput, temp);
+        aOutput.AppendUnsigned(v);
         break;
     }
     case DBUS_TYPE_BOOLEAN:
     {
         dbus_bool_t v;
-        char        temp[7];
         dbus_message_iter_get_basic(aIter, &v);
-        snprintf(temp, sizeof(temp), "%s", v ? "true" : "false");
-        strcat(aOutput, temp);
+        aOutput.Append(v ? "true" : "false");
         break;
     }
     case DBUS_TYPE_INT32:
     {
         int32_t v;
-        char    temp[10];
         dbus_message_iter_get_basic(aIter, &v);
-        int vLen = floor(log10(abs(v))) + 2;
-        snprintf(temp, vLen, "%d", v);
-        strcat(aOutput, temp);
+        aOutput.AppendSigned(v);
         break;
     }
     case DBUS_TYPE_UINT64:
     {
         uint64_t v;
-        char     temp[19];
         dbus_message_iter_get_basic(aIter, &v);
-        snprintf(temp, 19, "0x%016llX", (unsigned long long)v);
-        strcat(aOutput, temp);
+        aOutput.Append("0x").AppendHex(v, 16, Format::kUpperCase);
         break;
     }
     default:
-        char temp[100];
-        snprintf(temp, 100, "<%s>", dbus_message_type_to_string(dbus_message_iter_get_arg_type(aIter)));
-        strcat(aOutput, temp);
+        aOutput.AppendChar('<')
+            .Append(dbus_message_type_to_string(dbus_message_iter_get_arg_type(aIter)))
+            .AppendChar('>');
         break;
     }
 
@@ -206,10 +193,11 @@ exit:
 
 const char *DBusGet::GetPropertyValue(const char *aPropertyName)
 {
+    Format::StringBuilder value(mPropertyValue, OT_PROPERTY_VALUE_SIZE);
+
     SetPropertyName(aPropertyName);
-    memset(mPropertyValue, 0, OT_PROPERTY_VALUE_SIZE);
     VerifyOrExit(ProcessReply() == kWpantundStatus_Ok);
-    DumpInfoFromIter(mPropertyValue, &mIter, 0, false);
+    DumpInfoFromIter(value, &mIter, 0, false);
 exit:
     return mPropertyValue;
 }
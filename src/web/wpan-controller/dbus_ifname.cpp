@@ -31,6 +31,8 @@
  *   This file implements function of "look up" DBus interface name.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "web/wpan-controller/dbus_ifname.hpp"
 
 #include <dbus/dbus.h>
@@ -31,6 +31,8 @@
  *   This file implements "join" Thread Network function.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "web/wpan-controller/dbus_join.hpp"
 
 #include "common/code_utils.hpp"
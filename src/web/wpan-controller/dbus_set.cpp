@@ -31,6 +31,8 @@
  *   This file implements "set property" function.
  */
 
+#define OTBR_LOG_MODULE OTBR_LOG_MODULE_WEB
+
 #include "web/wpan-controller/dbus_set.hpp"
 
 #include "common/code_utils.hpp"
@@ -0,0 +1,176 @@
+/*
+ *    Copyright (c) 2019, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+
+#include <dbus/dbus.h>
+
+#include "common/time.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
+
+using otbr::GetNow;
+using otbr::DBus::TupleToDBusMessage;
+using otbr::DBus::UniqueDBusMessage;
+
+static const char kServerName[]    = "io.openthread.TestServer";
+static const char kObjectPath[]    = "/io/openthread/testobj";
+static const char kInterfaceName[] = "io.openthread";
+
+static const char kBusy[]            = "io.openthread.Error.Busy";
+static const char kResponseTimeout[] = "io.openthread.Error.ResponseTimeout";
+static const char kAbort[]           = "io.openthread.Error.Abort";
+
+enum
+{
+    kCallTimeout  = 2000, ///< Milliseconds before a call to the test server fails.
+    kDelayTimeout = 200,  ///< Milliseconds before the test server times a call of Delay out.
+    kLongDelay    = 600,  ///< Milliseconds before the test server replies to a call timing out.
+};
+
+static const uint32_t kDropDelay = UINT32_MAX; ///< The delay of the calls the test server never replies.
+
+static UniqueDBusMessage NewDelayCall(uint32_t aDelay)
+{
+    UniqueDBusMessage message{dbus_message_new_method_call(kServerName, kObjectPath, kInterfaceName, "Delay")};
+
+    assert(message != nullptr);
+    assert(TupleToDBusMessage(*message, std::make_tuple(aDelay)) == OTBR_ERROR_NONE);
+
+    return message;
+}
+
+/**
+ * This function calls Delay and waits for the reply.
+ *
+ * @returns The error name of the reply, or an empty string if the call succeeded.
+ *
+ */
+static std::string CallDelay(DBusConnection *aConnection, uint32_t aDelay)
+{
+    UniqueDBusMessage message = NewDelayCall(aDelay);
+    UniqueDBusMessage reply;
+    DBusError         error;
+    std::string       errorName;
+
+    dbus_error_init(&error);
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(aConnection, message.get(), kCallTimeout, &error));
+    if (reply == nullptr)
+    {
+        assert(dbus_error_is_set(&error));
+        errorName = error.name;
+    }
+    dbus_error_free(&error);
+
+    return errorName;
+}
+
+static DBusConnection *Connect(void)
+{
+    DBusConnection *connection = dbus_bus_get_private(DBUS_BUS_SYSTEM, nullptr);
+
+    assert(connection != nullptr);
+    dbus_connection_set_exit_on_disconnect(connection, false);
+
+    return connection;
+}
+
+static void TestTimeout(DBusConnection *aCaller, DBusConnection *aOther)
+{
+    UniqueDBusMessage message = NewDelayCall(kLongDelay);
+    DBusPendingCall * pending = nullptr;
+    unsigned long     start   = GetNow();
+    dbus_uint32_t     serial;
+    UniqueDBusMessage reply;
+
+    assert(dbus_connection_send_with_reply(aCaller, message.get(), &pending, kCallTimeout));
+    assert(pending != nullptr);
+    serial = dbus_message_get_serial(message.get());
+    dbus_connection_flush(aCaller);
+
+    // Only one call of Delay may be in flight.
+    assert(CallDelay(aOther, 0) == kBusy);
+
+    dbus_pending_call_block(pending);
+    reply = UniqueDBusMessage(dbus_pending_call_steal_reply(pending));
+    dbus_pending_call_unref(pending);
+    assert(reply != nullptr);
+    assert(dbus_message_get_type(reply.get()) == DBUS_MESSAGE_TYPE_ERROR);
+    assert(std::string(dbus_message_get_error_name(reply.get())) == kResponseTimeout);
+    assert(GetNow() - start >= kDelayTimeout && GetNow() - start < kLongDelay);
+
+    // The call timed out, but the server still waits for its handler.
+    assert(CallDelay(aOther, 0) == kBusy);
+
+    // The late reply of the handler is dropped.
+    while (GetNow() - start < kLongDelay + kDelayTimeout)
+    {
+        DBusMessage *late;
+
+        dbus_connection_read_write(aCaller, static_cast<int>(kLongDelay + kDelayTimeout - (GetNow() - start)));
+        while ((late = dbus_connection_pop_message(aCaller)) != nullptr)
+        {
+            assert(dbus_message_get_reply_serial(late) != serial);
+            dbus_message_unref(late);
+        }
+    }
+
+    // Once the handler replied, the call no longer counts as in flight.
+    assert(CallDelay(aOther, 0).empty());
+}
+
+static void TestDrop(DBusConnection *aCaller)
+{
+    // A call its handler dropped without replying is aborted, and no longer counts as in flight.
+    assert(CallDelay(aCaller, kDropDelay) == kAbort);
+    assert(CallDelay(aCaller, 0).empty());
+}
+
+int main()
+{
+    DBusConnection *caller = Connect();
+    DBusConnection *other  = Connect();
+
+    assert(CallDelay(caller, 0).empty());
+    TestTimeout(caller, other);
+    TestDrop(caller);
+
+    dbus_connection_close(other);
+    dbus_connection_unref(other);
+    dbus_connection_close(caller);
+    dbus_connection_unref(caller);
+    printf("All tests passed\n");
+
+    return EXIT_SUCCESS;
+}
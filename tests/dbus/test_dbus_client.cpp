@@ -157,6 +157,8 @@ int main()
                 assert(api->GetInstantRssi(rssi) == OTBR_ERROR_NONE);
                 assert(api->GetRadioTxPower(txPower) == OTBR_ERROR_NONE);
                 CheckExternalRoute(api.get(), prefix);
+                assert(api->SetLogLevels("dtls=7,coap=6") == OTBR_ERROR_NONE);
+                assert(api->SetLogLevels("dtls=8") != OTBR_ERROR_NONE);
                 assert(api->AddOnMeshPrefix(onMeshPrefix) == OTBR_ERROR_NONE);
                 assert(api->RemoveOnMeshPrefix(onMeshPrefix.mPrefix) == OTBR_ERROR_NONE);
                 api->FactoryReset(nullptr);
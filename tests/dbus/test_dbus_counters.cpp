@@ -0,0 +1,293 @@
+/*
+ *    Copyright (c) 2019, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+#include <dbus/dbus.h>
+
+#include "common/time.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
+
+using otbr::GetNow;
+using otbr::DBus::DBusMessageEncode;
+using otbr::DBus::DBusMessageEncodeToVariant;
+using otbr::DBus::DBusMessageExtractFromVariant;
+using otbr::DBus::DBusMessageToTuple;
+using otbr::DBus::TupleToDBusMessage;
+using otbr::DBus::UniqueDBusMessage;
+
+static const char kServerName[]    = "io.openthread.TestServer";
+static const char kObjectPath[]    = "/io/openthread/testobj";
+static const char kInterfaceName[] = "io.openthread";
+
+enum
+{
+    kCallTimeout  = 1000, ///< Milliseconds before a call to the test server fails.
+    kDeltaTimeout = 2000, ///< Milliseconds before a wait for the deltas of counters fails.
+    kPeriod       = 100,  ///< Milliseconds between two deltas.
+};
+
+static UniqueDBusMessage NewCall(const char *aInterfaceName, const char *aMethodName)
+{
+    UniqueDBusMessage message{dbus_message_new_method_call(kServerName, kObjectPath, aInterfaceName, aMethodName)};
+
+    assert(message != nullptr);
+
+    return message;
+}
+
+static UniqueDBusMessage Send(DBusConnection *aConnection, DBusMessage &aMessage)
+{
+    // Error replies are returned as nullptr.
+    return UniqueDBusMessage(dbus_connection_send_with_reply_and_block(aConnection, &aMessage, kCallTimeout, nullptr));
+}
+
+template <typename... FieldTypes>
+static UniqueDBusMessage Call(DBusConnection *                 aConnection,
+                              const char *                     aInterfaceName,
+                              const char *                     aMethodName,
+                              const std::tuple<FieldTypes...> &aArgs)
+{
+    UniqueDBusMessage message = NewCall(aInterfaceName, aMethodName);
+
+    assert(TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE);
+
+    return Send(aConnection, *message);
+}
+
+template <typename ValueType> static void GetProperty(DBusConnection *aConnection, const char *aName, ValueType &aValue)
+{
+    auto              args  = std::make_tuple(std::string(kInterfaceName), std::string(aName));
+    UniqueDBusMessage reply = Call(aConnection, DBUS_INTERFACE_PROPERTIES, "Get", args);
+    DBusMessageIter   iter;
+
+    assert(reply != nullptr);
+    assert(dbus_message_iter_init(reply.get(), &iter));
+    assert(DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE);
+}
+
+static uint32_t GetSubscribers(DBusConnection *aConnection)
+{
+    uint32_t subscribers;
+
+    GetProperty(aConnection, "Subscribers", subscribers);
+
+    return subscribers;
+}
+
+static void SetCount(DBusConnection *aConnection, int32_t aCount)
+{
+    UniqueDBusMessage message = NewCall(DBUS_INTERFACE_PROPERTIES, "Set");
+    DBusMessageIter   iter;
+
+    dbus_message_iter_init_append(message.get(), &iter);
+    assert(DBusMessageEncode(&iter, std::string(kInterfaceName)) == OTBR_ERROR_NONE);
+    assert(DBusMessageEncode(&iter, std::string("Count")) == OTBR_ERROR_NONE);
+    assert(DBusMessageEncodeToVariant(&iter, aCount) == OTBR_ERROR_NONE);
+    assert(Send(aConnection, *message) != nullptr);
+}
+
+static bool Subscribe(DBusConnection *aConnection, const std::vector<std::string> &aCounters, uint32_t aPeriod)
+{
+    return Call(aConnection, kInterfaceName, "SubscribeCounters", std::make_tuple(aCounters, aPeriod)) != nullptr;
+}
+
+static bool Unsubscribe(DBusConnection *aConnection)
+{
+    return Send(aConnection, *NewCall(kInterfaceName, "UnsubscribeCounters")) != nullptr;
+}
+
+static void DropMessages(DBusConnection *aConnection)
+{
+    DBusMessage *message;
+
+    while ((message = dbus_connection_pop_message(aConnection)) != nullptr)
+    {
+        dbus_message_unref(message);
+    }
+}
+
+/**
+ * This function waits for the next counters delta sent to the connection.
+ *
+ * @returns Whether a delta was received within @p aTimeout milliseconds.
+ *
+ */
+static bool WaitDelta(DBusConnection *aConnection, unsigned long aTimeout, std::vector<uint32_t> &aDeltas)
+{
+    unsigned long deadline = GetNow() + aTimeout;
+    bool          received = false;
+
+    while (!received)
+    {
+        unsigned long     now = GetNow();
+        UniqueDBusMessage message;
+
+        if (now >= deadline)
+        {
+            break;
+        }
+
+        dbus_connection_read_write(aConnection, static_cast<int>(deadline - now));
+        while (!received && (message = UniqueDBusMessage(dbus_connection_pop_message(aConnection))) != nullptr)
+        {
+            uint32_t elapsed;
+            auto     args = std::tie(elapsed, aDeltas);
+
+            if (!dbus_message_is_signal(message.get(), kInterfaceName, "CountersDelta"))
+            {
+                continue;
+            }
+
+            // The delta is sent to the subscriber only.
+            assert(dbus_message_get_destination(message.get()) != nullptr);
+            assert(std::string(dbus_message_get_destination(message.get())) ==
+                   dbus_bus_get_unique_name(aConnection));
+            assert(DBusMessageToTuple(*message, args) == OTBR_ERROR_NONE);
+            assert(elapsed >= kPeriod);
+            received = true;
+        }
+    }
+
+    return received;
+}
+
+/**
+ * This function sums up the deltas of the first subscribed counter until they reach @p aIncrement.
+ *
+ */
+static void WaitIncrement(DBusConnection *aConnection, size_t aNumCounters, uint32_t aIncrement)
+{
+    uint32_t total = 0;
+
+    while (total < aIncrement)
+    {
+        std::vector<uint32_t> deltas;
+
+        assert(WaitDelta(aConnection, kDeltaTimeout, deltas));
+        assert(deltas.size() == aNumCounters);
+        total += deltas[0];
+    }
+
+    assert(total == aIncrement);
+}
+
+static DBusConnection *Connect(void)
+{
+    DBusConnection *connection = dbus_bus_get_private(DBUS_BUS_SYSTEM, nullptr);
+
+    assert(connection != nullptr);
+    dbus_connection_set_exit_on_disconnect(connection, false);
+
+    return connection;
+}
+
+static void TestSubscribe(DBusConnection *aSubscriber)
+{
+    int32_t count;
+
+    assert(GetSubscribers(aSubscriber) == 0);
+    assert(Subscribe(aSubscriber, {"Count"}, kPeriod));
+    assert(GetSubscribers(aSubscriber) == 1);
+
+    GetProperty(aSubscriber, "Count", count);
+    SetCount(aSubscriber, count + 5);
+    WaitIncrement(aSubscriber, 1, 5);
+}
+
+static void TestReplace(DBusConnection *aSubscriber)
+{
+    assert(Subscribe(aSubscriber, {"Pings", "Count"}, kPeriod));
+    assert(GetSubscribers(aSubscriber) == 1);
+
+    // Deltas of the replaced subscription were queued before the reply.
+    DropMessages(aSubscriber);
+    assert(Call(aSubscriber, kInterfaceName, "Ping", std::make_tuple(uint32_t(1), std::string("Ping"))) != nullptr);
+    WaitIncrement(aSubscriber, 2, 1);
+
+    assert(!Subscribe(aSubscriber, {"Unknown"}, kPeriod));
+    assert(!Subscribe(aSubscriber, {"Count"}, kPeriod / 2));
+    assert(GetSubscribers(aSubscriber) == 1);
+}
+
+static void TestUnsubscribe(DBusConnection *aSubscriber)
+{
+    std::vector<uint32_t> deltas;
+
+    assert(Unsubscribe(aSubscriber));
+    assert(GetSubscribers(aSubscriber) == 0);
+    assert(!Unsubscribe(aSubscriber));
+
+    DropMessages(aSubscriber);
+    assert(!WaitDelta(aSubscriber, kPeriod * 3, deltas));
+}
+
+static void TestDisconnect(DBusConnection *aSubscriber, DBusConnection *aObserver)
+{
+    std::vector<uint32_t> deltas;
+    unsigned long         deadline = GetNow() + kDeltaTimeout;
+
+    // The deltas sent to the subscriber were not broadcast.
+    assert(!WaitDelta(aObserver, kPeriod, deltas));
+
+    assert(Subscribe(aObserver, {"Count"}, kPeriod));
+    assert(GetSubscribers(aSubscriber) == 1);
+    dbus_connection_close(aObserver);
+    dbus_connection_unref(aObserver);
+
+    while (GetSubscribers(aSubscriber) != 0)
+    {
+        assert(GetNow() < deadline);
+        dbus_connection_read_write(aSubscriber, kPeriod);
+    }
+}
+
+int main()
+{
+    DBusConnection *subscriber = Connect();
+    DBusConnection *observer   = Connect();
+
+    dbus_bus_add_match(observer, "type='signal',interface='io.openthread',member='CountersDelta'", nullptr);
+
+    TestSubscribe(subscriber);
+    TestReplace(subscriber);
+    TestUnsubscribe(subscriber);
+    TestDisconnect(subscriber, observer);
+
+    dbus_connection_close(subscriber);
+    dbus_connection_unref(subscriber);
+    printf("All tests passed\n");
+
+    return EXIT_SUCCESS;
+}
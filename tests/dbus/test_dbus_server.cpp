@@ -26,9 +26,19 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <vector>
+
+#include <limits.h>
+#include <stdint.h>
+
+#include "common/time.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/server/dbus_counters_publisher.hpp"
 #include "dbus/server/dbus_object.hpp"
 
+using otbr::GetNow;
+using otbr::DBus::DBusCountersPublisher;
 using otbr::DBus::DBusMessageEncodeToVariant;
 using otbr::DBus::DBusMessageExtractFromVariant;
 using otbr::DBus::DBusMessageToTuple;
@@ -42,16 +52,124 @@ public:
     TestObject(DBusConnection *aConnection)
         : DBusObject(aConnection, "/io/openthread/testobj")
         , mEnded(false)
+        , mFaulty(false)
         , mCount(0)
+        , mPings(0)
+        , mCountersPublisher(*this,
+                             aConnection,
+                             "io.openthread",
+                             FindCounter,
+                             std::bind(&TestObject::ReadCounter, this, _1))
     {
         RegisterMethod("io.openthread", "Ping", std::bind(&TestObject::PingHandler, this, _1));
+        RegisterMethod("io.openthread", "Break", std::bind(&TestObject::BreakHandler, this, _1));
+        RegisterAsyncMethod("io.openthread", "Delay", std::bind(&TestObject::DelayHandler, this, _1), kDelayTimeout, 1);
+        RegisterMethod("io.openthread", "SubscribeCounters",
+                       std::bind(&DBusCountersPublisher::SubscribeHandler, &mCountersPublisher, _1));
+        RegisterMethod("io.openthread", "UnsubscribeCounters",
+                       std::bind(&DBusCountersPublisher::UnsubscribeHandler, &mCountersPublisher, _1));
+        RegisterGetPropertyHandler("io.openthread", "Faulty", std::bind(&TestObject::FaultyGetHandler, this, _1));
         RegisterGetPropertyHandler("io.openthread", "Count", std::bind(&TestObject::CountGetHandler, this, _1));
         RegisterSetPropertyHandler("io.openthread", "Count", std::bind(&TestObject::CountSetHandler, this, _1));
+        RegisterGetPropertyHandler("io.openthread", "Subscribers",
+                                   std::bind(&TestObject::SubscribersGetHandler, this, _1));
+    }
+
+    otbrError Init(void) override
+    {
+        otbrError error;
+
+        SuccessOrExit(error = DBusObject::Init());
+        error = mCountersPublisher.Init();
+
+    exit:
+        return error;
     }
 
     bool IsEnded(void) const { return mEnded; }
 
+    DBusCountersPublisher &GetCountersPublisher(void) { return mCountersPublisher; }
+
+    bool GetDelayedReplyDelay(unsigned long &aDelay) const
+    {
+        unsigned long now = GetNow();
+
+        aDelay = ULONG_MAX;
+        for (const auto &delayed : mDelayedReplies)
+        {
+            aDelay = std::min(aDelay, delayed.mDue > now ? delayed.mDue - now : 0);
+        }
+
+        return !mDelayedReplies.empty();
+    }
+
+    void SendDelayedReplies(void)
+    {
+        unsigned long now = GetNow();
+
+        for (auto it = mDelayedReplies.begin(); it != mDelayedReplies.end();)
+        {
+            if (it->mDue <= now)
+            {
+                it->mRequest.Reply(std::make_tuple(it->mDelay));
+                it = mDelayedReplies.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
 private:
+    enum
+    {
+        kDelayTimeout = 200, ///< Milliseconds before a call of Delay times out.
+    };
+
+    static constexpr uint32_t kDropDelay = UINT32_MAX; ///< The delay of the calls of Delay which are never replied.
+
+    struct DelayedReply
+    {
+        DBusRequest   mRequest;
+        uint32_t      mDelay;
+        unsigned long mDue;
+    };
+
+    static bool FindCounter(const std::string &aName, uint8_t &aIndex)
+    {
+        bool found = true;
+
+        if (aName == "Count")
+        {
+            aIndex = 0;
+        }
+        else if (aName == "Pings")
+        {
+            aIndex = 1;
+        }
+        else
+        {
+            found = false;
+        }
+
+        return found;
+    }
+
+    uint32_t ReadCounter(uint8_t aIndex) { return aIndex == 0 ? static_cast<uint32_t>(mCount) : mPings; }
+
+    otError SubscribersGetHandler(DBusMessageIter &aIter)
+    {
+        DBusMessageEncodeToVariant(&aIter, static_cast<uint32_t>(mCountersPublisher.GetSubscriptionCount()));
+        return OT_ERROR_NONE;
+    }
+
+    otError FaultyGetHandler(DBusMessageIter &aIter)
+    {
+        DBusMessageEncodeToVariant(&aIter, static_cast<uint8_t>(mFaulty));
+        return mFaulty ? OT_ERROR_FAILED : OT_ERROR_NONE;
+    }
+
     otError CountGetHandler(DBusMessageIter &aIter)
     {
         DBusMessageEncodeToVariant(&aIter, mCount);
@@ -68,12 +186,39 @@ private:
         return OT_ERROR_NONE;
     }
 
+    void BreakHandler(DBusRequest &aRequest)
+    {
+        // The change of Count is signalled even though Faulty can no longer be read.
+        mFaulty = true;
+        mCount++;
+        MarkPropertyChanged("io.openthread", "Faulty");
+        MarkPropertyChanged("io.openthread", "Count");
+        aRequest.ReplyOtResult(OT_ERROR_NONE);
+    }
+
+    void DelayHandler(DBusRequest &aRequest)
+    {
+        uint32_t delay;
+        auto     args = std::tie(delay);
+
+        if (DBusMessageToTuple(*aRequest.GetMessage(), args) != OTBR_ERROR_NONE)
+        {
+            aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS);
+        }
+        else if (delay != kDropDelay)
+        {
+            // The call is replied from the mainloop, like the calls waiting for OpenThread callbacks.
+            mDelayedReplies.push_back({aRequest, delay, GetNow() + delay});
+        }
+    }
+
     void PingHandler(DBusRequest &aRequest)
     {
         uint32_t    id;
         std::string pingMessage;
         auto        args = std::tie(id, pingMessage);
 
+        mPings++;
         if (DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE)
         {
             aRequest.Reply(std::make_tuple(id, pingMessage + "Pong"));
@@ -85,10 +230,22 @@ private:
         }
     }
 
-    bool    mEnded;
-    int32_t mCount;
+    bool                      mEnded;
+    bool                      mFaulty;
+    int32_t                   mCount;
+    uint32_t                  mPings;
+    DBusCountersPublisher     mCountersPublisher;
+    std::vector<DelayedReply> mDelayedReplies;
 };
 
+static void LowerTimeout(int &aTimeout, unsigned long aDelay)
+{
+    if (aTimeout < 0 || aDelay < static_cast<unsigned long>(aTimeout))
+    {
+        aTimeout = static_cast<int>(aDelay);
+    }
+}
+
 int main()
 {
     int       ret = EXIT_SUCCESS;
@@ -113,7 +270,34 @@ int main()
 
         while (!s.IsEnded())
         {
-            dbus_connection_read_write_dispatch(connection, -1);
+            unsigned long delay;
+            int           timeout = -1;
+
+            if (s.GetPropertiesChangedDelay(delay))
+            {
+                LowerTimeout(timeout, delay);
+            }
+
+            if (s.GetCountersPublisher().GetDeltaDelay(delay))
+            {
+                LowerTimeout(timeout, delay);
+            }
+
+            if (s.GetDelayedReplyDelay(delay))
+            {
+                LowerTimeout(timeout, delay);
+            }
+
+            if (s.GetRequestsTimeoutDelay(delay))
+            {
+                LowerTimeout(timeout, delay);
+            }
+
+            dbus_connection_read_write_dispatch(connection, timeout);
+            s.FlushPropertiesChanged();
+            s.GetCountersPublisher().SendDeltas();
+            s.SendDelayedReplies();
+            s.ExpireRequests();
         }
     }
 
@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "commissioner/channel_survey.hpp"
+#include "common/tlv.hpp"
+
+static const uint8_t kRouterA[] = {0xfd, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xfe, 0, 0x04, 0x00};
+static const uint8_t kRouterB[] = {0xfd, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xfe, 0, 0x08, 0x00};
+
+TEST_GROUP(ChannelSurvey){};
+
+TEST(ChannelSurvey, TestEncodeEnergyScanQuery)
+{
+    const uint8_t kExpected[] = {
+        otbr::Meshcop::kCommissionerSessionId,
+        2,
+        0x12,
+        0x34,
+        otbr::Meshcop::kChannelMask,
+        6,
+        0,
+        4,
+        0x00,
+        0x1f,
+        0xff,
+        0xe0,
+        otbr::Meshcop::kCount,
+        1,
+        2,
+        otbr::Meshcop::kPeriod,
+        2,
+        0,
+        32,
+        otbr::Meshcop::kScanDuration,
+        2,
+        0,
+        16,
+    };
+    uint8_t  buffer[otbr::ChannelSurvey::kMaxQuerySize];
+    uint16_t length = otbr::ChannelSurvey::EncodeEnergyScanQuery(buffer, 0x1234, 0x07fff800, 2, 32, 16);
+
+    CHECK_EQUAL(sizeof(kExpected), length);
+    MEMCMP_EQUAL(kExpected, buffer, sizeof(kExpected));
+}
+
+TEST(ChannelSurvey, TestAggregateReports)
+{
+    // Channels 11 and 12, two measurements each.
+    const uint8_t kReportA[] = {
+        otbr::Meshcop::kChannelMask, 6, 0, 4, 0x00, 0x18, 0x00, 0x00, otbr::Meshcop::kEnergyList, 4, 0xb0, 0xba,
+        0xc4, 0xa6,
+    };
+    const uint8_t kReportB[] = {
+        otbr::Meshcop::kChannelMask, 6, 0, 4, 0x00, 0x18, 0x00, 0x00, otbr::Meshcop::kEnergyList, 4, 0xce, 0xc8,
+        0xa1, 0xa1,
+    };
+    const uint8_t kConflictB[] = {
+        otbr::Meshcop::kChannelMask, 6, 0, 4, 0x00, 0x08, 0x00, 0x00, otbr::Meshcop::kPanId, 2, 0xfa, 0xce,
+    };
+
+    otbr::ChannelSurvey                survey;
+    otbr::ChannelSurvey::ChannelSummary summary;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, survey.HandleEnergyReport(kRouterA, kReportA, sizeof(kReportA)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, survey.HandleEnergyReport(kRouterB, kReportB, sizeof(kReportB)));
+    CHECK_EQUAL(2, survey.GetNumReporters());
+
+    // Router A measured -80 and -70 dBm on channel 11, -60 and -90 dBm on channel 12.
+    CHECK_EQUAL(-70, survey.GetReporter(0).mMaxRssi[11]);
+    CHECK_EQUAL(-60, survey.GetReporter(0).mMaxRssi[12]);
+    CHECK_EQUAL(otbr::ChannelSurvey::kRssiInvalid, survey.GetReporter(0).mMaxRssi[13]);
+
+    summary = survey.GetChannelSummary(11);
+    CHECK_EQUAL(2, summary.mNumReporters);
+    CHECK_EQUAL(-50, summary.mMaxRssi);
+    CHECK_EQUAL(-60, summary.mMeanRssi);
+
+    summary = survey.GetChannelSummary(12);
+    CHECK_EQUAL(-60, summary.mMaxRssi);
+    CHECK_EQUAL(0, summary.mNumConflicts);
+    CHECK_EQUAL(12, survey.GetQuietestChannel());
+
+    // A PAN ID conflict rules channel 12 out.
+    CHECK_EQUAL(OTBR_ERROR_NONE, survey.HandlePanIdConflict(kRouterB, kConflictB, sizeof(kConflictB)));
+    CHECK_EQUAL(2, survey.GetNumReporters());
+    CHECK_EQUAL(1, survey.GetChannelSummary(12).mNumConflicts);
+    CHECK_EQUAL(11, survey.GetQuietestChannel());
+
+    CHECK_EQUAL(-1, survey.GetQuietestChannel(1U << 20));
+
+    survey.Clear();
+    CHECK_EQUAL(0, survey.GetNumReporters());
+}
+
+TEST(ChannelSurvey, TestMalformedReport)
+{
+    // Three energy values cannot be split evenly over two channels.
+    const uint8_t kUneven[] = {
+        otbr::Meshcop::kChannelMask, 6, 0, 4, 0x00, 0x18, 0x00, 0x00, otbr::Meshcop::kEnergyList, 3, 0xb0, 0xba, 0xc4,
+    };
+    const uint8_t kTruncated[] = {otbr::Meshcop::kChannelMask, 6, 0, 4, 0x00};
+    const uint8_t kNoMask[]    = {otbr::Meshcop::kEnergyList, 2, 0xb0, 0xba};
+
+    otbr::ChannelSurvey survey;
+
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, survey.HandleEnergyReport(kRouterA, kUneven, sizeof(kUneven)));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, survey.HandleEnergyReport(kRouterA, kTruncated, sizeof(kTruncated)));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, survey.HandleEnergyReport(kRouterA, kNoMask, sizeof(kNoMask)));
+    CHECK_EQUAL(0, survey.GetNumReporters());
+}
@@ -0,0 +1,102 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/crc16.hpp"
+
+using otbr::Crc16;
+
+/**
+ * This function computes a CRC16 one bit at a time.
+ *
+ */
+static uint16_t ComputeBitwise(uint16_t aPolynomial, const uint8_t *aBuffer, size_t aLength)
+{
+    uint16_t crc = 0;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        crc ^= static_cast<uint16_t>(aBuffer[i] << 8);
+
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>(static_cast<uint16_t>(crc << 1) ^ aPolynomial)
+                                 : static_cast<uint16_t>(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+TEST_GROUP(Crc16){};
+
+TEST(Crc16, TestCheckValues)
+{
+    const uint8_t kCheck[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    Crc16         ccitt(Crc16::kCcitt);
+    Crc16         ansi(Crc16::kAnsi);
+
+    ccitt.Update(kCheck, sizeof(kCheck));
+    CHECK_EQUAL(0x31c3, ccitt.Get());
+
+    for (size_t i = 0; i < sizeof(kCheck); i++)
+    {
+        ansi.Update(kCheck[i]);
+    }
+    CHECK_EQUAL(0xfee8, ansi.Get());
+}
+
+TEST(Crc16, TestMatchesBitwise)
+{
+    const Crc16::Polynomial kPolynomials[] = {Crc16::kCcitt, Crc16::kAnsi};
+    uint8_t                 buffer[41];
+
+    for (size_t i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+
+    for (size_t i = 0; i < sizeof(kPolynomials) / sizeof(kPolynomials[0]); i++)
+    {
+        for (size_t length = 0; length <= sizeof(buffer); length++)
+        {
+            Crc16    sliced(kPolynomials[i]);
+            Crc16    split(kPolynomials[i]);
+            uint16_t expected = ComputeBitwise(static_cast<uint16_t>(kPolynomials[i]), buffer, length);
+
+            sliced.Update(buffer, length);
+            CHECK_EQUAL(expected, sliced.Get());
+
+            // Continuing from a non zero register.
+            split.Update(buffer, length / 3);
+            split.Update(buffer + length / 3, length - length / 3);
+            CHECK_EQUAL(expected, split.Get());
+        }
+    }
+}
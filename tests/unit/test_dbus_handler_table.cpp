@@ -0,0 +1,74 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "dbus/server/dbus_handler_table.hpp"
+
+using otbr::DBus::DBusHandlerTable;
+
+TEST_GROUP(DBusHandlerTable){};
+
+TEST(DBusHandlerTable, TestFind)
+{
+    DBusHandlerTable<int> table;
+    std::string           member = "Get";
+
+    CHECK(table.Add("io.openthread.BorderRouter", "Scan", 1));
+    CHECK(table.Add("io.openthread.BorderRouter", "Attach", 2));
+    CHECK(table.Add("org.freedesktop.DBus.Properties", "Get", 3));
+    CHECK(table.Add("io.openthread.BorderRouter", "Reset", 4));
+    CHECK(!table.Add("io.openthread.BorderRouter", "Attach", 5));
+
+    CHECK_EQUAL(1, *table.Find("io.openthread.BorderRouter", "Scan"));
+    CHECK_EQUAL(2, *table.Find("io.openthread.BorderRouter", "Attach"));
+    CHECK_EQUAL(3, *table.Find("org.freedesktop.DBus.Properties", member.c_str()));
+    CHECK_EQUAL(4, *table.Find("io.openthread.BorderRouter", "Reset"));
+    CHECK(table.Find("io.openthread.BorderRouter", "Get") == nullptr);
+    CHECK(table.Find("io.openthread.BorderRouter", "Attach2") == nullptr);
+    CHECK(table.Find("io.openthread", "Scan") == nullptr);
+}
+
+TEST(DBusHandlerTable, TestFindInterface)
+{
+    DBusHandlerTable<int> table;
+    auto                  members = table.FindInterface("io.openthread.BorderRouter");
+
+    CHECK(members.first == members.second);
+
+    table.Add("io.openthread.BorderRouter", "PanId", 1);
+    table.Add("org.freedesktop.DBus.Properties", "Get", 2);
+    table.Add("io.openthread.BorderRouter", "Channel", 3);
+
+    // Members are sorted by name.
+    members = table.FindInterface("io.openthread.BorderRouter");
+    CHECK_EQUAL(2, members.second - members.first);
+    STRCMP_EQUAL("Channel", members.first->mMember.c_str());
+    CHECK_EQUAL(3, members.first->mHandler);
+    STRCMP_EQUAL("PanId", (members.first + 1)->mMember.c_str());
+}
@@ -327,3 +327,158 @@ TEST(DBusMessage, TestOtbrExternalRoute)
 
     dbus_message_unref(msg);
 }
+
+TEST(DBusMessage, TestOtbrTelemetry)
+{
+    DBusMessage *                msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<otbr::DBus::Telemetry> setVals;
+    tuple<otbr::DBus::Telemetry> getVals;
+    otbr::DBus::Telemetry &      telemetry = std::get<0>(setVals);
+    const otbr::DBus::Telemetry &decoded   = std::get<0>(getVals);
+
+    CHECK(msg != NULL);
+
+    telemetry.mVersion     = 1;
+    telemetry.mFields      = otbr::DBus::OTBR_TELEMETRY_STATE | otbr::DBus::OTBR_TELEMETRY_CHILD_TABLE;
+    telemetry.mDeviceRole  = "leader";
+    telemetry.mPartitionId = 0x12345678;
+    telemetry.mRloc16      = 0xfc00;
+    telemetry.mLeaderData  = {1, 2, 3, 4, 5};
+    telemetry.mChildTable.push_back({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, true, false, true, false, true});
+    telemetry.mNetworkData               = {0x08, 0x04, 0x0b, 0x02};
+    telemetry.mLinkCounters              = otbr::DBus::MacCounters();
+    telemetry.mLinkCounters.mTxTotal     = 100;
+    telemetry.mLinkCounters.mRxErrOther  = 200;
+    telemetry.mIp6Counters               = {1, 2, 3, 4};
+    telemetry.mChannelMonitorSampleCount = 50;
+    telemetry.mChannelQualities.push_back({11, 0x1234});
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK_EQUAL(telemetry.mVersion, decoded.mVersion);
+    CHECK_EQUAL(telemetry.mFields, decoded.mFields);
+    CHECK(telemetry.mDeviceRole == decoded.mDeviceRole);
+    CHECK_EQUAL(telemetry.mPartitionId, decoded.mPartitionId);
+    CHECK_EQUAL(telemetry.mRloc16, decoded.mRloc16);
+    CHECK(telemetry.mLeaderData == decoded.mLeaderData);
+    CHECK_EQUAL(1, decoded.mChildTable.size());
+    CHECK(telemetry.mChildTable[0] == decoded.mChildTable[0]);
+    CHECK(decoded.mNeighborTable.empty());
+    CHECK(telemetry.mNetworkData == decoded.mNetworkData);
+    CHECK(decoded.mStableNetworkData.empty());
+    CHECK_EQUAL(100, decoded.mLinkCounters.mTxTotal);
+    CHECK_EQUAL(200, decoded.mLinkCounters.mRxErrOther);
+    CHECK_EQUAL(4, decoded.mIp6Counters.mRxFailure);
+    CHECK_EQUAL(telemetry.mChannelMonitorSampleCount, decoded.mChannelMonitorSampleCount);
+    CHECK_EQUAL(1, decoded.mChannelQualities.size());
+    CHECK(telemetry.mChannelQualities[0] == decoded.mChannelQualities[0]);
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestOtbrTelemetryTrailingField)
+{
+    DBusMessage *                          msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    otbr::DBus::Telemetry                  telemetry;
+    tuple<otbr::DBus::Telemetry, uint32_t> getVals;
+    const otbr::DBus::Telemetry &          decoded = std::get<0>(getVals);
+    DBusMessageIter                        iter;
+    DBusMessageIter                        sub;
+
+    CHECK(msg != NULL);
+
+    telemetry.mVersion                   = 2;
+    telemetry.mFields                    = otbr::DBus::OTBR_TELEMETRY_STATE;
+    telemetry.mDeviceRole                = "router";
+    telemetry.mPartitionId               = 0x12345678;
+    telemetry.mRloc16                    = 0x0400;
+    telemetry.mLeaderData                = {1, 2, 3, 4, 5};
+    telemetry.mLinkCounters.mTxTotal     = 100;
+    telemetry.mChannelMonitorSampleCount = 50;
+
+    // A newer version appends a field to the struct, followed here by another argument.
+    auto fields = std::make_tuple(telemetry.mVersion, telemetry.mFields, telemetry.mDeviceRole, telemetry.mPartitionId,
+                                  telemetry.mRloc16, telemetry.mLeaderData, telemetry.mChildTable,
+                                  telemetry.mNeighborTable, telemetry.mNetworkData, telemetry.mStableNetworkData,
+                                  telemetry.mLinkCounters, telemetry.mIp6Counters, telemetry.mChannelMonitorSampleCount,
+                                  telemetry.mChannelQualities, std::string("new field"));
+
+    dbus_message_iter_init_append(msg, &iter);
+    CHECK(dbus_message_iter_open_container(&iter, DBUS_TYPE_STRUCT, nullptr, &sub));
+    CHECK(otbr::DBus::ConvertToDBusMessage(&sub, fields) == OTBR_ERROR_NONE);
+    CHECK(dbus_message_iter_close_container(&iter, &sub));
+    CHECK(DBusMessageEncode(&iter, uint32_t(0xdeadbeef)) == OTBR_ERROR_NONE);
+
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK_EQUAL(telemetry.mVersion, decoded.mVersion);
+    CHECK_EQUAL(telemetry.mFields, decoded.mFields);
+    CHECK(telemetry.mDeviceRole == decoded.mDeviceRole);
+    CHECK_EQUAL(telemetry.mPartitionId, decoded.mPartitionId);
+    CHECK_EQUAL(telemetry.mRloc16, decoded.mRloc16);
+    CHECK(telemetry.mLeaderData == decoded.mLeaderData);
+    CHECK_EQUAL(100, decoded.mLinkCounters.mTxTotal);
+    CHECK_EQUAL(telemetry.mChannelMonitorSampleCount, decoded.mChannelMonitorSampleCount);
+    CHECK_EQUAL(0xdeadbeef, std::get<1>(getVals));
+
+    dbus_message_unref(msg);
+}
+
+constexpr bool SignatureEqual(const char *aLhs, const char *aRhs)
+{
+    return *aLhs == *aRhs && (*aLhs == '\0' || SignatureEqual(aLhs + 1, aRhs + 1));
+}
+
+static_assert(SignatureEqual(otbr::DBus::DBusTypeTrait<vector<uint8_t>>::TYPE_AS_STRING, "ay"), "");
+static_assert(SignatureEqual(otbr::DBus::DBusTypeTrait<array<uint8_t, 8>>::TYPE_AS_STRING, "ay"), "");
+static_assert(SignatureEqual(otbr::DBus::DBusTypeTrait<vector<vector<uint32_t>>>::TYPE_AS_STRING, "aau"), "");
+static_assert(SignatureEqual(otbr::DBus::DBusTypeTrait<vector<otbr::DBus::ChannelQuality>>::TYPE_AS_STRING, "a(yq)"),
+              "");
+
+TEST(DBusMessage, TestArraySignature)
+{
+    STRCMP_EQUAL("a(yus)", otbr::DBus::DBusTypeTrait<vector<TestStruct>>::TYPE_AS_STRING);
+    STRCMP_EQUAL("a((ayy)qybb)", otbr::DBus::DBusTypeTrait<vector<otbr::DBus::ExternalRoute>>::TYPE_AS_STRING);
+    STRCMP_EQUAL("a(tuquuyyyqqbbbbb)", otbr::DBus::DBusTypeTrait<vector<otbr::DBus::NeighborInfo>>::TYPE_AS_STRING);
+    STRCMP_EQUAL("a(tuuqqyyyyqqbbbbb)", otbr::DBus::DBusTypeTrait<vector<otbr::DBus::ChildInfo>>::TYPE_AS_STRING);
+    STRCMP_EQUAL("as", otbr::DBus::DBusTypeTrait<vector<string>>::TYPE_AS_STRING);
+}
+
+TEST(DBusMessage, TestFixedArrayMessage)
+{
+    DBusMessage *    msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    vector<uint8_t>  bytes(1024);
+    vector<uint64_t> words(256);
+    tuple<vector<uint8_t>, vector<uint64_t>, vector<uint16_t>> getVals({9, 9}, {}, {9});
+    DBusMessageIter  iter;
+
+    CHECK(msg != NULL);
+
+    for (size_t i = 0; i < bytes.size(); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+    for (size_t i = 0; i < words.size(); i++)
+    {
+        words[i] = 0x0102030405060708ULL * i;
+    }
+
+    CHECK(TupleToDBusMessage(*msg, std::make_tuple(bytes, words, vector<uint16_t>())) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(bytes == std::get<0>(getVals));
+    CHECK(words == std::get<1>(getVals));
+    // Extracting an empty array must not leave the previous content.
+    CHECK(std::get<2>(getVals).empty());
+
+    // An array of the wrong size does not fit a fixed size array.
+    {
+        array<uint8_t, 4> fixed;
+
+        CHECK(dbus_message_iter_init(msg, &iter));
+        CHECK(DBusMessageExtract(&iter, fixed) == OTBR_ERROR_DBUS);
+    }
+
+    dbus_message_unref(msg);
+}
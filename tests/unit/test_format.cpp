@@ -0,0 +1,178 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/format.hpp"
+#include "utils/hex.hpp"
+
+using otbr::Format::StringBuilder;
+
+TEST_GROUP(Format){};
+
+TEST(Format, TestEncodeDecodeHex)
+{
+    uint8_t bytes[256];
+    uint8_t decoded[256];
+    char    hex[sizeof(bytes) * 2 + 1];
+    char    expected[3];
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    CHECK(otbr::Format::EncodeHex(bytes, sizeof(bytes), hex) == hex + sizeof(hex) - 1);
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        snprintf(expected, sizeof(expected), "%02x", bytes[i]);
+        CHECK(memcmp(expected, &hex[i * 2], 2) == 0);
+    }
+    CHECK_EQUAL(sizeof(bytes), otbr::Format::DecodeHex(hex, strlen(hex), decoded, sizeof(decoded)));
+    MEMCMP_EQUAL(bytes, decoded, sizeof(bytes));
+
+    otbr::Format::EncodeHex(bytes, sizeof(bytes), hex, otbr::Format::kUpperCase);
+    STRNCMP_EQUAL("00010203", hex, 8);
+    STRNCMP_EQUAL("FAFBFCFDFEFF", hex + sizeof(hex) - 13, 12);
+    CHECK_EQUAL(sizeof(bytes), otbr::Format::DecodeHex(hex, strlen(hex), decoded, sizeof(decoded)));
+    MEMCMP_EQUAL(bytes, decoded, sizeof(bytes));
+}
+
+TEST(Format, TestDecodeHexInvalid)
+{
+    const uint8_t kExpected[] = {0x0a, 0xbc};
+    uint8_t       bytes[2];
+
+    CHECK_EQUAL(2, otbr::Format::DecodeHex("abc", 3, bytes, sizeof(bytes)));
+    MEMCMP_EQUAL(kExpected, bytes, sizeof(kExpected));
+    CHECK_EQUAL(0, otbr::Format::DecodeHex("", 0, bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Format::DecodeHex("abcde", 5, bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Format::DecodeHex("0g", 2, bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Format::DecodeHex("g0", 2, bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Format::DecodeHex("x", 1, bytes, sizeof(bytes)));
+    CHECK_EQUAL(-1, otbr::Format::DecodeHex("00 1", 4, bytes, sizeof(bytes)));
+}
+
+TEST(Format, TestHexUtils)
+{
+    const uint8_t kBytes[] = {0xde, 0xad, 0xbe, 0xef};
+    uint8_t       bytes[sizeof(kBytes)];
+    char          hex[17];
+
+    CHECK_EQUAL(8, otbr::Utils::Bytes2Hex(kBytes, sizeof(kBytes), hex));
+    STRCMP_EQUAL("DEADBEEF", hex);
+    CHECK_EQUAL(4, otbr::Utils::Hex2Bytes("deadBEEF", bytes, sizeof(bytes)));
+    MEMCMP_EQUAL(kBytes, bytes, sizeof(kBytes));
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("deadbeef00", bytes, sizeof(bytes)));
+    CHECK_EQUAL(16, otbr::Utils::Long2Hex(0x0123456789abcdefULL, hex));
+    STRCMP_EQUAL("EFCDAB8967452301", hex);
+}
+
+TEST(Format, TestFormatIntegers)
+{
+    const int64_t kSigned[] = {0, 1, -1, 9, 10, -99, 100, 12345, -32768, 2147483647, INT64_MAX, INT64_MIN};
+    char          text[24];
+    char          expected[24];
+
+    for (size_t i = 0; i < sizeof(kSigned) / sizeof(kSigned[0]); i++)
+    {
+        snprintf(expected, sizeof(expected), "%lld", static_cast<long long>(kSigned[i]));
+        CHECK(otbr::Format::FormatSigned(kSigned[i], text) == text + strlen(expected));
+        STRCMP_EQUAL(expected, text);
+    }
+
+    for (uint64_t value = 1; value < UINT64_MAX / 7; value *= 7)
+    {
+        snprintf(expected, sizeof(expected), "%llu", static_cast<unsigned long long>(value - 1));
+        otbr::Format::FormatUnsigned(value - 1, text);
+        STRCMP_EQUAL(expected, text);
+    }
+    otbr::Format::FormatUnsigned(UINT64_MAX, text);
+    STRCMP_EQUAL("18446744073709551615", text);
+
+    otbr::Format::FormatHex(0, 0, text);
+    STRCMP_EQUAL("0", text);
+    otbr::Format::FormatHex(0xabc, 4, text);
+    STRCMP_EQUAL("0abc", text);
+    otbr::Format::FormatHex(0xabc, 2, text, otbr::Format::kUpperCase);
+    STRCMP_EQUAL("ABC", text);
+    otbr::Format::FormatHex(UINT64_MAX, 0, text);
+    STRCMP_EQUAL("ffffffffffffffff", text);
+}
+
+TEST(Format, TestStringBuilder)
+{
+    const uint8_t kBytes[] = {0x01, 0xab, 0xff};
+    char          buffer[64];
+    StringBuilder builder(buffer, sizeof(buffer));
+
+    STRCMP_EQUAL("", builder.GetString());
+    builder.Append("0x").AppendHex(0x1f, 4).AppendChar(' ').AppendSigned(-42, 5).AppendChar('|');
+    builder.AppendUnsigned(7, 3).AppendChar('|').AppendHex(0x12, 20).AppendChar('|');
+    builder.AppendHexBytes(kBytes, sizeof(kBytes), ':', otbr::Format::kUpperCase);
+    STRCMP_EQUAL("0x001f   -42|  7|00000000000000000012|01:AB:FF", builder.GetString());
+    CHECK_EQUAL(strlen(buffer), builder.GetLength());
+    CHECK(!builder.IsTruncated());
+}
+
+TEST(Format, TestStringBuilderTruncated)
+{
+    const uint8_t kBytes[] = {0x01, 0x23, 0x45, 0x67};
+    char          buffer[8];
+
+    {
+        StringBuilder builder(buffer, sizeof(buffer));
+
+        builder.Append("abc").AppendUnsigned(123456);
+        STRCMP_EQUAL("abc1234", buffer);
+        CHECK_EQUAL(7, builder.GetLength());
+        CHECK(builder.IsTruncated());
+
+        builder.AppendChar('x');
+        STRCMP_EQUAL("abc1234", buffer);
+    }
+
+    {
+        StringBuilder builder(buffer, sizeof(buffer));
+
+        builder.AppendHexBytes(kBytes, sizeof(kBytes), ' ');
+        STRCMP_EQUAL("01 23 4", buffer);
+        CHECK(builder.IsTruncated());
+    }
+
+    {
+        StringBuilder builder(buffer, 1);
+
+        builder.AppendChar('x');
+        STRCMP_EQUAL("", buffer);
+        CHECK(builder.IsTruncated());
+    }
+}
@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <vector>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/select.h>
+
+#include "commissioner/joiner_session_manager.hpp"
+#include "commissioner/simulated_joiner.hpp"
+#include "common/time.hpp"
+
+using namespace otbr;
+
+static const char kPskd[] = "J01NME";
+
+static void RelayReceive(SimulatedJoiner &aJoiner, JoinerSessionManager &aManager)
+{
+    const std::vector<uint8_t> *record;
+    JoinerRelayInfo             info;
+
+    memcpy(info.mIid, aJoiner.GetIid(), sizeof(info.mIid));
+    info.mUdpPort       = 1000;
+    info.mRouterLocator = 0x0400;
+
+    while ((record = aJoiner.GetNextRecord()) != NULL)
+    {
+        otbrError error = aManager.HandleRelayReceive(info, record->data(), static_cast<uint16_t>(record->size()));
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            // Too many joiners in progress, the record is sent again later as a DTLS retransmission would be.
+            CHECK_EQUAL(EBUSY, errno);
+            break;
+        }
+        aJoiner.PopRecord();
+    }
+}
+
+static void HandleRelayTransmit(const JoinerRelayInfo &aJoiner,
+                                const uint8_t *        aBuffer,
+                                uint16_t               aLength,
+                                const uint8_t *        aKek,
+                                void *                 aContext)
+{
+    std::vector<SimulatedJoiner *> &joiners = *static_cast<std::vector<SimulatedJoiner *> *>(aContext);
+
+    for (size_t i = 0; i < joiners.size(); i++)
+    {
+        if (memcmp(joiners[i]->GetIid(), aJoiner.mIid, sizeof(aJoiner.mIid)) == 0)
+        {
+            joiners[i]->HandleRelayTransmit(aBuffer, aLength, aKek != NULL);
+        }
+    }
+}
+
+static void CommissionJoiners(int aNumJoiners, int aMaxSessions)
+{
+    std::vector<SimulatedJoiner *> joiners;
+    JoinerSessionManager           manager(HandleRelayTransmit, &joiners, aMaxSessions, 30);
+    unsigned long                  deadline = GetNow() + 60 * 1000;
+    bool                           done     = false;
+
+    manager.SetPskd(kPskd);
+
+    for (int i = 0; i < aNumJoiners; i++)
+    {
+        const uint8_t eui64[] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, static_cast<uint8_t>(i + 1)};
+
+        joiners.push_back(new SimulatedJoiner(eui64, kPskd));
+        CHECK_EQUAL(OTBR_ERROR_NONE, joiners.back()->Start());
+    }
+
+    while (!done && static_cast<long>(deadline - GetNow()) > 0)
+    {
+        int     maxFd   = -1;
+        timeval timeout = {0, 100000};
+        fd_set  readFdSet;
+        fd_set  writeFdSet;
+        fd_set  errorFdSet;
+
+        for (size_t i = 0; i < joiners.size(); i++)
+        {
+            joiners[i]->Run();
+            RelayReceive(*joiners[i], manager);
+        }
+
+        FD_ZERO(&readFdSet);
+        FD_ZERO(&writeFdSet);
+        FD_ZERO(&errorFdSet);
+        manager.UpdateFdSet(readFdSet, writeFdSet, errorFdSet, maxFd, timeout);
+        CHECK(select(maxFd + 1, &readFdSet, &writeFdSet, &errorFdSet, &timeout) >= 0);
+        manager.Process(readFdSet, writeFdSet, errorFdSet);
+
+        done = true;
+        for (size_t i = 0; i < joiners.size(); i++)
+        {
+            done = done && joiners[i]->GetState() == SimulatedJoiner::kStateFinalized;
+        }
+    }
+
+    CHECK(done);
+    CHECK_EQUAL(aNumJoiners, manager.GetNumFinalizedJoiners());
+    CHECK_EQUAL(aNumJoiners < aMaxSessions ? aNumJoiners : aMaxSessions, manager.GetPeakNumSessions());
+
+    for (int phase = 0; phase < JoinerMetrics::kNumPhases; phase++)
+    {
+        const LatencyHistogram &histogram = manager.GetMetrics().GetHistogram(static_cast<JoinerMetrics::Phase>(phase));
+
+        CHECK_EQUAL(static_cast<unsigned long>(aNumJoiners), histogram.GetCount());
+        CHECK_EQUAL(0UL, manager.GetMetrics().GetNumFailed(static_cast<JoinerMetrics::Phase>(phase)));
+    }
+
+    for (size_t i = 0; i < joiners.size(); i++)
+    {
+        delete joiners[i];
+    }
+}
+
+TEST_GROUP(JoinerSessionManager){};
+
+TEST(JoinerSessionManager, TestCommissionJoinersInParallel)
+{
+    CommissionJoiners(4, 8);
+}
+
+TEST(JoinerSessionManager, TestCommissionJoinersOverCap)
+{
+    CommissionJoiners(5, 2);
+}
+
+TEST(JoinerSessionManager, TestLatencyHistogram)
+{
+    LatencyHistogram histogram;
+
+    CHECK_EQUAL(0UL, histogram.GetPercentile(50));
+
+    for (unsigned long value = 1; value <= 100; value++)
+    {
+        histogram.Add(value);
+    }
+    histogram.Add(1000000);
+
+    CHECK_EQUAL(101UL, histogram.GetCount());
+    CHECK_EQUAL(1UL, histogram.GetMin());
+    CHECK_EQUAL(1000000UL, histogram.GetMax());
+    CHECK_EQUAL(64UL, histogram.GetPercentile(50));
+    CHECK_EQUAL(128UL, histogram.GetPercentile(99));
+    CHECK_EQUAL(1000000UL, histogram.GetPercentile(100));
+    CHECK_EQUAL(1UL, histogram.GetBucketCount(LatencyHistogram::kNumBuckets - 1));
+}
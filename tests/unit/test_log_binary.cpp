@@ -0,0 +1,137 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/log_binary.hpp"
+
+TEST_GROUP(BinaryLog){};
+
+template <typename... Args> static const char *Format(char *aOutput, size_t aSize, const char *aFormat, Args... aArgs)
+{
+    otbr::BinaryLog::ArgsEncoder encoder;
+
+    encoder.Add(aArgs...);
+    otbr::BinaryLog::FormatArgs(aFormat, encoder.GetArgs(), encoder.GetLength(), aOutput, aSize);
+
+    return aOutput;
+}
+
+TEST(BinaryLog, TestFormatIntegers)
+{
+    char     text[128];
+    char     expected[128];
+    uint64_t big = 0x123456789abcdef0ULL;
+
+    STRCMP_EQUAL("DTLS session[3] alive.", Format(text, sizeof(text), "DTLS session[%d] alive.", 3));
+    STRCMP_EQUAL("-42 42 4294967295", Format(text, sizeof(text), "%d %u %u", -42, 42U, 0xffffffffU));
+    STRCMP_EQUAL("port 49191 level 7", Format(text, sizeof(text), "port %hu level %hhu", uint16_t(49191), char(7)));
+    STRCMP_EQUAL("0x00ab|  -5|-5  |052", Format(text, sizeof(text), "0x%04x|%4d|%-4d|%#o", 0xab, -5, -5, 42));
+
+    sprintf(expected, "%llx %lld", static_cast<unsigned long long>(big), -1LL);
+    STRCMP_EQUAL(expected, Format(text, sizeof(text), "%llx %lld", big, -1LL));
+    STRCMP_EQUAL("A", Format(text, sizeof(text), "%c", 'A'));
+}
+
+TEST(BinaryLog, TestFormatOthers)
+{
+    char        text[128];
+    char        expected[128];
+    int         value   = 0;
+    void *      pointer = &value;
+    const char *null    = NULL;
+
+    STRCMP_EQUAL("3.14 1.5e+00", Format(text, sizeof(text), "%.2f %.1e", 3.14159, 1.5f));
+    STRCMP_EQUAL("[joiner  ] (null)", Format(text, sizeof(text), "[%-8s] %s", "joiner", null));
+    STRCMP_EQUAL("100% done", Format(text, sizeof(text), "100%% done"));
+
+    sprintf(expected, "%p", pointer);
+    STRCMP_EQUAL(expected, Format(text, sizeof(text), "%p", pointer));
+}
+
+TEST(BinaryLog, TestFormatMismatch)
+{
+    char text[128];
+
+    // Arguments missing or of an unexpected type are printed as '?'.
+    STRCMP_EQUAL("1 ? ?", Format(text, sizeof(text), "%d %d %s", 1));
+    STRCMP_EQUAL("? 2", Format(text, sizeof(text), "%s %d", 1, 2));
+    STRCMP_EQUAL("?", Format(text, sizeof(text), "%f", "string"));
+    STRCMP_EQUAL("trailing ?", Format(text, sizeof(text), "trailing %", 1));
+
+    // The output is truncated like snprintf().
+    STRCMP_EQUAL("12345", Format(text, 6, "%d%s", 123, "456789"));
+}
+
+TEST(BinaryLog, TestArgsTruncated)
+{
+    char                         text[otbr::BinaryLog::kMaxArgsLength * 2];
+    char                         longString[otbr::BinaryLog::kMaxArgsLength * 2];
+    otbr::BinaryLog::ArgsEncoder encoder;
+
+    memset(longString, 'a', sizeof(longString) - 1);
+    longString[sizeof(longString) - 1] = '\0';
+
+    // Strings are truncated to fit, and the arguments after them are dropped.
+    encoder.Add(1, longString, 2);
+    CHECK_EQUAL(otbr::BinaryLog::kMaxArgsLength, encoder.GetLength());
+    otbr::BinaryLog::FormatArgs("%d %s %d", encoder.GetArgs(), encoder.GetLength(), text, sizeof(text));
+    CHECK_EQUAL(otbr::BinaryLog::kMaxArgsLength - 9 - 3 + 2 + 2, strlen(text));
+    STRNCMP_EQUAL("1 aaa", text, 5);
+    STRCMP_EQUAL("a ?", text + strlen(text) - 3);
+}
+
+TEST(BinaryLog, TestRegisterFormat)
+{
+    static const char kFormat[] = "registered %d";
+    uint16_t          id        = otbr::BinaryLog::RegisterFormat(kFormat);
+
+    CHECK(id != 0);
+    CHECK(otbr::BinaryLog::GetFormat(id) == kFormat);
+    CHECK(otbr::BinaryLog::RegisterFormat(kFormat) != id);
+    CHECK(otbr::BinaryLog::GetFormat(0) == NULL);
+    CHECK(otbr::BinaryLog::GetFormat(otbr::BinaryLog::kMaxFormats - 1) == NULL);
+}
+
+TEST(BinaryLog, TestEncodeHeaders)
+{
+    const uint8_t kFormatHeader[] = {otbr::BinaryLog::kEntryFormat, 0x34, 0x12, 0x0d, 0x00};
+    const uint8_t kRecordHeader[] = {
+        otbr::BinaryLog::kEntryRecord, 0x01, 0x00, 0x06, 0x04, 0x03, 0x02, 0x01, 0x22, 0x00,
+    };
+    uint8_t       header[otbr::BinaryLog::kRecordHeaderSize];
+
+    otbr::BinaryLog::EncodeFormatHeader(0x1234, 13, header);
+    MEMCMP_EQUAL(kFormatHeader, header, otbr::BinaryLog::kFormatHeaderSize);
+
+    otbr::BinaryLog::EncodeRecordHeader(1, 6, 0x01020304, 34, header);
+    MEMCMP_EQUAL(kRecordHeader, header, otbr::BinaryLog::kRecordHeaderSize);
+}
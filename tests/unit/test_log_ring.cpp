@@ -0,0 +1,200 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/log_ring.hpp"
+
+using otbr::LogRing;
+
+static bool Push(LogRing &aRing, int aLevel, const char *aFormat, ...)
+{
+    va_list args;
+    bool    queued;
+
+    va_start(args, aFormat);
+    queued = aRing.Push(aLevel, 0, 0, aFormat, args);
+    va_end(args);
+
+    return queued;
+}
+
+TEST_GROUP(LogRing){};
+
+TEST(LogRing, TestOrder)
+{
+    LogRing          ring(6);
+    LogRing::Record *records[8];
+    int              next = 0;
+
+    CHECK_EQUAL(8, ring.GetCapacity());
+
+    // Several laps around the ring, read in batches of various sizes.
+    for (int lap = 0; lap < 5; lap++)
+    {
+        size_t count;
+
+        for (int i = 0; i < lap + 3; i++)
+        {
+            CHECK(Push(ring, i % 8, "record %d", next + i));
+        }
+
+        count = ring.Read(records, 8);
+        CHECK_EQUAL(static_cast<size_t>(lap + 3), count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            char expected[32];
+
+            snprintf(expected, sizeof(expected), "record %d", next++);
+            STRCMP_EQUAL(expected, records[i]->mText);
+            CHECK_EQUAL(strlen(expected), records[i]->mLength);
+            CHECK_EQUAL(i % 8, records[i]->mLevel);
+        }
+
+        ring.Release(count);
+        CHECK_EQUAL(0, ring.Read(records, 8));
+    }
+
+    CHECK_EQUAL(ring.GetPushedCount(), ring.GetReleasedCount());
+    CHECK_EQUAL(0, ring.GetDroppedCount());
+}
+
+TEST(LogRing, TestOverflowDrop)
+{
+    LogRing          ring(4, LogRing::kOverflowDrop);
+    LogRing::Record *records[4];
+
+    for (int i = 0; i < 10; i++)
+    {
+        CHECK_EQUAL(i < 4, Push(ring, 0, "%d", i));
+    }
+    CHECK_EQUAL(6, ring.GetDroppedCount());
+
+    // The oldest records are kept.
+    CHECK_EQUAL(4, ring.Read(records, 4));
+    STRCMP_EQUAL("0", records[0]->mText);
+    STRCMP_EQUAL("3", records[3]->mText);
+
+    // Only the records not read yet are released.
+    ring.Release(2);
+    CHECK(Push(ring, 0, "%d", 10));
+    CHECK(Push(ring, 0, "%d", 11));
+    CHECK(!Push(ring, 0, "%d", 12));
+    CHECK_EQUAL(7, ring.GetDroppedCount());
+
+    CHECK_EQUAL(4, ring.Read(records, 4));
+    STRCMP_EQUAL("2", records[0]->mText);
+    STRCMP_EQUAL("11", records[3]->mText);
+}
+
+TEST(LogRing, TestTruncated)
+{
+    LogRing          ring(1);
+    LogRing::Record *record;
+    std::string      text(LogRing::kMaxTextLength + 10, 'x');
+
+    CHECK(Push(ring, 0, "%s", text.c_str()));
+    CHECK_EQUAL(1, ring.Read(&record, 1));
+    CHECK_EQUAL(LogRing::kMaxTextLength, record->mLength);
+    CHECK_EQUAL(LogRing::kMaxTextLength, strlen(record->mText));
+}
+
+TEST(LogRing, TestClose)
+{
+    LogRing ring(2, LogRing::kOverflowBlock);
+    bool    queued = true;
+
+    CHECK(Push(ring, 0, "a"));
+    CHECK(Push(ring, 0, "b"));
+
+    // A producer blocked on the full ring gives up when it is closed.
+    std::thread producer([&ring, &queued]() { queued = Push(ring, 0, "c"); });
+
+    ring.Close();
+    producer.join();
+    CHECK(!queued);
+    CHECK_EQUAL(1, ring.GetDroppedCount());
+    CHECK_EQUAL(2, ring.GetPushedCount());
+}
+
+TEST(LogRing, TestMultipleProducers)
+{
+    static const int kNumProducers = 4;
+    static const int kNumRecords   = 20000;
+
+    LogRing                  ring(64, LogRing::kOverflowBlock);
+    std::vector<std::thread> producers;
+    int                      next[kNumProducers] = {0};
+    int                      total               = 0;
+
+    for (int i = 0; i < kNumProducers; i++)
+    {
+        producers.push_back(std::thread([&ring, i]() {
+            for (int j = 0; j < kNumRecords; j++)
+            {
+                Push(ring, i, "%d", j);
+            }
+        }));
+    }
+
+    while (total < kNumProducers * kNumRecords)
+    {
+        LogRing::Record *records[16];
+        size_t           count = ring.Read(records, 16);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            // Records of each producer are read in the order it pushed them.
+            CHECK_EQUAL(next[records[i]->mLevel]++, atoi(records[i]->mText));
+        }
+
+        ring.Release(count);
+        total += static_cast<int>(count);
+    }
+
+    for (size_t i = 0; i < producers.size(); i++)
+    {
+        producers[i].join();
+    }
+
+    CHECK_EQUAL(0, ring.GetDroppedCount());
+    for (int i = 0; i < kNumProducers; i++)
+    {
+        CHECK_EQUAL(kNumRecords, next[i]);
+    }
+}
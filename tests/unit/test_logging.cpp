@@ -29,6 +29,7 @@
 #include <CppUTest/TestHarness.h>
 
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -110,3 +111,247 @@ TEST(Logging, TestLoggingDump)
     sprintf(cmd, "grep '%s.*: foobar: 0020: 6f 66 20 74 65 78 74 00' /var/log/syslog", ident);
     CHECK(0 == system(cmd));
 }
+
+static void DumpLimited(const uint8_t *aMemory, size_t aSize)
+{
+    otbrDump(OTBR_LOG_INFO, "cool-dump", aMemory, aSize);
+}
+
+TEST(Logging, TestLoggingDumpLimits)
+{
+    static const char *const kExpected[] = {
+        "| cool-dump: 0000: 00 01 02 03\n",
+        "| cool-dump: 4 bytes truncated\n",
+        "| cool-dump: 0000: 00 01 02 03\n",
+        "| cool-dump: 4 bytes truncated\n",
+        "| cool-dump: 3 dumps suppressed\n",
+        "| cool-dump: 0000: 00 01 02 03 04 05 06 07\n",
+        "| cool-dump: 2 dumps suppressed\n",
+        "| cool-dump: 0000: 00 01 02 03 04 05 06 07\n",
+    };
+    const uint8_t kMemory[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    char          ident[32];
+    char          path[64];
+    char          line[128];
+    FILE *        fp;
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    sprintf(path, "/tmp/%s.log", ident);
+    otbrLogSetFilename(path);
+    otbrLogInit(ident, OTBR_LOG_INFO, false);
+    otbrLogEnableSyslog(false);
+
+    // A burst of two, truncated to 4 bytes.
+    otbrDumpSetLimits(1, 2, 1, 4);
+    for (int i = 0; i < 5; i++)
+    {
+        DumpLimited(kMemory, sizeof(kMemory));
+    }
+
+    // One out of three, with the suppressed dumps reported before the next written one.
+    otbrDumpSetLimits(0, 1, 3, 0);
+    for (int i = 0; i < 4; i++)
+    {
+        DumpLimited(kMemory, sizeof(kMemory));
+    }
+
+    fp = fopen(path, "r");
+    CHECK(fp != NULL);
+    for (const char *expected : kExpected)
+    {
+        CHECK(fgets(line, sizeof(line), fp) != NULL);
+        CHECK(strstr(line, expected) != NULL);
+    }
+    CHECK(fgets(line, sizeof(line), fp) == NULL);
+    fclose(fp);
+
+    otbrDumpSetLimits(0, 1, 1, 0);
+    otbrLogEnableSyslog(true);
+    otbrLogDeinit();
+    remove(path);
+}
+
+TEST(Logging, TestLoggingAsyncFile)
+{
+    char  ident[32];
+    char  path[64];
+    char  line[128];
+    FILE *fp;
+    int   next = 0;
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    sprintf(path, "/tmp/%s.log", ident);
+    otbrLogSetFilename(path);
+    otbrLogInit(ident, OTBR_LOG_INFO, false);
+    otbrLogEnableSyslog(false);
+    otbrLogEnableAsync(16, OTBR_LOG_OVERFLOW_BLOCK);
+
+    for (int i = 0; i < 100; i++)
+    {
+        otbrLog(OTBR_LOG_INFO, "cool-async %d", i);
+        otbrLog(OTBR_LOG_DEBUG, "cool-async-debug %d", i);
+    }
+    otbrLogFlush();
+
+    // Logs are written in order, and the level also applies to the log file.
+    fp = fopen(path, "r");
+    CHECK(fp != NULL);
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        char expected[32];
+
+        sprintf(expected, "| cool-async %d\n", next++);
+        CHECK(strstr(line, expected) != NULL);
+    }
+    fclose(fp);
+    CHECK_EQUAL(100, next);
+    CHECK_EQUAL(0, otbrLogGetDroppedCount());
+
+    otbrLogEnableSyslog(true);
+    otbrLogDeinit();
+    remove(path);
+}
+
+TEST(Logging, TestLoggingAsyncOverflow)
+{
+    char ident[32];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, false);
+    otbrLogEnableAsync(4, OTBR_LOG_OVERFLOW_DROP);
+
+    // The writer sleeps until the buffer is half full, so the burst overflows it.
+    for (int i = 0; i < 1000; i++)
+    {
+        otbrLog(OTBR_LOG_INFO, "cool-overflow %d", i);
+    }
+    otbrLogFlush();
+    CHECK(otbrLogGetDroppedCount() > 0);
+    CHECK(otbrLogGetDroppedCount() < 1000);
+
+    otbrLogDeinit();
+}
+
+TEST(Logging, TestLoggingDeferred)
+{
+    char  ident[32];
+    char  path[64];
+    char  line[128];
+    FILE *fp;
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    sprintf(path, "/tmp/%s.log", ident);
+    otbrLogSetFilename(path);
+    otbrLogInit(ident, OTBR_LOG_INFO, false);
+    otbrLogEnableSyslog(false);
+
+    // Formatted right away without the asynchronous logger, and by the writer thread with it.
+    otbrLogDeferred(OTBR_LOG_INFO, "cool-deferred %d %s", 1, "sync");
+    otbrLogEnableAsync(16, OTBR_LOG_OVERFLOW_BLOCK);
+    otbrLogDeferred(OTBR_LOG_INFO, "cool-deferred %d %s", 2, "async");
+    otbrLogDeferred(OTBR_LOG_DEBUG, "cool-deferred-debug %d", 3);
+    otbrLogFlush();
+
+    fp = fopen(path, "r");
+    CHECK(fp != NULL);
+    CHECK(fgets(line, sizeof(line), fp) != NULL);
+    CHECK(strstr(line, "| cool-deferred 1 sync\n") != NULL);
+    CHECK(fgets(line, sizeof(line), fp) != NULL);
+    CHECK(strstr(line, "| cool-deferred 2 async\n") != NULL);
+    CHECK(fgets(line, sizeof(line), fp) == NULL);
+    fclose(fp);
+
+    otbrLogEnableSyslog(true);
+    otbrLogDeinit();
+    remove(path);
+}
+
+TEST(Logging, TestLoggingDeferredBinary)
+{
+    char    ident[32];
+    char    path[64];
+    uint8_t content[1024];
+    size_t  length;
+    FILE *  fp;
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    sprintf(path, "/tmp/%s.bin", ident);
+    otbrLogSetBinaryFilename(path);
+    otbrLogInit(ident, OTBR_LOG_INFO, false);
+    otbrLogEnableSyslog(false);
+    otbrLogEnableAsync(16, OTBR_LOG_OVERFLOW_BLOCK);
+
+    for (int i = 0; i < 2; i++)
+    {
+        otbrLogDeferred(OTBR_LOG_INFO, "cool-binary %d", i);
+    }
+    otbrLogFlush();
+
+    fp = fopen(path, "rb");
+    CHECK(fp != NULL);
+    length = fread(content, 1, sizeof(content), fp);
+    fclose(fp);
+
+    // The magic, the format entry once, and two records of one integer each.
+    CHECK_EQUAL(sizeof(otbr::BinaryLog::kFileMagic) + otbr::BinaryLog::kFormatHeaderSize + strlen("cool-binary %d") +
+                    2 * (otbr::BinaryLog::kRecordHeaderSize + 9),
+                length);
+    MEMCMP_EQUAL(otbr::BinaryLog::kFileMagic, content, sizeof(otbr::BinaryLog::kFileMagic));
+    CHECK_EQUAL(otbr::BinaryLog::kEntryFormat, content[sizeof(otbr::BinaryLog::kFileMagic)]);
+
+    otbrLogEnableSyslog(true);
+    otbrLogDeinit();
+    remove(path);
+}
+
+TEST(Logging, TestLoggingModuleLevels)
+{
+    char  ident[32];
+    char  path[64];
+    char  line[128];
+    FILE *fp;
+    int   evaluated = 0;
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    sprintf(path, "/tmp/%s.log", ident);
+    otbrLogSetFilename(path);
+    otbrLogInit(ident, OTBR_LOG_INFO, false);
+    otbrLogEnableSyslog(false);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbrLogSetModuleLevels("dtls=7, coap=3\nmdns=6"));
+    CHECK_EQUAL(OTBR_LOG_DEBUG, otbrLogGetModuleLevel(OTBR_LOG_MODULE_DTLS));
+    CHECK_EQUAL(OTBR_LOG_ERR, otbrLogGetModuleLevel(OTBR_LOG_MODULE_COAP));
+    CHECK_EQUAL(OTBR_LOG_INFO, otbrLogGetModuleLevel(OTBR_LOG_MODULE_AGENT));
+    CHECK(otbrLogIsEnabled(OTBR_LOG_MODULE_DTLS, OTBR_LOG_DEBUG));
+    CHECK(!otbrLogIsEnabled(OTBR_LOG_MODULE_DEFAULT, OTBR_LOG_DEBUG));
+    STRCMP_EQUAL("dtls", otbrLogGetModuleName(OTBR_LOG_MODULE_DTLS));
+
+    // Nothing is changed by an invalid list.
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, otbrLogSetModuleLevels("coap=5,bogus=1"));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, otbrLogSetModuleLevels("coap=8"));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, otbrLogSetModuleLevels("coap=55"));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, otbrLogSetModuleLevels("coap"));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, otbrLogSetModuleLevels("=5"));
+    CHECK_EQUAL(OTBR_LOG_ERR, otbrLogGetModuleLevel(OTBR_LOG_MODULE_COAP));
+
+    // The arguments of disabled logs are not evaluated.
+    otbrLog(OTBR_LOG_DEBUG, "cool-module-default %d", ++evaluated);
+    CHECK_EQUAL(0, evaluated);
+    otbrLogModule(OTBR_LOG_MODULE_DTLS, OTBR_LOG_DEBUG, "cool-module-dtls");
+
+    fp = fopen(path, "r");
+    CHECK(fp != NULL);
+    CHECK(fgets(line, sizeof(line), fp) != NULL);
+    CHECK(strstr(line, "| cool-module-dtls\n") != NULL);
+    CHECK(fgets(line, sizeof(line), fp) == NULL);
+    fclose(fp);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbrLogSetModuleLevels("all=4"));
+    CHECK_EQUAL(OTBR_LOG_WARNING, otbrLogGetModuleLevel(OTBR_LOG_MODULE_NCP));
+    otbrLogSetLevel(OTBR_LOG_INFO);
+    CHECK_EQUAL(OTBR_LOG_INFO, otbrLogGetModuleLevel(OTBR_LOG_MODULE_DTLS));
+
+    otbrLogEnableSyslog(true);
+    otbrLogDeinit();
+    remove(path);
+}
@@ -0,0 +1,369 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <deque>
+#include <vector>
+
+#include <string.h>
+
+#include "agent/uris.hpp"
+#include "commissioner/management_client.hpp"
+
+using namespace otbr;
+
+/**
+ * This struct connects two CoAP agents, delivering the packets in flight one hop at a time.
+ *
+ */
+struct DelayedLoopback
+{
+    struct Packet
+    {
+        Coap::Agent *        mReceiver;
+        std::vector<uint8_t> mData;
+    };
+
+    Coap::Agent *      mClient;
+    Coap::Agent *      mServer;
+    bool               mDropRequests;
+    std::deque<Packet> mPackets;
+
+    void Push(Coap::Agent *aReceiver, const uint8_t *aBuffer, uint16_t aLength)
+    {
+        Packet packet;
+
+        packet.mReceiver = aReceiver;
+        packet.mData.assign(aBuffer, aBuffer + aLength);
+        mPackets.push_back(packet);
+    }
+
+    void DeliverHop(void)
+    {
+        // Packets sent while delivering this hop wait for the next one.
+        for (size_t count = mPackets.size(); count > 0; count--)
+        {
+            Packet packet = mPackets.front();
+
+            mPackets.pop_front();
+            packet.mReceiver->Input(packet.mData.data(), static_cast<uint16_t>(packet.mData.size()), NULL, 0);
+        }
+    }
+};
+
+static ssize_t SendFromClient(const uint8_t *aBuffer,
+                              uint16_t       aLength,
+                              const uint8_t *aIp6,
+                              uint16_t       aPort,
+                              void *         aContext)
+{
+    DelayedLoopback &loopback = *static_cast<DelayedLoopback *>(aContext);
+
+    if (!loopback.mDropRequests)
+    {
+        loopback.Push(loopback.mServer, aBuffer, aLength);
+    }
+
+    (void)aIp6;
+    (void)aPort;
+    return static_cast<ssize_t>(aLength);
+}
+
+static ssize_t SendFromServer(const uint8_t *aBuffer,
+                              uint16_t       aLength,
+                              const uint8_t *aIp6,
+                              uint16_t       aPort,
+                              void *         aContext)
+{
+    DelayedLoopback &loopback = *static_cast<DelayedLoopback *>(aContext);
+
+    loopback.Push(loopback.mClient, aBuffer, aLength);
+
+    (void)aIp6;
+    (void)aPort;
+    return static_cast<ssize_t>(aLength);
+}
+
+static void HandleActiveGet(const Coap::Resource &aResource,
+                            const Coap::Message & aRequest,
+                            Coap::Message &       aResponse,
+                            const uint8_t *       aIp6,
+                            uint16_t              aPort,
+                            void *                aContext)
+{
+    uint16_t       length;
+    const uint8_t *payload = aRequest.GetPayload(length);
+
+    // Echo the request so that the client can verify each response reaches its own request.
+    aResponse.SetCode(Coap::kCodeChanged);
+    aResponse.SetPayload(payload, length);
+
+    (void)aResource;
+    (void)aIp6;
+    (void)aPort;
+    (void)aContext;
+}
+
+struct RequestRecord
+{
+    uint8_t mIndex;
+    bool    mCompleted;
+    bool    mTimedOut;
+    bool    mMatched;
+};
+
+static void HandleResponse(const Coap::Message *aResponse, void *aContext)
+{
+    RequestRecord &record = *static_cast<RequestRecord *>(aContext);
+
+    record.mCompleted = true;
+
+    if (aResponse == NULL)
+    {
+        record.mTimedOut = true;
+    }
+    else
+    {
+        uint16_t       length;
+        const uint8_t *payload = aResponse->GetPayload(length);
+
+        record.mMatched = (length == sizeof(record.mIndex) && payload[0] == record.mIndex);
+    }
+}
+
+TEST_GROUP(ManagementClient)
+{
+    enum
+    {
+        kNumRequests = 8,
+    };
+
+    Coap::Agent *   client;
+    Coap::Agent *   server;
+    DelayedLoopback loopback;
+    RequestRecord   records[kNumRequests];
+
+    void setup()
+    {
+        client = Coap::Agent::Create(SendFromClient, &loopback);
+        server = Coap::Agent::Create(SendFromServer, &loopback);
+
+        loopback.mClient       = client;
+        loopback.mServer       = server;
+        loopback.mDropRequests = false;
+
+        for (uint8_t i = 0; i < kNumRequests; i++)
+        {
+            records[i].mIndex     = i;
+            records[i].mCompleted = false;
+            records[i].mTimedOut  = false;
+            records[i].mMatched   = false;
+        }
+    }
+
+    void teardown()
+    {
+        Coap::Agent::Destroy(server);
+        Coap::Agent::Destroy(client);
+    }
+
+    bool AllCompleted(void)
+    {
+        for (int i = 0; i < kNumRequests; i++)
+        {
+            if (!records[i].mCompleted)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    unsigned int RunRoundTrips(ManagementClient &aManagementClient)
+    {
+        unsigned int hops = 0;
+
+        for (int i = 0; i < kNumRequests; i++)
+        {
+            CHECK_EQUAL(OTBR_ERROR_NONE, aManagementClient.SendRequest(OT_URI_PATH_ACTIVE_GET, &records[i].mIndex,
+                                                                       sizeof(records[i].mIndex), HandleResponse,
+                                                                       &records[i]));
+        }
+
+        while (!AllCompleted() && hops < 4 * kNumRequests)
+        {
+            CHECK(aManagementClient.GetNumInFlight() <= aManagementClient.GetMaxInFlight());
+            loopback.DeliverHop();
+            hops++;
+        }
+
+        return hops / 2;
+    }
+};
+
+TEST(ManagementClient, TestWindowIsBounded)
+{
+    Coap::Resource   resource(OT_URI_PATH_ACTIVE_GET, HandleActiveGet, NULL);
+    ManagementClient managementClient(*client, 3);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, server->AddResource(resource));
+
+    for (int i = 0; i < kNumRequests; i++)
+    {
+        CHECK_EQUAL(OTBR_ERROR_NONE, managementClient.SendRequest(OT_URI_PATH_ACTIVE_GET, &records[i].mIndex,
+                                                                  sizeof(records[i].mIndex), HandleResponse,
+                                                                  &records[i]));
+    }
+
+    CHECK_EQUAL(3U, managementClient.GetNumInFlight());
+    CHECK_EQUAL(kNumRequests - 3U, managementClient.GetNumQueued());
+    CHECK_EQUAL(3U, loopback.mPackets.size());
+
+    // Widening the window sends queued requests immediately.
+    managementClient.SetMaxInFlight(5);
+    CHECK_EQUAL(5U, managementClient.GetNumInFlight());
+    CHECK_EQUAL(kNumRequests - 5U, managementClient.GetNumQueued());
+
+    managementClient.Clear();
+    CHECK_EQUAL(0U, managementClient.GetNumInFlight());
+    CHECK_EQUAL(0U, managementClient.GetNumQueued());
+
+    // Responses of dropped requests are ignored.
+    while (!loopback.mPackets.empty())
+    {
+        loopback.DeliverHop();
+    }
+    CHECK_EQUAL(false, records[0].mCompleted);
+}
+
+TEST(ManagementClient, TestResponsesMatchedByToken)
+{
+    Coap::Resource   resource(OT_URI_PATH_ACTIVE_GET, HandleActiveGet, NULL);
+    ManagementClient managementClient(*client, kNumRequests);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, server->AddResource(resource));
+    RunRoundTrips(managementClient);
+
+    for (int i = 0; i < kNumRequests; i++)
+    {
+        CHECK_EQUAL(true, records[i].mCompleted);
+        CHECK_EQUAL(false, records[i].mTimedOut);
+        CHECK_EQUAL(true, records[i].mMatched);
+    }
+    CHECK_EQUAL(0U, managementClient.GetNumInFlight());
+}
+
+TEST(ManagementClient, TestTimeout)
+{
+    // A zero timeout expires the requests in flight at every Process().
+    ManagementClient managementClient(*client, 2, 0);
+    unsigned int     numProcess = 0;
+
+    loopback.mDropRequests = true;
+
+    for (int i = 0; i < kNumRequests; i++)
+    {
+        CHECK_EQUAL(OTBR_ERROR_NONE, managementClient.SendRequest(OT_URI_PATH_ACTIVE_GET, &records[i].mIndex,
+                                                                  sizeof(records[i].mIndex), HandleResponse,
+                                                                  &records[i]));
+    }
+
+    while (!AllCompleted() && numProcess < kNumRequests)
+    {
+        managementClient.Process();
+        numProcess++;
+    }
+
+    // Each Process() expires the window and sends the next one.
+    CHECK_EQUAL(kNumRequests / 2U, numProcess);
+
+    for (int i = 0; i < kNumRequests; i++)
+    {
+        CHECK_EQUAL(true, records[i].mCompleted);
+        CHECK_EQUAL(true, records[i].mTimedOut);
+    }
+    CHECK_EQUAL(0U, managementClient.GetNumInFlight());
+    CHECK_EQUAL(0U, managementClient.GetNumQueued());
+}
+
+TEST(ManagementClient, TestNoTimeoutBeforeDeadline)
+{
+    ManagementClient managementClient(*client, 2);
+
+    loopback.mDropRequests = true;
+
+    for (int i = 0; i < kNumRequests; i++)
+    {
+        CHECK_EQUAL(OTBR_ERROR_NONE, managementClient.SendRequest(OT_URI_PATH_ACTIVE_GET, &records[i].mIndex,
+                                                                  sizeof(records[i].mIndex), HandleResponse,
+                                                                  &records[i]));
+    }
+
+    managementClient.Process();
+
+    CHECK_EQUAL(false, records[0].mCompleted);
+    CHECK_EQUAL(2U, managementClient.GetNumInFlight());
+    CHECK_EQUAL(kNumRequests - 2U, managementClient.GetNumQueued());
+}
+
+TEST(ManagementClient, TestSerialRoundTrips)
+{
+    Coap::Resource   resource(OT_URI_PATH_ACTIVE_GET, HandleActiveGet, NULL);
+    ManagementClient managementClient(*client, 1);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, server->AddResource(resource));
+
+    // Serial requests take one round trip each.
+    CHECK_EQUAL(static_cast<unsigned int>(kNumRequests), RunRoundTrips(managementClient));
+    CHECK_EQUAL(true, AllCompleted());
+}
+
+TEST(ManagementClient, TestWindowSharesRoundTrips)
+{
+    Coap::Resource   resource(OT_URI_PATH_ACTIVE_GET, HandleActiveGet, NULL);
+    ManagementClient managementClient(*client, 3);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, server->AddResource(resource));
+
+    // A window of three requests completes three requests per round trip.
+    CHECK_EQUAL((kNumRequests + 2U) / 3, RunRoundTrips(managementClient));
+    CHECK_EQUAL(true, AllCompleted());
+}
+
+TEST(ManagementClient, TestPipelineSharesRoundTrips)
+{
+    Coap::Resource   resource(OT_URI_PATH_ACTIVE_GET, HandleActiveGet, NULL);
+    ManagementClient managementClient(*client, kNumRequests);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, server->AddResource(resource));
+
+    CHECK_EQUAL(1U, RunRoundTrips(managementClient));
+    CHECK_EQUAL(true, AllCompleted());
+}
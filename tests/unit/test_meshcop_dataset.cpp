@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/tlv.hpp"
+#include "utils/meshcop_dataset.hpp"
+
+TEST_GROUP(MeshcopDataset){};
+
+TEST(MeshcopDataset, TestEncodeDecodeActiveDataset)
+{
+    const uint8_t kExtPanId[] = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+    const uint8_t kPskc[]     = {
+        0x3a, 0xa5, 0x5f, 0x91, 0xca, 0x47, 0xd1, 0xe4, 0xe7, 0x1a, 0x08, 0xcb, 0x35, 0xe9, 0x15, 0x91,
+    };
+    const uint8_t kMasterKey[] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+    };
+    const uint8_t kMeshLocalPrefix[] = {0xfd, 0x00, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00};
+
+    otbr::MeshcopDataset dataset;
+    otbr::MeshcopDataset decoded;
+    const uint8_t *      tlvs;
+    uint16_t             length;
+
+    dataset.SetActiveTimestamp(1);
+    dataset.SetChannel(15);
+    dataset.SetChannelMask(0x07fff800);
+    dataset.SetPanId(0x1234);
+    dataset.SetExtPanId(kExtPanId);
+    CHECK_EQUAL(OTBR_ERROR_NONE, dataset.SetNetworkName("OpenThread"));
+    dataset.SetPskc(kPskc);
+    dataset.SetMasterKey(kMasterKey);
+    dataset.SetMeshLocalPrefix(kMeshLocalPrefix);
+    dataset.SetSecurityPolicy(672, 0xf7);
+
+    tlvs = dataset.GetTlvs(length);
+    CHECK_EQUAL(OTBR_ERROR_NONE, decoded.Decode(tlvs, length));
+
+    CHECK(decoded.IsPresent(otbr::MeshcopDataset::kComponentActiveTimestamp));
+    CHECK(!decoded.IsPresent(otbr::MeshcopDataset::kComponentPendingTimestamp));
+    CHECK(!decoded.IsPresent(otbr::MeshcopDataset::kComponentDelayTimer));
+    CHECK_EQUAL(1, decoded.GetActiveTimestamp());
+    CHECK_EQUAL(15, decoded.GetChannel());
+    CHECK_EQUAL(0x07fff800, decoded.GetChannelMask());
+    CHECK_EQUAL(0x1234, decoded.GetPanId());
+    MEMCMP_EQUAL(kExtPanId, decoded.GetExtPanId(), sizeof(kExtPanId));
+    STRCMP_EQUAL("OpenThread", decoded.GetNetworkName());
+    MEMCMP_EQUAL(kPskc, decoded.GetPskc(), sizeof(kPskc));
+    MEMCMP_EQUAL(kMasterKey, decoded.GetMasterKey(), sizeof(kMasterKey));
+    MEMCMP_EQUAL(kMeshLocalPrefix, decoded.GetMeshLocalPrefix(), sizeof(kMeshLocalPrefix));
+    CHECK_EQUAL(672, decoded.GetRotationTime());
+    CHECK_EQUAL(0xf7, decoded.GetSecurityPolicyFlags());
+
+    {
+        uint16_t       decodedLength;
+        const uint8_t *decodedTlvs = decoded.GetTlvs(decodedLength);
+
+        CHECK_EQUAL(length, decodedLength);
+        MEMCMP_EQUAL(tlvs, decodedTlvs, length);
+    }
+}
+
+TEST(MeshcopDataset, TestEncodePendingDataset)
+{
+    // Pending Timestamp 0x10203 seconds, Delay Timer 30000ms and Channel 20 on page 0.
+    const uint8_t kExpected[] = {
+        0x00, 0x03, 0x00, 0x00, 0x14,                               // Channel
+        0x33, 0x08, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, // Pending Timestamp
+        0x34, 0x04, 0x00, 0x00, 0x75, 0x30,                         // Delay Timer
+        0x35, 0x06, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00,             // Channel Mask
+    };
+    otbr::MeshcopDataset dataset;
+    const uint8_t *      tlvs;
+    uint16_t             length;
+
+    dataset.SetDelayTimer(30000);
+    dataset.SetPendingTimestamp(0x10203);
+    dataset.SetChannelMask(1 << 20);
+    dataset.SetChannel(20);
+
+    tlvs = dataset.GetTlvs(length);
+    CHECK_EQUAL(sizeof(kExpected), length);
+    MEMCMP_EQUAL(kExpected, tlvs, length);
+}
+
+TEST(MeshcopDataset, TestCachedTlvsInvalidatedOnMutation)
+{
+    otbr::MeshcopDataset dataset;
+    const uint8_t *      tlvs;
+    uint16_t             length;
+
+    dataset.SetPanId(0xface);
+    tlvs = dataset.GetTlvs(length);
+    CHECK_EQUAL(4, length);
+    CHECK_EQUAL(otbr::Meshcop::kPanId, tlvs[0]);
+    CHECK_EQUAL(0xce, tlvs[3]);
+
+    dataset.SetPanId(0xbeef);
+    tlvs = dataset.GetTlvs(length);
+    CHECK_EQUAL(4, length);
+    CHECK_EQUAL(0xef, tlvs[3]);
+
+    dataset.Remove(otbr::MeshcopDataset::kComponentPanId);
+    dataset.GetTlvs(length);
+    CHECK_EQUAL(0, length);
+}
+
+TEST(MeshcopDataset, TestDecodeIgnoresUnknownTlv)
+{
+    const uint8_t kTlvs[] = {
+        0x01, 0x02, 0xab, 0xcd,           // PAN ID
+        0x80, 0x02, 0x00, 0x00,           // Unknown
+        0x03, 0x04, 'T',  'e',  's', 't', // Network Name
+    };
+    otbr::MeshcopDataset dataset;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, dataset.Decode(kTlvs, sizeof(kTlvs)));
+    CHECK_EQUAL(0xabcd, dataset.GetPanId());
+    STRCMP_EQUAL("Test", dataset.GetNetworkName());
+    CHECK(!dataset.IsPresent(otbr::MeshcopDataset::kComponentChannel));
+}
+
+TEST(MeshcopDataset, TestDecodeMalformed)
+{
+    const uint8_t        kTruncated[]    = {0x01, 0x02, 0xab};
+    const uint8_t        kShortChannel[] = {0x00, 0x02, 0x00, 0x0b};
+    uint8_t              longName[2 + otbr::kSizeNetworkName + 1];
+    otbr::MeshcopDataset dataset;
+
+    longName[0] = otbr::Meshcop::kNetworkName;
+    longName[1] = otbr::kSizeNetworkName + 1;
+    memset(&longName[2], 'a', otbr::kSizeNetworkName + 1);
+
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, dataset.Decode(kTruncated, sizeof(kTruncated)));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, dataset.Decode(kShortChannel, sizeof(kShortChannel)));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, dataset.Decode(longName, sizeof(longName)));
+    CHECK(!dataset.IsPresent(otbr::MeshcopDataset::kComponentPanId));
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, dataset.SetNetworkName("ThisNameIsTooLong"));
+}
@@ -30,9 +30,60 @@
 
 #include "utils/pskc.hpp"
 
+using otbr::Psk::Pskc;
+
+static const Pskc::Engine kEngines[] = {
+    Pskc::kEngineSoftware,
+    Pskc::kEngineAesNi,
+    Pskc::kEngineArmCrypto,
+};
+
+/**
+ * This function computes the PSKc the straightforward way, running the whole AES-CMAC-PRF-128 for each iteration.
+ *
+ */
+static void ComputeReferencePskc(const uint8_t *aExtPanId,
+                                 const char *   aNetworkName,
+                                 const char *   aPassphrase,
+                                 uint8_t *      aPskc)
+{
+    uint8_t prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t prfOutput[OT_PSKC_LENGTH];
+    size_t  saltLen = 0;
+
+    memcpy(prfInput, "Thread", 6);
+    saltLen += 6;
+    memcpy(prfInput + saltLen, aExtPanId, OT_EXTENDED_PAN_ID_LENGTH);
+    saltLen += OT_EXTENDED_PAN_ID_LENGTH;
+    memcpy(prfInput + saltLen, aNetworkName, strlen(aNetworkName));
+    saltLen += strlen(aNetworkName);
+    memcpy(prfInput + saltLen, "\x00\x00\x00\x01", 4);
+
+    mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
+                             saltLen + 4, prfOutput);
+    memcpy(aPskc, prfOutput, OT_PSKC_LENGTH);
+
+    for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
+    {
+        memcpy(prfInput, prfOutput, sizeof(prfOutput));
+        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
+                                 sizeof(prfOutput), prfOutput);
+
+        for (uint32_t j = 0; j < OT_PSKC_LENGTH; j++)
+        {
+            aPskc[j] ^= prfOutput[j];
+        }
+    }
+}
+
 TEST_GROUP(Pskc)
 {
-    otbr::Psk::Pskc mPSKc;
+    Pskc         mPSKc;
+    Pskc::Engine mEngine;
+
+    void setup(void) { mEngine = Pskc::GetEngine(); }
+
+    void teardown(void) { Pskc::SetEngine(mEngine); }
 };
 
 TEST(Pskc, Test123456_0001020304050607_OpenThread)
@@ -46,3 +97,98 @@ TEST(Pskc, Test123456_0001020304050607_OpenThread)
     pskc = mPSKc.ComputePskc(extpanid, "OpenThread", "123456");
     MEMCMP_EQUAL(expected, pskc, sizeof(expected));
 }
+
+TEST(Pskc, Test12SECRETPASSWORD34_0001020304050607_TestNetwork)
+{
+    uint8_t extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    uint8_t expected[] = {
+        0xc3, 0xf5, 0x93, 0x68, 0x44, 0x5a, 0x1b, 0x61, 0x06, 0xbe, 0x42, 0x0a, 0x70, 0x6d, 0x4c, 0xc9,
+    };
+    const uint8_t *pskc = NULL;
+
+    pskc = mPSKc.ComputePskc(extpanid, "Test Network", "12SECRETPASSWORD34");
+    MEMCMP_EQUAL(expected, pskc, sizeof(expected));
+}
+
+TEST(Pskc, TestEnginesKnownAnswers)
+{
+    uint8_t extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    uint8_t expected[] = {
+        0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69,
+    };
+    uint8_t pskc[OT_PSKC_LENGTH];
+
+    CHECK(Pskc::IsEngineSupported(Pskc::kEngineSoftware));
+
+    for (size_t i = 0; i < sizeof(kEngines) / sizeof(kEngines[0]); i++)
+    {
+        if (!Pskc::SetEngine(kEngines[i]))
+        {
+            CHECK(!Pskc::IsEngineSupported(kEngines[i]));
+            continue;
+        }
+
+        CHECK_EQUAL(kEngines[i], Pskc::GetEngine());
+        Pskc::ComputePskc(extpanid, "OpenThread", "123456", pskc);
+        MEMCMP_EQUAL(expected, pskc, sizeof(expected));
+    }
+}
+
+TEST(Pskc, TestEnginesMatchReference)
+{
+    // Covers a passphrase used directly as the PRF key and one spanning several CMAC blocks.
+    const char *kPassphrases[] = {"0123456789abcdef", "a passphrase spanning more than two AES blocks"};
+    uint8_t     extpanid[]     = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+
+    for (size_t i = 0; i < sizeof(kPassphrases) / sizeof(kPassphrases[0]); i++)
+    {
+        uint8_t expected[OT_PSKC_LENGTH];
+
+        ComputeReferencePskc(extpanid, "SixteenCharsName", kPassphrases[i], expected);
+
+        for (size_t j = 0; j < sizeof(kEngines) / sizeof(kEngines[0]); j++)
+        {
+            uint8_t pskc[OT_PSKC_LENGTH];
+
+            if (!Pskc::SetEngine(kEngines[j]))
+            {
+                continue;
+            }
+
+            Pskc::ComputePskc(extpanid, "SixteenCharsName", kPassphrases[i], pskc);
+            MEMCMP_EQUAL(expected, pskc, sizeof(expected));
+        }
+    }
+}
+
+TEST(Pskc, TestBatch)
+{
+    const char *kPassphrases[] = {"123456", "654321", "J01NME", "12SECRETPASSWORD34", "0123456789abcdef"};
+    uint8_t     extpanid[]     = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    enum
+    {
+        kNumInputs = sizeof(kPassphrases) / sizeof(kPassphrases[0]),
+    };
+    otbr::Psk::PskcInput inputs[kNumInputs];
+    uint8_t              pskcs[kNumInputs][OT_PSKC_LENGTH];
+
+    for (size_t i = 0; i < kNumInputs; i++)
+    {
+        inputs[i].mExtPanId    = extpanid;
+        inputs[i].mNetworkName = "OpenThread";
+        inputs[i].mPassphrase  = kPassphrases[i];
+    }
+
+    Pskc::ComputePskcBatch(inputs, kNumInputs, pskcs[0], 3);
+
+    for (size_t i = 0; i < kNumInputs; i++)
+    {
+        MEMCMP_EQUAL(mPSKc.ComputePskc(extpanid, "OpenThread", kPassphrases[i]), pskcs[i], OT_PSKC_LENGTH);
+    }
+
+    // One thread, and more threads than inputs.
+    Pskc::ComputePskcBatch(inputs, 1, pskcs[0], 1);
+    MEMCMP_EQUAL(mPSKc.ComputePskc(extpanid, "OpenThread", kPassphrases[0]), pskcs[0], OT_PSKC_LENGTH);
+    Pskc::ComputePskcBatch(inputs, 2, pskcs[0], 16);
+    MEMCMP_EQUAL(mPSKc.ComputePskc(extpanid, "OpenThread", kPassphrases[1]), pskcs[1], OT_PSKC_LENGTH);
+}
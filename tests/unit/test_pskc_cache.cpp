@@ -0,0 +1,217 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/pskc.hpp"
+#include "utils/pskc_cache.hpp"
+
+static const uint8_t kExtPanId[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+static const uint8_t kExpected[] = {
+    0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69,
+};
+
+TEST_GROUP(PskcCache)
+{
+    char mPath[64];
+
+    void setup(void)
+    {
+        sprintf(mPath, "/tmp/otbr-test-pskc-cache-%d", getpid());
+        unlink(mPath);
+    }
+
+    void teardown(void) { unlink(mPath); }
+};
+
+TEST(PskcCache, TestHitMiss)
+{
+    otbr::Psk::PskcCache cache;
+    uint8_t              pskc[OT_PSKC_LENGTH];
+
+    cache.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+    MEMCMP_EQUAL(kExpected, pskc, sizeof(kExpected));
+    CHECK_EQUAL(0, cache.GetHitCount());
+    CHECK_EQUAL(1, cache.GetMissCount());
+
+    memset(pskc, 0, sizeof(pskc));
+    cache.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+    MEMCMP_EQUAL(kExpected, pskc, sizeof(kExpected));
+    CHECK_EQUAL(1, cache.GetHitCount());
+    CHECK_EQUAL(1, cache.GetMissCount());
+
+    // Any different input is a miss.
+    cache.ComputePskc(kExtPanId, "OpenThread", "1234567", pskc);
+    cache.ComputePskc(kExtPanId, "OpenThreaD", "123456", pskc);
+    cache.ComputePskc(kExpected, "OpenThread", "123456", pskc);
+    CHECK_EQUAL(1, cache.GetHitCount());
+    CHECK_EQUAL(4, cache.GetMissCount());
+    CHECK_EQUAL(4, cache.GetSize());
+
+    cache.Clear();
+    CHECK_EQUAL(0, cache.GetSize());
+    CHECK_EQUAL(0, cache.GetMissCount());
+}
+
+TEST(PskcCache, TestEvictLeastRecentlyUsed)
+{
+    otbr::Psk::PskcCache cache(2);
+    uint8_t              pskc[OT_PSKC_LENGTH];
+
+    cache.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+    cache.ComputePskc(kExtPanId, "OpenThread", "654321", pskc);
+    cache.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+    cache.ComputePskc(kExtPanId, "OpenThread", "J01NME", pskc);
+    CHECK_EQUAL(2, cache.GetSize());
+    CHECK_EQUAL(1, cache.GetHitCount());
+
+    // 654321 was the least recently used one.
+    cache.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+    CHECK_EQUAL(2, cache.GetHitCount());
+    cache.ComputePskc(kExtPanId, "OpenThread", "654321", pskc);
+    CHECK_EQUAL(2, cache.GetHitCount());
+    CHECK_EQUAL(4, cache.GetMissCount());
+}
+
+TEST(PskcCache, TestPersistence)
+{
+    uint8_t     pskc[OT_PSKC_LENGTH];
+    struct stat st;
+
+    {
+        otbr::Psk::PskcCache cache;
+
+        CHECK_EQUAL(OTBR_ERROR_NONE, cache.Load(mPath));
+        cache.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+        cache.ComputePskc(kExtPanId, "OpenThread", "654321", pskc);
+    }
+
+    CHECK_EQUAL(0, stat(mPath, &st));
+    CHECK_EQUAL(S_IRUSR | S_IWUSR, st.st_mode & 0777);
+
+    {
+        otbr::Psk::PskcCache cache;
+        FILE *               file;
+        char                 content[256];
+        size_t               length;
+
+        CHECK_EQUAL(OTBR_ERROR_NONE, cache.Load(mPath));
+        CHECK_EQUAL(2, cache.GetSize());
+
+        memset(pskc, 0, sizeof(pskc));
+        cache.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+        MEMCMP_EQUAL(kExpected, pskc, sizeof(kExpected));
+        CHECK_EQUAL(1, cache.GetHitCount());
+        CHECK_EQUAL(0, cache.GetMissCount());
+
+        // Neither the passphrase nor the network name is saved.
+        file = fopen(mPath, "rb");
+        CHECK(file != NULL);
+        length = fread(content, 1, sizeof(content), file);
+        fclose(file);
+        CHECK(length < sizeof(content));
+        CHECK(memmem(content, length, "123456", 6) == NULL);
+        CHECK(memmem(content, length, "OpenThread", 10) == NULL);
+    }
+}
+
+TEST(PskcCache, TestRejectInvalidFile)
+{
+    otbr::Psk::PskcCache cache;
+    FILE *               file;
+
+    file = fopen(mPath, "wb");
+    CHECK(file != NULL);
+    fputs("not a pskc cache", file);
+    fclose(file);
+    chmod(mPath, S_IRUSR | S_IWUSR);
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, cache.Load(mPath));
+
+    // A rejected file is not overwritten.
+    {
+        uint8_t pskc[OT_PSKC_LENGTH];
+        char    content[32];
+        size_t  length;
+
+        cache.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+        CHECK_EQUAL(OTBR_ERROR_NONE, cache.Save());
+        file = fopen(mPath, "rb");
+        CHECK(file != NULL);
+        length = fread(content, 1, sizeof(content), file);
+        fclose(file);
+        CHECK_EQUAL(strlen("not a pskc cache"), length);
+        MEMCMP_EQUAL("not a pskc cache", content, length);
+        cache.Clear();
+    }
+
+    // Others may read the file.
+    {
+        otbr::Psk::PskcCache saved;
+        uint8_t              pskc[OT_PSKC_LENGTH];
+
+        unlink(mPath);
+        CHECK_EQUAL(OTBR_ERROR_NONE, saved.Load(mPath));
+        saved.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+    }
+    chmod(mPath, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, cache.Load(mPath));
+    CHECK_EQUAL(0, cache.GetSize());
+}
+
+TEST(PskcCache, TestSaltedKeys)
+{
+    uint8_t pskc[OT_PSKC_LENGTH];
+    char    content[2][256];
+    size_t  length[2];
+
+    // The same PSKc is saved under other keys by another cache.
+    for (int i = 0; i < 2; i++)
+    {
+        otbr::Psk::PskcCache cache;
+        FILE *               file;
+
+        unlink(mPath);
+        CHECK_EQUAL(OTBR_ERROR_NONE, cache.Load(mPath));
+        cache.ComputePskc(kExtPanId, "OpenThread", "123456", pskc);
+
+        file = fopen(mPath, "rb");
+        CHECK(file != NULL);
+        length[i] = fread(content[i], 1, sizeof(content[i]), file);
+        fclose(file);
+    }
+
+    CHECK_EQUAL(length[0], length[1]);
+    CHECK(memcmp(content[0], content[1], length[0]) != 0);
+    CHECK(memmem(content[0], length[0], kExpected, sizeof(kExpected)) != NULL);
+    CHECK(memmem(content[1], length[1], kExpected, sizeof(kExpected)) != NULL);
+}
@@ -0,0 +1,128 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/steering_data.hpp"
+
+using otbr::SteeringData;
+
+static const uint8_t kJoinerIds[][SteeringData::kSizeJoinerId] = {
+    {0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0},
+    {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+    {0xfa, 0xce, 0xb0, 0x0c, 0x00, 0x11, 0x22, 0x33},
+};
+
+TEST_GROUP(SteeringData){};
+
+TEST(SteeringData, TestAddJoinerMatchesComputeBloomFilter)
+{
+    SteeringData incremental;
+    SteeringData computed;
+
+    incremental.Init(SteeringData::kMaxSizeOfBloomFilter);
+    computed.Init(SteeringData::kMaxSizeOfBloomFilter);
+
+    for (size_t i = 0; i < sizeof(kJoinerIds) / sizeof(kJoinerIds[0]); i++)
+    {
+        incremental.AddJoiner(kJoinerIds[i]);
+        computed.ComputeBloomFilter(kJoinerIds[i]);
+    }
+
+    MEMCMP_EQUAL(computed.GetBloomFilter(), incremental.GetBloomFilter(), SteeringData::kMaxSizeOfBloomFilter);
+}
+
+TEST(SteeringData, TestRemoveJoiner)
+{
+    SteeringData steeringData;
+    SteeringData expected;
+
+    steeringData.Init(SteeringData::kMaxSizeOfBloomFilter);
+    expected.Init(SteeringData::kMaxSizeOfBloomFilter);
+    expected.ComputeBloomFilter(kJoinerIds[1]);
+
+    steeringData.AddJoiner(kJoinerIds[0]);
+    steeringData.AddJoiner(kJoinerIds[1]);
+    steeringData.AddJoiner(kJoinerIds[1]);
+    steeringData.RemoveJoiner(kJoinerIds[0]);
+    steeringData.RemoveJoiner(kJoinerIds[1]);
+    MEMCMP_EQUAL(expected.GetBloomFilter(), steeringData.GetBloomFilter(), SteeringData::kMaxSizeOfBloomFilter);
+
+    steeringData.RemoveJoiner(kJoinerIds[1]);
+    expected.Clear();
+    MEMCMP_EQUAL(expected.GetBloomFilter(), steeringData.GetBloomFilter(), SteeringData::kMaxSizeOfBloomFilter);
+}
+
+TEST(SteeringData, TestBatchMatchesSingle)
+{
+    const uint8_t kEui64s[][SteeringData::kSizeJoinerId] = {
+        {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01},
+        {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02},
+        {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    };
+    enum
+    {
+        kNumJoiners = sizeof(kEui64s) / sizeof(kEui64s[0]),
+    };
+    uint8_t      joinerIds[kNumJoiners][SteeringData::kSizeJoinerId];
+    SteeringData batch;
+    SteeringData single;
+
+    SteeringData::ComputeJoinerIds(kEui64s[0], kNumJoiners, joinerIds[0]);
+    batch.Init(8);
+    batch.ComputeBloomFilter(joinerIds[0], kNumJoiners);
+
+    single.Init(8);
+    for (size_t i = 0; i < kNumJoiners; i++)
+    {
+        uint8_t joinerId[SteeringData::kSizeJoinerId];
+
+        SteeringData::ComputeJoinerId(kEui64s[i], joinerId);
+        MEMCMP_EQUAL(joinerId, joinerIds[i], sizeof(joinerId));
+        single.ComputeBloomFilter(joinerId);
+    }
+
+    MEMCMP_EQUAL(single.GetBloomFilter(), batch.GetBloomFilter(), 8);
+}
+
+TEST(SteeringData, TestKnownBits)
+{
+    // CRC16-CCITT and CRC16-ANSI of this joiner id are 0x341a and 0x151f.
+    SteeringData   steeringData;
+    const uint8_t *bloomFilter = steeringData.GetBloomFilter();
+
+    steeringData.Init(SteeringData::kMaxSizeOfBloomFilter);
+    steeringData.ComputeBloomFilter(kJoinerIds[0]);
+
+    for (int bit = 0; bit < SteeringData::kMaxSizeOfBloomFilter * 8; bit++)
+    {
+        bool isSet = (bloomFilter[SteeringData::kMaxSizeOfBloomFilter - 1 - bit / 8] & (1 << (bit % 8))) != 0;
+
+        CHECK_EQUAL(bit == (0x341a % 128) || bit == (0x151f % 128), isSet);
+    }
+}
@@ -0,0 +1,236 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a microbenchmark of the d-bus method and property dispatch.
+ */
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "common/code_utils.hpp"
+#include "dbus/common/constants.hpp"
+#include "dbus/server/dbus_handler_table.hpp"
+
+using otbr::DBus::DBusHandlerTable;
+
+/**
+ * Constants.
+ */
+enum
+{
+    kDefaultNumLookups = 1000000,
+};
+
+static const char *const kMethods[] = {
+    OTBR_DBUS_SCAN_METHOD,
+    OTBR_DBUS_ATTACH_METHOD,
+    OTBR_DBUS_FACTORY_RESET_METHOD,
+    OTBR_DBUS_RESET_METHOD,
+    OTBR_DBUS_JOINER_START_METHOD,
+    OTBR_DBUS_JOINER_STOP_METHOD,
+    OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD,
+    OTBR_DBUS_ADD_ON_MESH_PREFIX_METHOD,
+    OTBR_DBUS_REMOVE_ON_MESH_PREFIX_METHOD,
+    OTBR_DBUS_ADD_EXTERNAL_ROUTE_METHOD,
+    OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD,
+    OTBR_DBUS_SET_LOG_LEVELS_METHOD,
+};
+
+static const char *const kProperties[] = {
+    OTBR_DBUS_PROPERTY_LINK_MODE,
+    OTBR_DBUS_PROPERTY_DEVICE_ROLE,
+    OTBR_DBUS_PROPERTY_NETWORK_NAME,
+    OTBR_DBUS_PROPERTY_PANID,
+    OTBR_DBUS_PROPERTY_EXTPANID,
+    OTBR_DBUS_PROPERTY_CHANNEL,
+    OTBR_DBUS_PROPERTY_MASTER_KEY,
+    OTBR_DBUS_PROPERTY_CCA_FAILURE_RATE,
+    OTBR_DBUS_PROPERTY_LINK_COUNTERS,
+    OTBR_DBUS_PROPERTY_IP6_COUNTERS,
+    OTBR_DBUS_PROPERTY_SUPPORTED_CHANNEL_MASK,
+    OTBR_DBUS_PROPERTY_RLOC16,
+    OTBR_DBUS_PROPERTY_EXTENDED_ADDRESS,
+    OTBR_DBUS_PROPERTY_ROUTER_ID,
+    OTBR_DBUS_PROPERTY_LEADER_DATA,
+    OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY,
+    OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY,
+    OTBR_DBUS_PROPERTY_LOCAL_LEADER_WEIGHT,
+    OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_SAMPLE_COUNT,
+    OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES,
+    OTBR_DBUS_PROPERTY_CHILD_TABLE,
+    OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
+    OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY,
+    OTBR_DBUS_PROPERTY_INSTANT_RSSI,
+    OTBR_DBUS_PROPERTY_RADIO_TX_POWER,
+    OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES,
+};
+
+static const size_t kNumMethods    = sizeof(kMethods) / sizeof(kMethods[0]);
+static const size_t kNumProperties = sizeof(kProperties) / sizeof(kProperties[0]);
+
+typedef std::function<int(void)> HandlerType;
+
+static double GetSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void PrintResult(const char *aName, double aSeconds, int aNumLookups, int aChecksum)
+{
+    printf("%-22s %8.1f ns/lookup (checksum %d)\n", aName, aSeconds * 1e9 / aNumLookups, aChecksum);
+}
+
+static void PrintUsage(const char *aProgram, FILE *aStream, int aExitCode)
+{
+    fprintf(aStream,
+            "dbus-dispatch-bench - benchmark the d-bus method and property dispatch\n"
+            "Syntax:\n"
+            "    %s [Options]\n"
+            "Options:\n"
+            "    -n, --lookups              NUMBER      Number of lookups, default %d\n"
+            "    -h, --help                             Print this help\n",
+            aProgram, kDefaultNumLookups);
+
+    exit(aExitCode);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct option options[] = {
+        {"lookups", required_argument, NULL, 'n'}, {"help", no_argument, NULL, 'h'}, {0, 0, 0, 0}};
+
+    int                                                                           numLookups = kDefaultNumLookups;
+    std::unordered_map<std::string, HandlerType>                                  methodMap;
+    std::unordered_map<std::string, std::unordered_map<std::string, HandlerType>> propertyMap;
+    DBusHandlerTable<HandlerType>                                                 methodTable;
+    DBusHandlerTable<HandlerType>                                                 propertyTable;
+    int                                                                           checksum;
+    int                                                                           expected;
+    double                                                                        start;
+    int                                                                           ret = EXIT_FAILURE;
+
+    while (true)
+    {
+        int option = getopt_long(argc, argv, "n:h", options, NULL);
+
+        if (option == -1)
+        {
+            break;
+        }
+
+        switch (option)
+        {
+        case 'n':
+            numLookups = atoi(optarg);
+            VerifyOrExit(numLookups > 0, fprintf(stderr, "Invalid number of lookups!\n"));
+            break;
+        case 'h':
+            PrintUsage(argv[0], stdout, EXIT_SUCCESS);
+            break;
+        default:
+            PrintUsage(argv[0], stderr, EXIT_FAILURE);
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < kNumMethods; i++)
+    {
+        HandlerType handler = [i]() { return static_cast<int>(i); };
+
+        methodMap.emplace(std::string(OTBR_DBUS_THREAD_INTERFACE) + "." + kMethods[i], handler);
+        methodTable.Add(OTBR_DBUS_THREAD_INTERFACE, kMethods[i], handler);
+    }
+
+    for (size_t i = 0; i < kNumProperties; i++)
+    {
+        HandlerType handler = [i]() { return static_cast<int>(i); };
+
+        propertyMap[OTBR_DBUS_THREAD_INTERFACE].emplace(kProperties[i], handler);
+        propertyTable.Add(OTBR_DBUS_THREAD_INTERFACE, kProperties[i], handler);
+    }
+
+    // The interface and member names are C strings taken from the message, as in DBusObject.
+    checksum = 0;
+    start    = GetSeconds();
+    for (int i = 0; i < numLookups; i++)
+    {
+        std::string memberName = std::string(OTBR_DBUS_THREAD_INTERFACE) + "." + kMethods[i % kNumMethods];
+
+        checksum += methodMap.find(memberName)->second();
+    }
+    PrintResult("method string map", GetSeconds() - start, numLookups, checksum);
+    expected = checksum;
+
+    checksum = 0;
+    start    = GetSeconds();
+    for (int i = 0; i < numLookups; i++)
+    {
+        checksum += (*methodTable.Find(OTBR_DBUS_THREAD_INTERFACE, kMethods[i % kNumMethods]))();
+    }
+    PrintResult("method flat table", GetSeconds() - start, numLookups, checksum);
+    VerifyOrExit(checksum == expected, fprintf(stderr, "The flat table found wrong methods!\n"));
+
+    checksum = 0;
+    start    = GetSeconds();
+    for (int i = 0; i < numLookups; i++)
+    {
+        std::string interfaceName = OTBR_DBUS_THREAD_INTERFACE;
+        std::string propertyName  = kProperties[i % kNumProperties];
+
+        checksum += propertyMap.find(interfaceName)->second.find(propertyName)->second();
+    }
+    PrintResult("property string map", GetSeconds() - start, numLookups, checksum);
+    expected = checksum;
+
+    checksum = 0;
+    start    = GetSeconds();
+    for (int i = 0; i < numLookups; i++)
+    {
+        checksum += (*propertyTable.Find(OTBR_DBUS_THREAD_INTERFACE, kProperties[i % kNumProperties]))();
+    }
+    PrintResult("property flat table", GetSeconds() - start, numLookups, checksum);
+    VerifyOrExit(checksum == expected, fprintf(stderr, "The flat table found wrong properties!\n"));
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}
@@ -0,0 +1,186 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file measures the cost of encoding and extracting arrays in d-bus messages.
+ */
+
+#include <chrono>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <dbus/dbus.h>
+
+#include "common/code_utils.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+
+using otbr::DBus::ChildInfo;
+using otbr::DBus::DBusMessageEncode;
+using otbr::DBus::DBusMessageExtract;
+
+enum
+{
+    kDefaultRoundTrips = 10000,
+    kArrayLength       = 1024,
+    kChildTableLength  = 32,
+};
+
+template <typename T> using EncodeFunction  = otbrError (*)(DBusMessageIter *, const std::vector<T> &);
+template <typename T> using ExtractFunction = otbrError (*)(DBusMessageIter *, std::vector<T> &);
+
+/**
+ * This function encodes @p aValue into a new message and extracts it back @p aIterations times.
+ *
+ * @returns The average nanoseconds of one round trip, or a negative value on failure.
+ *
+ */
+template <typename T>
+static double Measure(const std::vector<T> &aValue,
+                      unsigned long         aIterations,
+                      EncodeFunction<T>     aEncode,
+                      ExtractFunction<T>    aExtract)
+{
+    auto           start = std::chrono::steady_clock::now();
+    std::vector<T> decoded;
+
+    for (unsigned long i = 0; i < aIterations; i++)
+    {
+        DBusMessage *   msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+        DBusMessageIter iter;
+        otbrError       error;
+
+        VerifyOrExit(msg != nullptr);
+        dbus_message_iter_init_append(msg, &iter);
+        error = aEncode(&iter, aValue);
+        if (error == OTBR_ERROR_NONE)
+        {
+            error = dbus_message_iter_init(msg, &iter) ? aExtract(&iter, decoded) : OTBR_ERROR_DBUS;
+        }
+        dbus_message_unref(msg);
+        VerifyOrExit(error == OTBR_ERROR_NONE && decoded.size() == aValue.size());
+    }
+
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / aIterations;
+
+exit:
+    return -1;
+}
+
+static void Report(const char *aName, double aNanoseconds)
+{
+    if (aNanoseconds < 0)
+    {
+        printf("%-40s failed\n", aName);
+    }
+    else
+    {
+        printf("%-40s %12.0f ns\n", aName, aNanoseconds);
+    }
+}
+
+static void PrintUsage(const char *aProgram, FILE *aStream, int aExitCode)
+{
+    fprintf(aStream,
+            "dbus-message-bench - benchmark the encoding and extraction of arrays in d-bus messages\n"
+            "Syntax:\n"
+            "    %s [Options]\n"
+            "Options:\n"
+            "    -n, --round-trips          NUMBER      Number of round trips, default %d\n"
+            "    -h, --help                             Print this help\n",
+            aProgram, kDefaultRoundTrips);
+
+    exit(aExitCode);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct option options[] = {
+        {"round-trips", required_argument, NULL, 'n'}, {"help", no_argument, NULL, 'h'}, {0, 0, 0, 0}};
+
+    int                    roundTrips = kDefaultRoundTrips;
+    std::vector<uint8_t>   bytes(kArrayLength);
+    std::vector<uint32_t>  words(kArrayLength);
+    std::vector<ChildInfo> children(kChildTableLength);
+    int                    ret = EXIT_FAILURE;
+
+    while (true)
+    {
+        int option = getopt_long(argc, argv, "n:h", options, NULL);
+
+        if (option == -1)
+        {
+            break;
+        }
+
+        switch (option)
+        {
+        case 'n':
+            roundTrips = atoi(optarg);
+            VerifyOrExit(roundTrips > 0, fprintf(stderr, "Invalid number of round trips!\n"));
+            break;
+        case 'h':
+            PrintUsage(argv[0], stdout, EXIT_SUCCESS);
+            break;
+        default:
+            PrintUsage(argv[0], stderr, EXIT_FAILURE);
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < kArrayLength; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i);
+        words[i] = static_cast<uint32_t>(i * 0x01010101);
+    }
+    for (size_t i = 0; i < kChildTableLength; i++)
+    {
+        children[i].mExtAddress = i;
+        children[i].mRloc16     = static_cast<uint16_t>(0xfc01 + i);
+        children[i].mAge        = static_cast<uint32_t>(i);
+    }
+
+    printf("%d round trips of arrays of %d elements\n", roundTrips, kArrayLength);
+
+    // The overloads taking vectors of fixed types encode the whole array in one call, while the explicit template
+    // argument selects the generic encoding, one element after another.
+    Report("ay, fixed array", Measure<uint8_t>(bytes, roundTrips, DBusMessageEncode, DBusMessageExtract));
+    Report("ay, element by element",
+           Measure<uint8_t>(bytes, roundTrips, DBusMessageEncode<uint8_t>, DBusMessageExtract<uint8_t>));
+    Report("au, fixed array", Measure<uint32_t>(words, roundTrips, DBusMessageEncode, DBusMessageExtract));
+    Report("au, element by element",
+           Measure<uint32_t>(words, roundTrips, DBusMessageEncode<uint32_t>, DBusMessageExtract<uint32_t>));
+    Report("a(tuuqqyyyyqqbbbbb), child table",
+           Measure<ChildInfo>(children, roundTrips, DBusMessageEncode, DBusMessageExtract));
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}
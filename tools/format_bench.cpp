@@ -0,0 +1,224 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a microbenchmark of the hex and text formatting.
+ */
+
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/code_utils.hpp"
+#include "common/format.hpp"
+
+using otbr::Format::StringBuilder;
+
+/**
+ * Constants.
+ */
+enum
+{
+    kDefaultNumIterations = 1000000,
+    kSizeBytes            = 16, ///< Bytes encoded per iteration, the size of a master key or a hex dump line.
+};
+
+static double GetSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void PrintResult(const char *aName, double aSeconds, size_t aNumIterations, unsigned int aChecksum)
+{
+    printf("%-22s %10.1f ns/op (checksum %08x)\n", aName, aSeconds * 1e9 / aNumIterations, aChecksum);
+}
+
+static unsigned int Checksum(const char *aString)
+{
+    unsigned int checksum = 0;
+
+    for (; *aString != '\0'; aString++)
+    {
+        checksum = checksum * 31 + static_cast<unsigned char>(*aString);
+    }
+
+    return checksum;
+}
+
+static void PrintUsage(const char *aProgram, FILE *aStream, int aExitCode)
+{
+    fprintf(aStream,
+            "format-bench - benchmark the hex and text formatting against printf\n"
+            "Syntax:\n"
+            "    %s [Options]\n"
+            "Options:\n"
+            "    -n, --iterations           NUMBER      Number of iterations, default %d\n"
+            "    -h, --help                             Print this help\n",
+            aProgram, kDefaultNumIterations);
+
+    exit(aExitCode);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct option options[] = {
+        {"iterations", required_argument, NULL, 'n'}, {"help", no_argument, NULL, 'h'}, {0, 0, 0, 0}};
+
+    int                  numIterations = kDefaultNumIterations;
+    std::vector<uint8_t> bytes;
+    char                 legacy[kSizeBytes * 3 + 1];
+    char                 fast[kSizeBytes * 3 + 1];
+    unsigned int         legacyChecksum;
+    unsigned int         fastChecksum;
+    double               start;
+    int                  ret = EXIT_FAILURE;
+
+    while (true)
+    {
+        int option = getopt_long(argc, argv, "n:h", options, NULL);
+
+        if (option == -1)
+        {
+            break;
+        }
+
+        switch (option)
+        {
+        case 'n':
+            numIterations = atoi(optarg);
+            VerifyOrExit(numIterations > 0, fprintf(stderr, "Invalid number of iterations!\n"));
+            break;
+        case 'h':
+            PrintUsage(argv[0], stdout, EXIT_SUCCESS);
+            break;
+        default:
+            PrintUsage(argv[0], stderr, EXIT_FAILURE);
+            break;
+        }
+    }
+
+    bytes.resize(numIterations + kSizeBytes);
+    for (size_t i = 0; i < bytes.size(); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(rand());
+    }
+
+    // Hex encoding, the way the ubus server printed keys and addresses.
+    legacyChecksum = 0;
+    start          = GetSeconds();
+    for (int i = 0; i < numIterations; i++)
+    {
+        legacy[0] = '\0';
+        for (int j = 0; j < kSizeBytes; j++)
+        {
+            char byteHex[3];
+
+            sprintf(byteHex, "%02x", bytes[i + j]);
+            strcat(legacy, byteHex);
+        }
+        legacyChecksum += Checksum(legacy);
+    }
+    PrintResult("hex sprintf+strcat", GetSeconds() - start, numIterations, legacyChecksum);
+
+    fastChecksum = 0;
+    start        = GetSeconds();
+    for (int i = 0; i < numIterations; i++)
+    {
+        otbr::Format::EncodeHex(&bytes[i], kSizeBytes, fast);
+        fastChecksum += Checksum(fast);
+    }
+    PrintResult("hex EncodeHex", GetSeconds() - start, numIterations, fastChecksum);
+    VerifyOrExit(fastChecksum == legacyChecksum, fprintf(stderr, "EncodeHex formatted a wrong text!\n"));
+
+    // Hex dump lines, the way otbrDump printed them.
+    legacyChecksum = 0;
+    start          = GetSeconds();
+    for (int i = 0; i < numIterations; i++)
+    {
+        char *cur = legacy;
+
+        for (int j = 0; j < kSizeBytes; j++)
+        {
+            cur += sprintf(cur, j == 0 ? "%02x" : " %02x", bytes[i + j]);
+        }
+        legacyChecksum += Checksum(legacy);
+    }
+    PrintResult("dump sprintf", GetSeconds() - start, numIterations, legacyChecksum);
+
+    fastChecksum = 0;
+    start        = GetSeconds();
+    for (int i = 0; i < numIterations; i++)
+    {
+        StringBuilder(fast, sizeof(fast)).AppendHexBytes(&bytes[i], kSizeBytes, ' ');
+        fastChecksum += Checksum(fast);
+    }
+    PrintResult("dump StringBuilder", GetSeconds() - start, numIterations, fastChecksum);
+    VerifyOrExit(fastChecksum == legacyChecksum, fprintf(stderr, "StringBuilder dumped a wrong text!\n"));
+
+    // Integers, the way the ubus server printed RLOC16s and RSSIs.
+    legacyChecksum = 0;
+    start          = GetSeconds();
+    for (int i = 0; i < numIterations; i++)
+    {
+        int8_t rssi = static_cast<int8_t>(bytes[i]);
+
+        sprintf(legacy, "0x%04x %9d", bytes[i] << 8 | bytes[i + 1], rssi);
+        legacyChecksum += Checksum(legacy);
+    }
+    PrintResult("integers sprintf", GetSeconds() - start, numIterations, legacyChecksum);
+
+    fastChecksum = 0;
+    start        = GetSeconds();
+    for (int i = 0; i < numIterations; i++)
+    {
+        int8_t rssi = static_cast<int8_t>(bytes[i]);
+
+        StringBuilder(fast, sizeof(fast))
+            .Append("0x")
+            .AppendHex(bytes[i] << 8 | bytes[i + 1], 4)
+            .AppendChar(' ')
+            .AppendSigned(rssi, 9);
+        fastChecksum += Checksum(fast);
+    }
+    PrintResult("integers StringBuilder", GetSeconds() - start, numIterations, fastChecksum);
+    VerifyOrExit(fastChecksum == legacyChecksum, fprintf(stderr, "StringBuilder formatted wrong integers!\n"));
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}
@@ -0,0 +1,685 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a load generator simulating joiners commissioned by otbr-commissioner.
+ *
+ *   The tool acts as the border agent otbr-commissioner connects to. Once the commissioner sets its steering data,
+ *   the tool starts simulated joiners whose EC-JPAKE DTLS records are encapsulated in RELAY_RX and RELAY_TX,
+ *   so the whole commissioning path can be loaded over loopback without a Thread network.
+ */
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <errno.h>
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+
+#include "agent/uris.hpp"
+#include "commissioner/simulated_joiner.hpp"
+#include "common/coap.hpp"
+#include "common/code_utils.hpp"
+#include "common/dtls.hpp"
+#include "common/logging.hpp"
+#include "common/time.hpp"
+#include "common/tlv.hpp"
+#include "utils/hex.hpp"
+
+using namespace otbr;
+
+/**
+ * Constants.
+ */
+enum
+{
+    kPskcLength          = 16,
+    kIidLength           = 8,
+    kMaxPacket           = 1280,
+    kDefaultPort         = 49191,
+    kDefaultNumJoiners   = 10,
+    kDefaultTimeout      = 60,
+    kJoinerUdpPort       = 1000,
+    kJoinerRouterLocator = 0x0400,
+    kSessionId           = 0x1234,
+    kPollInterval        = 10, ///< Milliseconds between polls of joiner DTLS timers.
+};
+
+static const uint64_t kEui64Base     = 0x18b4300000000000ULL;
+static const char     kDefaultPskd[] = "J01NME";
+
+static volatile sig_atomic_t sShouldTerminate = 0;
+
+static void HandleSignal(int aSignal)
+{
+    signal(aSignal, SIG_DFL);
+    sShouldTerminate = 1;
+}
+
+/**
+ * This class plays the border agent and the joiner router for simulated joiners.
+ *
+ */
+class LoadGenerator
+{
+public:
+    LoadGenerator(unsigned int aNumJoiners, unsigned int aConcurrency, unsigned long aTimeout, const char *aPskd)
+        : mServer(NULL)
+        , mSession(NULL)
+        , mCoapAgent(NULL)
+        , mPetitionHandler(OT_URI_PATH_COMMISSIONER_PETITION, HandleStateRequest, this)
+        , mKeepAliveHandler(OT_URI_PATH_COMMISSIONER_KEEP_ALIVE, HandleStateRequest, this)
+        , mCommissionerSetHandler(OT_URI_PATH_COMMISSIONER_SET, HandleCommissionerSet, this)
+        , mRelayTransmitHandler(OT_URI_PATH_RELAY_TX, HandleRelayTransmit, this)
+        , mConcurrency(aConcurrency)
+        , mTimeout(aTimeout)
+        , mNextJoiner(0)
+        , mStartTime(0)
+        , mFinishTime(0)
+        , mNumRelayRx(0)
+        , mNumRelayTx(0)
+    {
+        for (unsigned int i = 0; i < aNumJoiners; i++)
+        {
+            uint64_t         eui64 = kEui64Base + i;
+            uint8_t          eui64Bytes[kIidLength];
+            SimulatedJoiner *joiner;
+
+            for (int j = kIidLength - 1; j >= 0; j--)
+            {
+                eui64Bytes[j] = static_cast<uint8_t>(eui64 & 0xff);
+                eui64 >>= 8;
+            }
+
+            joiner = new SimulatedJoiner(eui64Bytes, aPskd);
+
+            mJoiners.push_back(joiner);
+            mJoinersByIid[GetKey(joiner->GetIid())] = joiner;
+        }
+    }
+
+    ~LoadGenerator(void)
+    {
+        for (size_t i = 0; i < mJoiners.size(); i++)
+        {
+            delete mJoiners[i];
+        }
+
+        if (mServer != NULL)
+        {
+            Dtls::Server::Destroy(mServer);
+        }
+
+        if (mCoapAgent != NULL)
+        {
+            Coap::Agent::Destroy(mCoapAgent);
+        }
+    }
+
+    otbrError Init(uint16_t aPort, const uint8_t *aPskc)
+    {
+        otbrError error;
+
+        mCoapAgent = Coap::Agent::Create(LoadGenerator::SendCoap, this);
+        mCoapAgent->AddResource(mPetitionHandler);
+        mCoapAgent->AddResource(mKeepAliveHandler);
+        mCoapAgent->AddResource(mCommissionerSetHandler);
+        mCoapAgent->AddResource(mRelayTransmitHandler);
+
+        mServer = Dtls::Server::Create(aPort, LoadGenerator::HandleSessionChange, this);
+        SuccessOrExit(error = mServer->SetPSK(aPskc, kPskcLength));
+        SuccessOrExit(error = mServer->Start());
+
+    exit:
+        return error;
+    }
+
+    otbrError WriteCsv(const char *aPath) const
+    {
+        otbrError error = OTBR_ERROR_ERRNO;
+        FILE *    file  = fopen(aPath, "w");
+
+        VerifyOrExit(file != NULL, fprintf(stderr, "Failed to open %s: %s\n", aPath, strerror(errno)));
+
+        for (size_t i = 0; i < mJoiners.size(); i++)
+        {
+            const uint8_t *eui64 = mJoiners[i]->GetEui64();
+
+            for (int j = 0; j < kIidLength; j++)
+            {
+                fprintf(file, "%02x", eui64[j]);
+            }
+            fprintf(file, ",%s\n", kDefaultPskd);
+        }
+
+        fclose(file);
+        error = OTBR_ERROR_NONE;
+
+    exit:
+        return error;
+    }
+
+    void UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, fd_set &aErrorFdSet, int &aMaxFd, timeval &aTimeout)
+    {
+        mServer->UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
+
+        // Joiner DTLS timers are polled as they are not backed by file descriptors.
+        if (mStartTime != 0 && GetTimestamp(aTimeout) > kPollInterval)
+        {
+            aTimeout.tv_sec  = 0;
+            aTimeout.tv_usec = kPollInterval * 1000;
+        }
+    }
+
+    void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+    {
+        unsigned long now       = GetNow();
+        unsigned int  numActive = 0;
+
+        mServer->Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
+
+        VerifyOrExit(mStartTime != 0 && mFinishTime == 0);
+
+        for (size_t i = 0; i < mNextJoiner; i++)
+        {
+            SimulatedJoiner &joiner = *mJoiners[i];
+
+            if (!joiner.IsActive())
+            {
+                continue;
+            }
+
+            joiner.Run();
+
+            if (joiner.IsActive() && now - joiner.GetStartTime() >= mTimeout)
+            {
+                joiner.Fail();
+            }
+
+            RelayReceive(joiner);
+            numActive += joiner.IsActive() ? 1 : 0;
+        }
+
+        while (mNextJoiner < mJoiners.size() && (mConcurrency == 0 || numActive < mConcurrency))
+        {
+            SimulatedJoiner &joiner = *mJoiners[mNextJoiner++];
+
+            if (joiner.Start() == OTBR_ERROR_NONE)
+            {
+                RelayReceive(joiner);
+                numActive++;
+            }
+        }
+
+        if (numActive == 0 && mNextJoiner == mJoiners.size())
+        {
+            mFinishTime = now;
+        }
+
+    exit:
+        return;
+    }
+
+    bool IsDone(void) const { return mFinishTime != 0; }
+
+    void WriteReport(FILE *aStream) const
+    {
+        std::vector<unsigned long> handshake;
+        std::vector<unsigned long> total;
+        unsigned int               numFailed  = 0;
+        unsigned long              finishTime = (mFinishTime != 0 ? mFinishTime : GetNow());
+        unsigned long              elapsed    = (mStartTime != 0 ? finishTime - mStartTime : 0);
+
+        for (size_t i = 0; i < mJoiners.size(); i++)
+        {
+            const SimulatedJoiner &joiner = *mJoiners[i];
+
+            switch (joiner.GetState())
+            {
+            case SimulatedJoiner::kStateFinalized:
+                handshake.push_back(joiner.GetHandshakeLatency());
+                total.push_back(joiner.GetTotalLatency());
+                break;
+            case SimulatedJoiner::kStateFailed:
+                numFailed++;
+                break;
+            default:
+                break;
+            }
+        }
+
+        fprintf(aStream, "joiners: %zu started: %zu finalized: %zu failed: %u\n", mJoiners.size(), mNextJoiner,
+                total.size(), numFailed);
+        fprintf(aStream, "elapsed: %lu ms throughput: %.2f joiners/s relay-rx: %lu relay-tx: %lu\n", elapsed,
+                elapsed ? total.size() * 1000.0 / elapsed : 0.0, mNumRelayRx, mNumRelayTx);
+        fprintf(aStream, "%-14s %8s %8s %8s %8s %8s\n", "latency(ms)", "min", "p50", "p90", "p99", "max");
+        WriteLatencies(aStream, "handshake", handshake);
+        WriteLatencies(aStream, "total", total);
+    }
+
+private:
+    typedef std::map<uint64_t, SimulatedJoiner *> JoinerMap;
+
+    LoadGenerator(const LoadGenerator &);
+    LoadGenerator &operator=(const LoadGenerator &);
+
+    static uint64_t GetKey(const uint8_t *aIid)
+    {
+        uint64_t key = 0;
+
+        for (size_t i = 0; i < kIidLength; i++)
+        {
+            key = (key << 8) | aIid[i];
+        }
+
+        return key;
+    }
+
+    static void WriteLatencies(FILE *aStream, const char *aName, std::vector<unsigned long> &aLatencies)
+    {
+        static const unsigned int kPercents[] = {0, 50, 90, 99, 100};
+
+        fprintf(aStream, "%-14s", aName);
+        std::sort(aLatencies.begin(), aLatencies.end());
+
+        for (size_t i = 0; i < sizeof(kPercents) / sizeof(kPercents[0]); i++)
+        {
+            unsigned long value = 0;
+
+            if (!aLatencies.empty())
+            {
+                value = aLatencies[(aLatencies.size() - 1) * kPercents[i] / 100];
+            }
+
+            fprintf(aStream, " %8lu", value);
+        }
+
+        fprintf(aStream, "\n");
+    }
+
+    void RelayReceive(SimulatedJoiner &aJoiner)
+    {
+        const std::vector<uint8_t> *record;
+
+        while ((record = aJoiner.GetNextRecord()) != NULL)
+        {
+            uint8_t        payload[kMaxPacket];
+            Tlv *          tlv = reinterpret_cast<Tlv *>(payload);
+            Coap::Message *message;
+            uint16_t       token = static_cast<uint16_t>(rand());
+
+            VerifyOrExit(mSession != NULL && record->size() + 32 <= sizeof(payload), aJoiner.Fail());
+
+            tlv->SetType(Meshcop::kJoinerDtlsEncapsulation);
+            tlv->SetValue(record->data(), static_cast<uint16_t>(record->size()));
+            tlv = tlv->GetNext();
+
+            tlv->SetType(Meshcop::kJoinerUdpPort);
+            tlv->SetValue(static_cast<uint16_t>(kJoinerUdpPort));
+            tlv = tlv->GetNext();
+
+            tlv->SetType(Meshcop::kJoinerIid);
+            tlv->SetValue(aJoiner.GetIid(), kIidLength);
+            tlv = tlv->GetNext();
+
+            tlv->SetType(Meshcop::kJoinerRouterLocator);
+            tlv->SetValue(static_cast<uint16_t>(kJoinerRouterLocator));
+            tlv = tlv->GetNext();
+
+            message = mCoapAgent->NewMessage(Coap::kTypeNonConfirmable, Coap::kCodePost,
+                                             reinterpret_cast<const uint8_t *>(&token), sizeof(token));
+            message->SetPath(OT_URI_PATH_RELAY_RX);
+            message->SetPayload(payload, static_cast<uint16_t>(reinterpret_cast<uint8_t *>(tlv) - payload));
+            mCoapAgent->Send(*message, NULL, 0, NULL, this);
+            mCoapAgent->FreeMessage(message);
+            aJoiner.PopRecord();
+            mNumRelayRx++;
+        }
+
+    exit:
+        return;
+    }
+
+    static void HandleSessionChange(Dtls::Session &aSession, Dtls::Session::State aState, void *aContext)
+    {
+        LoadGenerator *generator = static_cast<LoadGenerator *>(aContext);
+
+        switch (aState)
+        {
+        case Dtls::Session::kStateReady:
+            aSession.SetDataHandler(LoadGenerator::FeedCoap, generator);
+            generator->mSession = &aSession;
+            printf("commissioner connected\n");
+            break;
+
+        case Dtls::Session::kStateClose:
+        case Dtls::Session::kStateError:
+        case Dtls::Session::kStateEnd:
+        case Dtls::Session::kStateExpired:
+            if (generator->mSession == &aSession)
+            {
+                generator->mSession = NULL;
+                printf("commissioner disconnected\n");
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    static ssize_t SendCoap(const uint8_t *aBuffer,
+                            uint16_t       aLength,
+                            const uint8_t *aIp6,
+                            uint16_t       aPort,
+                            void *         aContext)
+    {
+        LoadGenerator *generator = static_cast<LoadGenerator *>(aContext);
+
+        (void)aIp6;
+        (void)aPort;
+
+        return generator->mSession != NULL ? generator->mSession->Write(aBuffer, aLength) : -1;
+    }
+
+    static void FeedCoap(const uint8_t *aBuffer, uint16_t aLength, void *aContext)
+    {
+        static_cast<LoadGenerator *>(aContext)->mCoapAgent->Input(aBuffer, aLength, NULL, 0);
+    }
+
+    static void ReplyState(Coap::Message &aResponse, int8_t aState)
+    {
+        uint8_t payload[8];
+        Tlv *   tlv = reinterpret_cast<Tlv *>(payload);
+
+        tlv->SetType(Meshcop::kState);
+        tlv->SetValue(static_cast<uint8_t>(aState));
+        tlv = tlv->GetNext();
+
+        tlv->SetType(Meshcop::kCommissionerSessionId);
+        tlv->SetValue(static_cast<uint16_t>(kSessionId));
+        tlv = tlv->GetNext();
+
+        aResponse.SetCode(Coap::kCodeChanged);
+        aResponse.SetPayload(payload, static_cast<uint16_t>(reinterpret_cast<uint8_t *>(tlv) - payload));
+    }
+
+    /** Accepts COMM_PET and COMM_KA */
+    static void HandleStateRequest(const Coap::Resource &aResource,
+                                   const Coap::Message & aRequest,
+                                   Coap::Message &       aResponse,
+                                   const uint8_t *       aIp6,
+                                   uint16_t              aPort,
+                                   void *                aContext)
+    {
+        ReplyState(aResponse, Meshcop::kStateAccepted);
+
+        (void)aResource;
+        (void)aRequest;
+        (void)aIp6;
+        (void)aPort;
+        (void)aContext;
+    }
+
+    /** Starts the joiners once the commissioner has set its steering data */
+    static void HandleCommissionerSet(const Coap::Resource &aResource,
+                                      const Coap::Message & aRequest,
+                                      Coap::Message &       aResponse,
+                                      const uint8_t *       aIp6,
+                                      uint16_t              aPort,
+                                      void *                aContext)
+    {
+        LoadGenerator *generator = static_cast<LoadGenerator *>(aContext);
+
+        ReplyState(aResponse, Meshcop::kStateAccepted);
+
+        if (generator->mStartTime == 0)
+        {
+            printf("steering data set, starting %zu joiners\n", generator->mJoiners.size());
+            generator->mStartTime = GetNow();
+        }
+
+        (void)aResource;
+        (void)aRequest;
+        (void)aIp6;
+        (void)aPort;
+    }
+
+    static void HandleRelayTransmit(const Coap::Resource &aResource,
+                                    const Coap::Message & aRequest,
+                                    Coap::Message &       aResponse,
+                                    const uint8_t *       aIp6,
+                                    uint16_t              aPort,
+                                    void *                aContext)
+    {
+        LoadGenerator *     generator = static_cast<LoadGenerator *>(aContext);
+        uint16_t            length;
+        const uint8_t *     payload = aRequest.GetPayload(length);
+        const Tlv *         dtlsTlv = NULL;
+        const Tlv *         iidTlv  = NULL;
+        bool                hasKek  = false;
+        JoinerMap::iterator it;
+
+        generator->mNumRelayTx++;
+
+        for (const Tlv *tlv = reinterpret_cast<const Tlv *>(payload);
+             reinterpret_cast<const uint8_t *>(tlv) < payload + length; tlv = tlv->GetNext())
+        {
+            switch (tlv->GetType())
+            {
+            case Meshcop::kJoinerDtlsEncapsulation:
+                dtlsTlv = tlv;
+                break;
+            case Meshcop::kJoinerIid:
+                iidTlv = tlv;
+                break;
+            case Meshcop::kJoinerRouterKek:
+                hasKek = true;
+                break;
+            default:
+                break;
+            }
+        }
+
+        VerifyOrExit(dtlsTlv != NULL && iidTlv != NULL && iidTlv->GetLength() == kIidLength);
+        it = generator->mJoinersByIid.find(GetKey(static_cast<const uint8_t *>(iidTlv->GetValue())));
+        VerifyOrExit(it != generator->mJoinersByIid.end());
+        it->second->HandleRelayTransmit(static_cast<const uint8_t *>(dtlsTlv->GetValue()), dtlsTlv->GetLength(),
+                                        hasKek);
+
+    exit:
+        (void)aResource;
+        (void)aResponse;
+        (void)aIp6;
+        (void)aPort;
+    }
+
+    Dtls::Server *                 mServer;
+    Dtls::Session *                mSession;
+    Coap::Agent *                  mCoapAgent;
+    Coap::Resource                 mPetitionHandler;
+    Coap::Resource                 mKeepAliveHandler;
+    Coap::Resource                 mCommissionerSetHandler;
+    Coap::Resource                 mRelayTransmitHandler;
+    std::vector<SimulatedJoiner *> mJoiners;
+    JoinerMap                      mJoinersByIid;
+    unsigned int                   mConcurrency;
+    unsigned long                  mTimeout;
+    size_t                         mNextJoiner;
+    unsigned long                  mStartTime;
+    unsigned long                  mFinishTime;
+    unsigned long                  mNumRelayRx;
+    unsigned long                  mNumRelayTx;
+};
+
+static void PrintUsage(const char *aProgram, FILE *aStream, int aExitCode)
+{
+    fprintf(aStream,
+            "joiner-load - simulate joiners commissioned by otbr-commissioner\n"
+            "Syntax:\n"
+            "    %s [Options]\n"
+            "Options:\n"
+            "    -k, --pskc                 HEX         PSKc of the network, see the pskc tool\n"
+            "    -p, --port                 NUMBER      UDP port to accept the commissioner on, default %d\n"
+            "    -n, --joiners              NUMBER      Number of joiners, default %d\n"
+            "    -c, --concurrency          NUMBER      Max joiners in progress at the same time, default unlimited\n"
+            "    -t, --timeout              NUMBER      Seconds before a joiner is counted as failed, default %d\n"
+            "    -w, --write-csv            PATH        Write the joiners as a CSV file for otbr-commissioner -F\n"
+            "    -d, --debug-level          NUMBER      Debug level(0~7)\n"
+            "    -h, --help                             Print this help\n"
+            "Example:\n"
+            "    %s -k $(pskc 123456 1122334455667788 OpenThread) -n 100 -w joiners.csv\n"
+            "    otbr-commissioner -H ::1 -P %d -N OpenThread -C 123456 -X 1122334455667788 -F joiners.csv\n",
+            aProgram, kDefaultPort, kDefaultNumJoiners, kDefaultTimeout, aProgram, kDefaultPort);
+
+    exit(aExitCode);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct option options[] = {{"pskc", required_argument, NULL, 'k'},
+                                      {"port", required_argument, NULL, 'p'},
+                                      {"joiners", required_argument, NULL, 'n'},
+                                      {"concurrency", required_argument, NULL, 'c'},
+                                      {"timeout", required_argument, NULL, 't'},
+                                      {"write-csv", required_argument, NULL, 'w'},
+                                      {"debug-level", required_argument, NULL, 'd'},
+                                      {"help", no_argument, NULL, 'h'},
+                                      {0, 0, 0, 0}};
+
+    uint8_t     pskc[kPskcLength];
+    bool        isPskcSet   = false;
+    int         port        = kDefaultPort;
+    int         numJoiners  = kDefaultNumJoiners;
+    int         concurrency = 0;
+    int         timeout     = kDefaultTimeout;
+    int         debugLevel  = OTBR_LOG_WARNING;
+    const char *csvPath     = NULL;
+    int         ret         = EXIT_FAILURE;
+
+    while (true)
+    {
+        int option = getopt_long(argc, argv, "k:p:n:c:t:w:d:h", options, NULL);
+
+        if (option == -1)
+        {
+            break;
+        }
+
+        switch (option)
+        {
+        case 'k':
+            VerifyOrExit(Utils::Hex2Bytes(optarg, pskc, sizeof(pskc)) == sizeof(pskc),
+                         fprintf(stderr, "Invalid PSKc!\n"));
+            isPskcSet = true;
+            break;
+        case 'p':
+            port = atoi(optarg);
+            VerifyOrExit(port > 0 && port <= 65535, fprintf(stderr, "Invalid port!\n"));
+            break;
+        case 'n':
+            numJoiners = atoi(optarg);
+            VerifyOrExit(numJoiners > 0, fprintf(stderr, "Invalid number of joiners!\n"));
+            break;
+        case 'c':
+            concurrency = atoi(optarg);
+            VerifyOrExit(concurrency >= 0, fprintf(stderr, "Invalid concurrency!\n"));
+            break;
+        case 't':
+            timeout = atoi(optarg);
+            VerifyOrExit(timeout > 0, fprintf(stderr, "Invalid timeout!\n"));
+            break;
+        case 'w':
+            csvPath = optarg;
+            break;
+        case 'd':
+            debugLevel = atoi(optarg);
+            VerifyOrExit(debugLevel >= 0 && debugLevel <= 7, fprintf(stderr, "Debug level must be between 0 and 7!\n"));
+            break;
+        case 'h':
+            PrintUsage(argv[0], stdout, EXIT_SUCCESS);
+            break;
+        default:
+            PrintUsage(argv[0], stderr, EXIT_FAILURE);
+            break;
+        }
+    }
+
+    VerifyOrExit(isPskcSet, fprintf(stderr, "Missing PSKc!\n"));
+
+    otbrLogInit("joiner-load", debugLevel, true);
+    signal(SIGTERM, HandleSignal);
+    signal(SIGINT, HandleSignal);
+
+    {
+        LoadGenerator generator(static_cast<unsigned int>(numJoiners), static_cast<unsigned int>(concurrency),
+                                static_cast<unsigned long>(timeout) * 1000, kDefaultPskd);
+
+        if (csvPath != NULL)
+        {
+            SuccessOrExit(generator.WriteCsv(csvPath));
+        }
+
+        SuccessOrExit(generator.Init(static_cast<uint16_t>(port), pskc));
+        printf("waiting for the commissioner on port %d\n", port);
+
+        while (!generator.IsDone() && !sShouldTerminate)
+        {
+            int     maxFd         = -1;
+            timeval selectTimeout = {1, 0};
+            fd_set  readFdSet;
+            fd_set  writeFdSet;
+            fd_set  errorFdSet;
+
+            FD_ZERO(&readFdSet);
+            FD_ZERO(&writeFdSet);
+            FD_ZERO(&errorFdSet);
+            generator.UpdateFdSet(readFdSet, writeFdSet, errorFdSet, maxFd, selectTimeout);
+
+            if (select(maxFd + 1, &readFdSet, &writeFdSet, &errorFdSet, &selectTimeout) < 0)
+            {
+                VerifyOrExit(errno == EINTR, perror("select"));
+                continue;
+            }
+
+            generator.Process(readFdSet, writeFdSet, errorFdSet);
+        }
+
+        generator.WriteReport(stdout);
+        ret = generator.IsDone() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+exit:
+    return ret;
+}
@@ -0,0 +1,184 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a microbenchmark of the logging, formatting at the call site or deferring it.
+ */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+/**
+ * Constants.
+ */
+enum
+{
+    kDefaultNumIterations = 200000,
+    kBurstSize            = 128, ///< Logs per burst, the writer catches up between bursts.
+    kRingCapacity         = 256,
+};
+
+/**
+ * What is benchmarked.
+ */
+enum Mode
+{
+    kModeSync,           ///< otbrLog() formatting and writing in the calling thread.
+    kModeAsync,          ///< otbrLog() formatting in the calling thread, writing in the writer thread.
+    kModeDeferred,       ///< otbrLogDeferred() formatting and writing in the writer thread.
+    kModeDeferredBinary, ///< otbrLogDeferred() writing the binary log file in the writer thread.
+};
+
+static const char kFormat[]  = "DTLS[:%hu] %s:%04d: %s";
+static const char kFile[]    = "third_party/mbedtls/repo/library/ssl_tls.c";
+static const char kMessage[] = "<= write record";
+
+static double GetSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void Run(const char *aName, Mode aMode, int aNumIterations)
+{
+    double         caller = 0;
+    double         start  = GetSeconds();
+    unsigned short port   = 49191;
+
+    for (int i = 0; i < aNumIterations; i += kBurstSize)
+    {
+        double burstStart = GetSeconds();
+
+        for (int line = i; line < i + kBurstSize && line < aNumIterations; line++)
+        {
+            if (aMode == kModeSync || aMode == kModeAsync)
+            {
+                otbrLog(OTBR_LOG_INFO, kFormat, port, kFile, line, kMessage);
+            }
+            else
+            {
+                otbrLogDeferred(OTBR_LOG_INFO, kFormat, port, kFile, line, kMessage);
+            }
+        }
+        caller += GetSeconds() - burstStart;
+
+        // Writing is timed as a whole only.
+        otbrLogFlush();
+    }
+
+    printf("%-22s %10.1f ns/call %10.1f ns/log (dropped %lu)\n", aName, caller * 1e9 / aNumIterations,
+           (GetSeconds() - start) * 1e9 / aNumIterations, otbrLogGetDroppedCount());
+}
+
+static void PrintUsage(const char *aProgram, FILE *aStream, int aExitCode)
+{
+    fprintf(aStream,
+            "log-bench - benchmark the logging, formatting at the call site or deferring it\n"
+            "Syntax:\n"
+            "    %s [Options]\n"
+            "Options:\n"
+            "    -n, --iterations           NUMBER      Number of logs, default %d\n"
+            "    -o, --output               PREFIX      Prefix of the log files, default /tmp/log-bench\n"
+            "    -h, --help                             Print this help\n",
+            aProgram, kDefaultNumIterations);
+
+    exit(aExitCode);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct option options[] = {{"iterations", required_argument, NULL, 'n'},
+                                      {"output", required_argument, NULL, 'o'},
+                                      {"help", no_argument, NULL, 'h'},
+                                      {0, 0, 0, 0}};
+
+    int         numIterations = kDefaultNumIterations;
+    const char *prefix        = "/tmp/log-bench";
+    char        path[256];
+    int         ret = EXIT_FAILURE;
+
+    while (true)
+    {
+        int option = getopt_long(argc, argv, "n:o:h", options, NULL);
+
+        if (option == -1)
+        {
+            break;
+        }
+
+        switch (option)
+        {
+        case 'n':
+            numIterations = atoi(optarg);
+            VerifyOrExit(numIterations > 0, fprintf(stderr, "Invalid number of iterations!\n"));
+            break;
+        case 'o':
+            prefix = optarg;
+            VerifyOrExit(strlen(prefix) + sizeof(".log") <= sizeof(path), fprintf(stderr, "Prefix too long!\n"));
+            break;
+        case 'h':
+            PrintUsage(argv[0], stdout, EXIT_SUCCESS);
+            break;
+        default:
+            PrintUsage(argv[0], stderr, EXIT_FAILURE);
+            break;
+        }
+    }
+
+    snprintf(path, sizeof(path), "%s.log", prefix);
+    otbrLogSetFilename(path);
+    otbrLogInit("log-bench", OTBR_LOG_INFO, false);
+    otbrLogEnableSyslog(false);
+
+    Run("otbrLog sync", kModeSync, numIterations);
+
+    otbrLogEnableAsync(kRingCapacity, OTBR_LOG_OVERFLOW_BLOCK);
+    Run("otbrLog async", kModeAsync, numIterations);
+    Run("otbrLogDeferred async", kModeDeferred, numIterations);
+
+    snprintf(path, sizeof(path), "%s.bin", prefix);
+    otbrLogSetBinaryFilename(path);
+    otbrLogEnableAsync(kRingCapacity, OTBR_LOG_OVERFLOW_BLOCK);
+    Run("otbrLogDeferred binary", kModeDeferredBinary, numIterations);
+
+    otbrLogDeinit();
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}
@@ -0,0 +1,183 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a decoder of binary log files, printing them like the text log file.
+ */
+
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/log_binary.hpp"
+
+/**
+ * Constants.
+ */
+enum
+{
+    kMaxEntryLength = 0xffff, ///< Max length of the format string or of the arguments of an entry.
+};
+
+static uint32_t ReadLittleEndian(const uint8_t *aInput, size_t aSize)
+{
+    uint32_t value = 0;
+
+    for (size_t i = aSize; i > 0; i--)
+    {
+        value = (value << 8) | aInput[i - 1];
+    }
+
+    return value;
+}
+
+static void PrintUsage(const char *aProgram, FILE *aStream, int aExitCode)
+{
+    fprintf(aStream,
+            "log-decode - print a binary log file like the text log file\n"
+            "Syntax:\n"
+            "    %s [Options] [FILE]\n"
+            "Options:\n"
+            "    -h, --help                             Print this help\n"
+            "The binary log file is read from stdin if FILE is not given.\n",
+            aProgram);
+
+    exit(aExitCode);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct option options[] = {{"help", no_argument, NULL, 'h'}, {0, 0, 0, 0}};
+
+    std::vector<std::string> formats;
+    std::vector<uint8_t>     data(kMaxEntryLength);
+    char                     magic[sizeof(otbr::BinaryLog::kFileMagic)];
+    char                     text[kMaxEntryLength + 1];
+    uint8_t                  header[otbr::BinaryLog::kRecordHeaderSize];
+    FILE *                   input = stdin;
+    int                      ret   = EXIT_FAILURE;
+
+    while (true)
+    {
+        int option = getopt_long(argc, argv, "h", options, NULL);
+
+        if (option == -1)
+        {
+            break;
+        }
+
+        switch (option)
+        {
+        case 'h':
+            PrintUsage(argv[0], stdout, EXIT_SUCCESS);
+            break;
+        default:
+            PrintUsage(argv[0], stderr, EXIT_FAILURE);
+            break;
+        }
+    }
+
+    if (optind < argc)
+    {
+        input = fopen(argv[optind], "rb");
+        VerifyOrExit(input != NULL, perror(argv[optind]));
+    }
+
+    VerifyOrExit(fread(magic, sizeof(magic), 1, input) == 1 &&
+                     memcmp(magic, otbr::BinaryLog::kFileMagic, sizeof(magic)) == 0,
+                 fprintf(stderr, "Not a binary log file!\n"));
+
+    while (fread(header, 1, 1, input) == 1)
+    {
+        uint16_t formatId;
+        uint16_t length;
+
+        if (header[0] == otbr::BinaryLog::kEntryFormat)
+        {
+            VerifyOrExit(fread(&header[1], otbr::BinaryLog::kFormatHeaderSize - 1, 1, input) == 1,
+                         fprintf(stderr, "Truncated format entry!\n"));
+            formatId = static_cast<uint16_t>(ReadLittleEndian(&header[1], 2));
+            length   = static_cast<uint16_t>(ReadLittleEndian(&header[3], 2));
+            VerifyOrExit(length == 0 || fread(&data[0], length, 1, input) == 1,
+                         fprintf(stderr, "Truncated format entry!\n"));
+
+            if (formats.size() <= formatId)
+            {
+                formats.resize(formatId + 1U);
+            }
+            formats[formatId].assign(reinterpret_cast<const char *>(&data[0]), length);
+        }
+        else if (header[0] == otbr::BinaryLog::kEntryRecord)
+        {
+            unsigned long timestamp;
+
+            VerifyOrExit(fread(&header[1], otbr::BinaryLog::kRecordHeaderSize - 1, 1, input) == 1,
+                         fprintf(stderr, "Truncated record entry!\n"));
+            formatId  = static_cast<uint16_t>(ReadLittleEndian(&header[1], 2));
+            timestamp = ReadLittleEndian(&header[4], 4);
+            length    = static_cast<uint16_t>(ReadLittleEndian(&header[8], 2));
+            VerifyOrExit(length == 0 || fread(&data[0], length, 1, input) == 1,
+                         fprintf(stderr, "Truncated record entry!\n"));
+
+            if (formatId == 0)
+            {
+                memcpy(text, &data[0], length);
+                text[length] = '\0';
+            }
+            else if (formatId < formats.size() && !formats[formatId].empty())
+            {
+                otbr::BinaryLog::FormatArgs(formats[formatId].c_str(), &data[0], length, text, sizeof(text));
+            }
+            else
+            {
+                snprintf(text, sizeof(text), "<unknown format %u>", formatId);
+            }
+
+            printf("%4lu.%03lu | %s\n", timestamp / 1000, timestamp % 1000, text);
+        }
+        else
+        {
+            ExitNow(fprintf(stderr, "Unknown entry type %u!\n", header[0]));
+        }
+    }
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    if (input != NULL && input != stdin)
+    {
+        fclose(input);
+    }
+    return ret;
+}
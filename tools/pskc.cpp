@@ -31,7 +31,15 @@
  *   This file implements a simple tool to compute pskc.
  */
 
+#include <string>
+#include <vector>
+
+#include <ctype.h>
+#include <errno.h>
+#include <getopt.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
@@ -45,6 +53,19 @@ enum
     kMaxNetworkName = 16,
     kMaxPassphrase  = 255,
     kSizeExtPanId   = 8,
+    kBatchSize      = 256, ///< Lines computed together, bounding memory while keeping all cores busy.
+};
+
+/**
+ * This structure represents one line of a batch.
+ *
+ */
+struct BatchLine
+{
+    std::string mPassphrase;
+    std::string mNetworkName;
+    uint8_t     mExtPanId[kSizeExtPanId];
+    bool        mIsValid;
 };
 
 void help(void)
@@ -52,57 +73,224 @@ void help(void)
     printf("pskc - compute PSKc\n"
            "SYNTAX:\n"
            "    pskc <PASSPHRASE> <EXTPANID> <NETWORK_NAME>\n"
+           "    pskc [-t THREADS] -f <FILE>\n"
+           "OPTIONS:\n"
+           "    -f FILE     Read one '<PASSPHRASE> <EXTPANID> <NETWORK_NAME>' per line from FILE, '-' for stdin,\n"
+           "                and print one PSKc per line in input order. Invalid lines print an empty line.\n"
+           "    -t THREADS  Number of threads, default one per hardware thread\n"
            "EXAMPLE:\n"
-           "    pskc 654321 1122334455667788 OpenThread\n");
+           "    pskc 654321 1122334455667788 OpenThread\n"
+           "    printf '654321 1122334455667788 OpenThread\\n123456 1122334455667788 Test Network\\n' | pskc -f -\n");
 }
 
-int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+int parseInput(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName, uint8_t *aExtPanIdBytes)
 {
-    uint8_t extpanid[kSizeExtPanId];
-    size_t  length;
-    int     ret = -1;
-
-    otbr::Psk::Pskc pskcComputer;
-    const uint8_t * pskc;
+    size_t length;
+    int    ret = -1;
 
     length = strlen(aPassphrase);
-    VerifyOrExit(length > 0, printf("PASSPHRASE must not be empty.\n"));
+    VerifyOrExit(length > 0, fprintf(stderr, "PASSPHRASE must not be empty.\n"));
     VerifyOrExit(length <= kMaxPassphrase,
-                 printf("PASSPHRASE Passphrase must be no more than %d bytes.\n", kMaxPassphrase));
+                 fprintf(stderr, "PASSPHRASE Passphrase must be no more than %d bytes.\n", kMaxPassphrase));
 
     length = strlen(aExtPanId);
-    VerifyOrExit(length == kSizeExtPanId * 2, printf("EXTPANID length must be %d bytes.\n", kSizeExtPanId));
+    VerifyOrExit(length == kSizeExtPanId * 2, fprintf(stderr, "EXTPANID length must be %d bytes.\n", kSizeExtPanId));
     for (size_t i = 0; i < length; i++)
     {
         VerifyOrExit((aExtPanId[i] <= '9' && aExtPanId[i] >= '0') || (aExtPanId[i] <= 'f' && aExtPanId[i] >= 'a') ||
                          (aExtPanId[i] <= 'F' && aExtPanId[i] >= 'A'),
-                     printf("EXTPANID must be encoded in hex.\n"));
+                     fprintf(stderr, "EXTPANID must be encoded in hex.\n"));
     }
-    otbr::Utils::Hex2Bytes(aExtPanId, extpanid, sizeof(extpanid));
+    otbr::Utils::Hex2Bytes(aExtPanId, aExtPanIdBytes, kSizeExtPanId);
 
     length = strlen(aNetworkName);
-    VerifyOrExit(length > 0, printf("NETWORK_NAME must not be empty.\n"));
+    VerifyOrExit(length > 0, fprintf(stderr, "NETWORK_NAME must not be empty.\n"));
     VerifyOrExit(length <= kMaxNetworkName,
-                 printf("NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
+                 fprintf(stderr, "NETWORK_NAME length must be no more than %d bytes.\n", kMaxNetworkName));
+
+    ret = 0;
+
+exit:
+    return ret;
+}
 
-    pskc = pskcComputer.ComputePskc(extpanid, aNetworkName, aPassphrase);
-    for (int i = 0; i < 16; i++)
+void printHex(const uint8_t *aPskc)
+{
+    for (int i = 0; i < OT_PSKC_LENGTH; i++)
     {
-        printf("%02x", pskc[i]);
+        printf("%02x", aPskc[i]);
     }
     printf("\n");
+}
+
+int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+{
+    uint8_t extpanid[kSizeExtPanId];
+    int     ret = -1;
+
+    otbr::Psk::Pskc pskcComputer;
+
+    SuccessOrExit(parseInput(aPassphrase, aExtPanId, aNetworkName, extpanid));
+
+    printHex(pskcComputer.ComputePskc(extpanid, aNetworkName, aPassphrase));
     ret = 0;
 
 exit:
     return ret;
 }
 
+/**
+ * This function splits a batch line into the passphrase, the extended PAN ID and the network name.
+ *
+ * The network name is the rest of the line, so that it may contain spaces.
+ *
+ */
+bool parseLine(char *aLine, size_t aLineNumber, BatchLine &aBatchLine)
+{
+    char *passphrase;
+    char *extPanId;
+    char *networkName = NULL;
+    char *end         = aLine + strlen(aLine);
+
+    aBatchLine.mIsValid = false;
+
+    while (end > aLine && isspace(static_cast<unsigned char>(end[-1])))
+    {
+        *--end = '\0';
+    }
+
+    passphrase = strtok_r(aLine, " \t", &networkName);
+    extPanId   = (passphrase != NULL ? strtok_r(NULL, " \t", &networkName) : NULL);
+    VerifyOrExit(extPanId != NULL,
+                 fprintf(stderr, "Line %zu: expected <PASSPHRASE> <EXTPANID> <NETWORK_NAME>.\n", aLineNumber));
+    networkName += strspn(networkName, " \t");
+
+    VerifyOrExit(parseInput(passphrase, extPanId, networkName, aBatchLine.mExtPanId) == 0,
+                 fprintf(stderr, "Line %zu is invalid.\n", aLineNumber));
+
+    aBatchLine.mPassphrase  = passphrase;
+    aBatchLine.mNetworkName = networkName;
+    aBatchLine.mIsValid     = true;
+
+exit:
+    return aBatchLine.mIsValid;
+}
+
+void computeBatch(std::vector<BatchLine> &aLines, unsigned int aNumThreads)
+{
+    std::vector<otbr::Psk::PskcInput> inputs;
+    std::vector<uint8_t>              pskcs;
+    size_t                            next = 0;
+
+    for (size_t i = 0; i < aLines.size(); i++)
+    {
+        if (aLines[i].mIsValid)
+        {
+            otbr::Psk::PskcInput input = {aLines[i].mExtPanId, aLines[i].mNetworkName.c_str(),
+                                          aLines[i].mPassphrase.c_str()};
+
+            inputs.push_back(input);
+        }
+    }
+
+    pskcs.resize(inputs.size() * OT_PSKC_LENGTH);
+    if (!inputs.empty())
+    {
+        otbr::Psk::Pskc::ComputePskcBatch(&inputs[0], inputs.size(), &pskcs[0], aNumThreads);
+    }
+
+    for (size_t i = 0; i < aLines.size(); i++)
+    {
+        if (aLines[i].mIsValid)
+        {
+            printHex(&pskcs[OT_PSKC_LENGTH * next++]);
+        }
+        else
+        {
+            printf("\n");
+        }
+    }
+
+    fflush(stdout);
+    aLines.clear();
+}
+
+int printPSKcBatch(const char *aPath, unsigned int aNumThreads)
+{
+    FILE *                 file       = (strcmp(aPath, "-") == 0 ? stdin : fopen(aPath, "r"));
+    char *                 line       = NULL;
+    size_t                 size       = 0;
+    size_t                 lineNumber = 0;
+    std::vector<BatchLine> lines;
+    int                    ret = -1;
+
+    VerifyOrExit(file != NULL, fprintf(stderr, "Failed to open %s: %s\n", aPath, strerror(errno)));
+
+    ret = 0;
+    while (getline(&line, &size, file) != -1)
+    {
+        BatchLine batchLine;
+
+        ++lineNumber;
+        if (!parseLine(line, lineNumber, batchLine))
+        {
+            ret = -1;
+        }
+
+        lines.push_back(batchLine);
+        if (lines.size() == kBatchSize)
+        {
+            computeBatch(lines, aNumThreads);
+        }
+    }
+
+    computeBatch(lines, aNumThreads);
+
+exit:
+    free(line);
+    if (file != NULL && file != stdin)
+    {
+        fclose(file);
+    }
+
+    return ret;
+}
+
 int main(int argc, char *argv[])
 {
-    int ret = 0;
+    const char * path       = NULL;
+    unsigned int numThreads = 0;
+    int          ret        = 0;
+    int          option;
+
+    while ((option = getopt(argc, argv, "f:t:h")) != -1)
+    {
+        switch (option)
+        {
+        case 'f':
+            path = optarg;
+            break;
+        case 't':
+            VerifyOrExit(atoi(optarg) > 0, fprintf(stderr, "Invalid number of threads: %s\n", optarg), ret = -1);
+            numThreads = static_cast<unsigned int>(atoi(optarg));
+            break;
+        case 'h':
+            ExitNow(help());
+        default:
+            ExitNow(help(), ret = -1);
+        }
+    }
 
-    VerifyOrExit(argc == 4, help(), ret = -1);
-    ret = printPSKc(argv[1], argv[2], argv[3]);
+    if (path != NULL)
+    {
+        VerifyOrExit(optind == argc, help(), ret = -1);
+        ret = printPSKcBatch(path, numThreads);
+    }
+    else
+    {
+        VerifyOrExit(argc - optind == 3, help(), ret = -1);
+        ret = printPSKc(argv[optind], argv[optind + 1], argv[optind + 2]);
+    }
 
 exit:
     return ret;
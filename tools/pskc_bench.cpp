@@ -0,0 +1,239 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a microbenchmark of the PSKc computation.
+ *
+ *   It compares the reference computation, which runs the whole AES-CMAC-PRF-128 for every PBKDF2 iteration, with
+ *   each PSKc engine supported by the running CPU, then measures the throughput of the batch API.
+ */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <mbedtls/cmac.h>
+
+#include "common/code_utils.hpp"
+#include "utils/pskc.hpp"
+
+using otbr::Psk::Pskc;
+
+/**
+ * Constants.
+ */
+enum
+{
+    kDefaultIterations = 20,
+    kDefaultBatchSize  = 64,
+};
+
+static const uint8_t kExtPanId[OT_EXTENDED_PAN_ID_LENGTH] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+static const char    kNetworkName[]                       = "OpenThread";
+
+static double GetSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void ComputeReferencePskc(const char *aPassphrase, uint8_t *aPskc)
+{
+    uint8_t prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t prfOutput[OT_PSKC_LENGTH];
+    size_t  saltLen = 0;
+
+    memcpy(prfInput, "Thread", 6);
+    saltLen += 6;
+    memcpy(prfInput + saltLen, kExtPanId, sizeof(kExtPanId));
+    saltLen += sizeof(kExtPanId);
+    memcpy(prfInput + saltLen, kNetworkName, strlen(kNetworkName));
+    saltLen += strlen(kNetworkName);
+    memcpy(prfInput + saltLen, "\x00\x00\x00\x01", 4);
+
+    mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
+                             saltLen + 4, prfOutput);
+    memcpy(aPskc, prfOutput, OT_PSKC_LENGTH);
+
+    for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
+    {
+        memcpy(prfInput, prfOutput, sizeof(prfOutput));
+        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
+                                 sizeof(prfOutput), prfOutput);
+
+        for (uint32_t j = 0; j < OT_PSKC_LENGTH; j++)
+        {
+            aPskc[j] ^= prfOutput[j];
+        }
+    }
+}
+
+static double BenchmarkReference(int aIterations, uint8_t *aPskc)
+{
+    double start = GetSeconds();
+
+    for (int i = 0; i < aIterations; i++)
+    {
+        ComputeReferencePskc("123456", aPskc);
+    }
+
+    return (GetSeconds() - start) / aIterations;
+}
+
+static double BenchmarkEngine(int aIterations, uint8_t *aPskc)
+{
+    double start = GetSeconds();
+
+    for (int i = 0; i < aIterations; i++)
+    {
+        Pskc::ComputePskc(kExtPanId, kNetworkName, "123456", aPskc);
+    }
+
+    return (GetSeconds() - start) / aIterations;
+}
+
+static void PrintUsage(const char *aProgram, FILE *aStream, int aExitCode)
+{
+    fprintf(aStream,
+            "pskc-bench - benchmark the PSKc computation\n"
+            "Syntax:\n"
+            "    %s [Options]\n"
+            "Options:\n"
+            "    -n, --iterations           NUMBER      PSKcs computed for each single-thread result, default %d\n"
+            "    -b, --batch                NUMBER      PSKcs computed by the batch API, default %d\n"
+            "    -t, --threads              NUMBER      Threads of the batch API, default one per hardware thread\n"
+            "    -h, --help                             Print this help\n",
+            aProgram, kDefaultIterations, kDefaultBatchSize);
+
+    exit(aExitCode);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct option options[] = {{"iterations", required_argument, NULL, 'n'},
+                                      {"batch", required_argument, NULL, 'b'},
+                                      {"threads", required_argument, NULL, 't'},
+                                      {"help", no_argument, NULL, 'h'},
+                                      {0, 0, 0, 0}};
+    static const Pskc::Engine kEngines[] = {Pskc::kEngineSoftware, Pskc::kEngineAesNi, Pskc::kEngineArmCrypto};
+
+    int                   iterations = kDefaultIterations;
+    int                   batchSize  = kDefaultBatchSize;
+    int                   numThreads = 0;
+    Pskc::Engine          best       = Pskc::GetEngine();
+    otbr::Psk::PskcInput *inputs     = NULL;
+    uint8_t *             pskcs      = NULL;
+    uint8_t               expected[OT_PSKC_LENGTH];
+    uint8_t               pskc[OT_PSKC_LENGTH];
+    double                reference;
+    double                elapsed;
+    int                   ret = EXIT_FAILURE;
+
+    while (true)
+    {
+        int option = getopt_long(argc, argv, "n:b:t:h", options, NULL);
+
+        if (option == -1)
+        {
+            break;
+        }
+
+        switch (option)
+        {
+        case 'n':
+            iterations = atoi(optarg);
+            VerifyOrExit(iterations > 0, fprintf(stderr, "Invalid number of iterations!\n"));
+            break;
+        case 'b':
+            batchSize = atoi(optarg);
+            VerifyOrExit(batchSize > 0, fprintf(stderr, "Invalid batch size!\n"));
+            break;
+        case 't':
+            numThreads = atoi(optarg);
+            VerifyOrExit(numThreads >= 0, fprintf(stderr, "Invalid number of threads!\n"));
+            break;
+        case 'h':
+            PrintUsage(argv[0], stdout, EXIT_SUCCESS);
+            break;
+        default:
+            PrintUsage(argv[0], stderr, EXIT_FAILURE);
+            break;
+        }
+    }
+
+    reference = BenchmarkReference(iterations, expected);
+    printf("%-14s %10.3f ms/pskc\n", "reference", reference * 1000);
+
+    for (size_t i = 0; i < sizeof(kEngines) / sizeof(kEngines[0]); i++)
+    {
+        if (!Pskc::SetEngine(kEngines[i]))
+        {
+            continue;
+        }
+
+        elapsed = BenchmarkEngine(iterations, pskc);
+        VerifyOrExit(memcmp(pskc, expected, sizeof(pskc)) == 0,
+                     fprintf(stderr, "Engine %s computed a wrong PSKc!\n", Pskc::GetEngineName(kEngines[i])));
+        printf("%-14s %10.3f ms/pskc %8.1fx\n", Pskc::GetEngineName(kEngines[i]), elapsed * 1000, reference / elapsed);
+    }
+
+    Pskc::SetEngine(best);
+
+    inputs = new otbr::Psk::PskcInput[batchSize];
+    pskcs  = new uint8_t[batchSize * OT_PSKC_LENGTH];
+    for (int i = 0; i < batchSize; i++)
+    {
+        inputs[i].mExtPanId    = kExtPanId;
+        inputs[i].mNetworkName = kNetworkName;
+        inputs[i].mPassphrase  = "123456";
+    }
+
+    elapsed = GetSeconds();
+    Pskc::ComputePskcBatch(inputs, batchSize, pskcs, numThreads);
+    elapsed = GetSeconds() - elapsed;
+
+    for (int i = 0; i < batchSize; i++)
+    {
+        VerifyOrExit(memcmp(pskcs + i * OT_PSKC_LENGTH, expected, OT_PSKC_LENGTH) == 0,
+                     fprintf(stderr, "Batch computed a wrong PSKc!\n"));
+    }
+    printf("%-14s %10.1f pskc/s with engine %s\n", "batch", batchSize / elapsed, Pskc::GetEngineName(best));
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    delete[] inputs;
+    delete[] pskcs;
+    return ret;
+}
@@ -31,9 +31,12 @@
  *   This file implements a simple tool to compute pskc.
  */
 
+#include <errno.h>
+#include <getopt.h>
 #include <mbedtls/sha256.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
@@ -44,10 +47,18 @@ void help(void)
     printf("steering-data - compute steering data\n"
            "SYNTAX:\n"
            "    steering-data [LENGTH] <JOINER_ID> ...\n"
+           "    steering-data [-l LENGTH] [-p] -f <FILE>\n"
+           "OPTIONS:\n"
+           "    -f FILE     Read joiner ids separated by spaces or new lines from FILE, '-' for stdin,\n"
+           "                and print the steering data of all of them\n"
+           "    -l LENGTH   Length of the steering data in bytes, default 16\n"
+           "    -p          Print the steering data of the joiner ids of each line instead, in input order.\n"
+           "                Invalid lines print an empty line.\n"
            "EXAMPLE:\n"
            "    steering-data 18b4300000000001\n"
            "    steering-data 15 18b4300000000001\n"
-           "    steering-data 18b4300000000001 18b4300000000002\n");
+           "    steering-data 18b4300000000001 18b4300000000002\n"
+           "    printf '18b4300000000001\\n18b4300000000002\\n' | steering-data -f -\n");
 }
 
 int ComputeJoinerId(const char *aEui64, uint8_t *aJoinerId)
@@ -69,14 +80,127 @@ exit:
     return ret;
 }
 
+void PrintSteeringData(const otbr::SteeringData &aSteeringData)
+{
+    for (int i = 0; i < aSteeringData.GetLength(); i++)
+    {
+        printf("%02x", aSteeringData.GetBloomFilter()[i]);
+    }
+    printf("\n");
+}
+
+/**
+ * This function adds the joiner ids of a line to the steering data.
+ *
+ */
+int AddLine(char *aLine, size_t aLineNumber, otbr::SteeringData &aSteeringData)
+{
+    char *context = NULL;
+    int   ret     = 0;
+
+    for (char *eui64 = strtok_r(aLine, " \t\r\n", &context); eui64 != NULL;
+         eui64       = strtok_r(NULL, " \t\r\n", &context))
+    {
+        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
+
+        VerifyOrExit(ComputeJoinerId(eui64, joinerId) == 0, fprintf(stderr, " at line %zu\n", aLineNumber), ret = -1);
+        aSteeringData.ComputeBloomFilter(joinerId);
+    }
+
+exit:
+    return ret;
+}
+
+int ComputeBatch(const char *aPath, int aLength, bool aPerLine)
+{
+    FILE *             file       = (strcmp(aPath, "-") == 0 ? stdin : fopen(aPath, "r"));
+    char *             line       = NULL;
+    size_t             size       = 0;
+    size_t             lineNumber = 0;
+    otbr::SteeringData computer;
+    int                ret = -1;
+
+    VerifyOrExit(file != NULL, fprintf(stderr, "Failed to open %s: %s\n", aPath, strerror(errno)));
+
+    computer.Init(static_cast<uint8_t>(aLength));
+    ret = 0;
+
+    while (getline(&line, &size, file) != -1)
+    {
+        ++lineNumber;
+
+        if (!aPerLine)
+        {
+            SuccessOrExit(ret = AddLine(line, lineNumber, computer));
+        }
+        else if (AddLine(line, lineNumber, computer) == 0)
+        {
+            PrintSteeringData(computer);
+            computer.Init(static_cast<uint8_t>(aLength));
+        }
+        else
+        {
+            printf("\n");
+            computer.Init(static_cast<uint8_t>(aLength));
+            ret = -1;
+        }
+    }
+
+    if (!aPerLine)
+    {
+        PrintSteeringData(computer);
+    }
+
+exit:
+    free(line);
+    if (file != NULL && file != stdin)
+    {
+        fclose(file);
+    }
+
+    return ret;
+}
+
 int main(int argc, char *argv[])
 {
     otbr::SteeringData computer;
-    int                ret    = -1;
-    int                length = 16;
-    int                i      = 1;
+    const char *       path    = NULL;
+    bool               perLine = false;
+    int                ret     = -1;
+    int                length  = otbr::SteeringData::kMaxSizeOfBloomFilter;
+    int                option;
+    int                i;
+
+    while ((option = getopt(argc, argv, "f:l:ph")) != -1)
+    {
+        switch (option)
+        {
+        case 'f':
+            path = optarg;
+            break;
+        case 'l':
+            length = atoi(optarg);
+            VerifyOrExit(length > 0 && length <= otbr::SteeringData::kMaxSizeOfBloomFilter,
+                         fprintf(stderr, "Invalid bloom filter length: %d\n", length));
+            break;
+        case 'p':
+            perLine = true;
+            break;
+        case 'h':
+            ExitNow(help(), ret = 0);
+        default:
+            ExitNow(help());
+        }
+    }
 
-    if (argc < 2)
+    if (path != NULL)
+    {
+        VerifyOrExit(optind == argc, help());
+        ExitNow(ret = ComputeBatch(path, length, perLine));
+    }
+
+    i = optind;
+    if (i >= argc)
     {
         ExitNow(help());
     }
@@ -100,11 +224,7 @@ int main(int argc, char *argv[])
         computer.ComputeBloomFilter(joinerId);
     }
 
-    for (i = 0; i < length; i++)
-    {
-        printf("%02x", computer.GetBloomFilter()[i]);
-    }
-    printf("\n");
+    PrintSteeringData(computer);
 
     ret = 0;
 
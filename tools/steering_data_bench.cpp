@@ -0,0 +1,212 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a microbenchmark of the CRC16 and steering data computations.
+ */
+
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/code_utils.hpp"
+#include "utils/crc16.hpp"
+#include "utils/steering_data.hpp"
+
+using otbr::Crc16;
+using otbr::SteeringData;
+
+/**
+ * Constants.
+ */
+enum
+{
+    kDefaultNumJoiners = 100000,
+};
+
+static double GetSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static uint16_t ComputeBitwise(uint16_t aPolynomial, const uint8_t *aBuffer, size_t aLength)
+{
+    uint16_t crc = 0;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        crc ^= static_cast<uint16_t>(aBuffer[i] << 8);
+
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>(static_cast<uint16_t>(crc << 1) ^ aPolynomial)
+                                 : static_cast<uint16_t>(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+static void PrintResult(const char *aName, double aSeconds, size_t aNumJoiners, unsigned int aChecksum)
+{
+    printf("%-22s %10.1f ns/joiner (checksum %04x)\n", aName, aSeconds * 1e9 / aNumJoiners, aChecksum & 0xffff);
+}
+
+static void PrintUsage(const char *aProgram, FILE *aStream, int aExitCode)
+{
+    fprintf(aStream,
+            "steering-data-bench - benchmark the CRC16 and steering data computations\n"
+            "Syntax:\n"
+            "    %s [Options]\n"
+            "Options:\n"
+            "    -n, --joiners              NUMBER      Number of joiners, default %d\n"
+            "    -h, --help                             Print this help\n",
+            aProgram, kDefaultNumJoiners);
+
+    exit(aExitCode);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct option options[] = {
+        {"joiners", required_argument, NULL, 'n'}, {"help", no_argument, NULL, 'h'}, {0, 0, 0, 0}};
+
+    int                  numJoiners = kDefaultNumJoiners;
+    std::vector<uint8_t> eui64s;
+    std::vector<uint8_t> joinerIds;
+    SteeringData         single;
+    SteeringData         batch;
+    unsigned int         checksum;
+    double               start;
+    int                  ret = EXIT_FAILURE;
+
+    while (true)
+    {
+        int option = getopt_long(argc, argv, "n:h", options, NULL);
+
+        if (option == -1)
+        {
+            break;
+        }
+
+        switch (option)
+        {
+        case 'n':
+            numJoiners = atoi(optarg);
+            VerifyOrExit(numJoiners > 0, fprintf(stderr, "Invalid number of joiners!\n"));
+            break;
+        case 'h':
+            PrintUsage(argv[0], stdout, EXIT_SUCCESS);
+            break;
+        default:
+            PrintUsage(argv[0], stderr, EXIT_FAILURE);
+            break;
+        }
+    }
+
+    eui64s.resize(numJoiners * SteeringData::kSizeJoinerId);
+    joinerIds.resize(eui64s.size());
+    for (size_t i = 0; i < eui64s.size(); i++)
+    {
+        eui64s[i] = static_cast<uint8_t>(rand());
+    }
+
+    checksum = 0;
+    start    = GetSeconds();
+    for (int i = 0; i < numJoiners; i++)
+    {
+        const uint8_t *eui64 = &eui64s[i * SteeringData::kSizeJoinerId];
+
+        checksum += ComputeBitwise(Crc16::kCcitt, eui64, SteeringData::kSizeJoinerId);
+        checksum += ComputeBitwise(Crc16::kAnsi, eui64, SteeringData::kSizeJoinerId);
+    }
+    PrintResult("crc16 bitwise", GetSeconds() - start, numJoiners, checksum);
+
+    checksum = 0;
+    start    = GetSeconds();
+    for (int i = 0; i < numJoiners; i++)
+    {
+        Crc16 ccitt(Crc16::kCcitt);
+        Crc16 ansi(Crc16::kAnsi);
+
+        for (int j = 0; j < SteeringData::kSizeJoinerId; j++)
+        {
+            ccitt.Update(eui64s[i * SteeringData::kSizeJoinerId + j]);
+            ansi.Update(eui64s[i * SteeringData::kSizeJoinerId + j]);
+        }
+        checksum += ccitt.Get() + ansi.Get();
+    }
+    PrintResult("crc16 table", GetSeconds() - start, numJoiners, checksum);
+
+    checksum = 0;
+    start    = GetSeconds();
+    for (int i = 0; i < numJoiners; i++)
+    {
+        Crc16 ccitt(Crc16::kCcitt);
+        Crc16 ansi(Crc16::kAnsi);
+
+        ccitt.Update(&eui64s[i * SteeringData::kSizeJoinerId], SteeringData::kSizeJoinerId);
+        ansi.Update(&eui64s[i * SteeringData::kSizeJoinerId], SteeringData::kSizeJoinerId);
+        checksum += ccitt.Get() + ansi.Get();
+    }
+    PrintResult("crc16 slice-by-8", GetSeconds() - start, numJoiners, checksum);
+
+    single.Init(SteeringData::kMaxSizeOfBloomFilter);
+    start = GetSeconds();
+    for (int i = 0; i < numJoiners; i++)
+    {
+        uint8_t joinerId[SteeringData::kSizeJoinerId];
+
+        SteeringData::ComputeJoinerId(&eui64s[i * SteeringData::kSizeJoinerId], joinerId);
+        single.ComputeBloomFilter(joinerId);
+    }
+    PrintResult("steering data single", GetSeconds() - start, numJoiners, single.GetBloomFilter()[0]);
+
+    batch.Init(SteeringData::kMaxSizeOfBloomFilter);
+    start = GetSeconds();
+    SteeringData::ComputeJoinerIds(&eui64s[0], numJoiners, &joinerIds[0]);
+    batch.ComputeBloomFilter(&joinerIds[0], numJoiners);
+    PrintResult("steering data batch", GetSeconds() - start, numJoiners, batch.GetBloomFilter()[0]);
+
+    VerifyOrExit(memcmp(single.GetBloomFilter(), batch.GetBloomFilter(), SteeringData::kMaxSizeOfBloomFilter) == 0,
+                 fprintf(stderr, "Batch computed a wrong steering data!\n"));
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}